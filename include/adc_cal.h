@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+#include <driver/adc.h>
+
+// Calibrated raw -> millivolt conversion for the ADC1 sensor inputs.
+//
+// The ESP32 ADC is non-linear at 11 dB and its gain differs between units.
+// adc_cal_prepare() characterizes one attenuation once, from the eFuse
+// two-point values or eFuse Vref when the chip has them, and samples the
+// curve into a 257-knot table (every 16 counts). adc_raw_to_mv() is then
+// a lookup plus a linear step, instead of esp_adc_cal_raw_to_voltage() per
+// sample. init_hw() prepares 11 dB; a conversion on an attenuation that
+// was never prepared prepares it on the spot.
+
+enum class AdcCalSource : uint8_t {
+    None = 0,                   // not prepared yet
+    DefaultVref,                // no eFuse data: nominal 1100 mV reference
+    EfuseVref,
+    EfuseTwoPoint,
+};
+
+void adc_cal_prepare(adc_atten_t atten);
+uint16_t adc_raw_to_mv(uint16_t raw, adc_atten_t atten = ADC_ATTEN_DB_11);
+AdcCalSource adc_cal_source(adc_atten_t atten = ADC_ATTEN_DB_11);
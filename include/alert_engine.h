@@ -2,25 +2,7 @@
 
 #include <Arduino.h>
 #include "io.h"
-
-// Shared alert code space used by the central alert engine.
-// OFF means alerts are disabled or the sensor is unavailable.
-constexpr uint8_t ALERT_CODE_OFF = 0;
-constexpr uint8_t ALERT_CODE_LOW = 1;
-constexpr uint8_t ALERT_CODE_HIGH = 2;
-constexpr uint8_t ALERT_CODE_CRITICAL = 3;
-constexpr uint8_t ALERT_CODE_OK = 4;
-constexpr uint8_t ALERT_CODE_MOIST = 5;
-
-enum class AlertSensor : uint8_t {
-    Temp = 0,
-    Humidity,
-    Light,
-    Sound,
-    Soil,
-    Ds18,
-    Count
-};
+#include "alert_filter.h"
 
 struct AlertEvent {
     uint8_t code;
@@ -29,6 +11,19 @@ struct AlertEvent {
     bool exited;
 };
 
+// One committed code change, kept in a fixed ring for the UI and BLE.
+// seq increases by one per entry and never wraps in practice, so callers can
+// poll incrementally with the last seq they saw.
+struct AlertHistoryEntry {
+    uint32_t seq;
+    uint32_t time_ms;
+    AlertSensor sensor;
+    uint8_t from_code;
+    uint8_t to_code;
+};
+
+constexpr size_t ALERT_HISTORY_CAPACITY = 32;
+
 struct GlobalAlertSummary {
     bool active;
     AlertSensor primary_sensor;
@@ -41,15 +36,14 @@ struct GlobalAlertSummary {
     uint32_t entry_notice_until_ms;
 };
 
-uint8_t classify_temp_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm);
-uint8_t classify_humidity_alert(float humidity, bool no_sensor, bool alerts_enabled, int dry_max, int comfort_max);
-uint8_t classify_light_alert(float lux, bool alerts_enabled, int dim_max, int bright_max);
-uint8_t classify_sound_alert(float level, bool alerts_enabled, int normal_max, int loud_max);
-uint8_t classify_ds18_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm);
-uint8_t classify_soil_alert(int category_id, bool no_sensor, bool alerts_enabled);
+// classify_soil_category_with() using the current soil thresholds.
+int classify_soil_category(float soil, bool no_sensor);
 
 // Refresh the shared alert state from the latest sensor snapshot.
 // This runs from the sensor task so alerts no longer depend on screen draws.
+// A new code must clear the per-sensor hysteresis band and then hold for the
+// sensor's dwell time before it replaces the current one; losing the sensor
+// or disabling its alerts (OFF) applies at once.
 void alert_engine_refresh_from_reading(const Reading& reading, bool sound_enabled);
 
 // Return the last known stable alert code for a sensor.
@@ -66,6 +60,13 @@ GlobalAlertSummary alert_engine_get_global_summary();
 bool alert_engine_has_global_alert();
 bool alert_engine_has_entry_notice();
 
+// Copy up to max_entries history entries newer than after_seq, oldest first,
+// and return how many were copied. Pass 0 to read the whole ring.
+size_t alert_engine_get_history(AlertHistoryEntry* out, size_t max_entries, uint32_t after_seq);
+
+// Seq of the newest history entry, 0 while the ring is empty.
+uint32_t alert_engine_history_seq();
+
 AlertEvent alert_engine_update(AlertSensor sensor, uint8_t code, bool screen_changed);
 void alert_engine_emit_audio(AlertSensor sensor, const AlertEvent& event, bool sound_enabled);
 void alert_engine_reset();
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Alert classification and the hysteresis/dwell filter that decides when a
+// new code replaces the current one. No Arduino dependency: thresholds come
+// in through AlertInput, so recorded traces can be replayed on a host
+// (test/test_alert_filter). alert_engine.cpp owns the state and the outputs.
+
+// Shared alert code space used by the central alert engine.
+// OFF means alerts are disabled or the sensor is unavailable.
+constexpr uint8_t ALERT_CODE_OFF = 0;
+constexpr uint8_t ALERT_CODE_LOW = 1;
+constexpr uint8_t ALERT_CODE_HIGH = 2;
+constexpr uint8_t ALERT_CODE_CRITICAL = 3;
+constexpr uint8_t ALERT_CODE_OK = 4;
+constexpr uint8_t ALERT_CODE_MOIST = 5;
+
+enum class AlertSensor : uint8_t {
+    Temp = 0,
+    Humidity,
+    Light,
+    Sound,
+    Soil,
+    Ds18,
+    Count
+};
+
+// Hysteresis band and dwell time per sensor, indexed by AlertSensor. The band
+// is the larger of band_abs and band_pct % of the reading, so the log-scaled
+// lux value gets a band that grows with it.
+struct AlertFilterSpec {
+    float band_abs;
+    uint8_t band_pct;
+    uint16_t dwell_ms;
+};
+
+constexpr AlertFilterSpec ALERT_FILTER_SPEC[(size_t)AlertSensor::Count] = {
+    {0.3f,  0, 1500},   // Temp, °C
+    {1.5f,  0, 1500},   // Humidity, %
+    {2.0f,  8,  500},   // Light, lux
+    {3.0f,  0,  300},   // Sound, level 0-100
+    {2.0f,  0, 1500},   // Soil, %
+    {0.25f, 0, 1500}    // Ds18, °C
+};
+
+// Classifier arguments for one sensor. The value is passed separately to
+// alert_classify_input() so the hysteresis check can probe both sides of it.
+// Soil uses low/mid/high as its dry/optimal/moist thresholds.
+struct AlertInput {
+    float value;
+    bool no_sensor;
+    bool enabled;
+    int low;
+    int mid;
+    int high;
+};
+
+// Candidate code waiting for its dwell time.
+struct AlertFilterState {
+    uint8_t pending_code;
+    uint32_t pending_since_ms;
+};
+
+uint8_t classify_temp_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm);
+uint8_t classify_humidity_alert(float humidity, bool no_sensor, bool alerts_enabled, int dry_max, int comfort_max);
+uint8_t classify_light_alert(float lux, bool alerts_enabled, int dim_max, int bright_max);
+uint8_t classify_sound_alert(float level, bool alerts_enabled, int normal_max, int loud_max);
+uint8_t classify_ds18_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm);
+// Soil category 0 dry, 1 optimal, 2 moist, 3 saturated; -1 without a sensor.
+int classify_soil_category_with(float soil, bool no_sensor, int dry, int optimal, int moist);
+uint8_t classify_soil_alert(int category_id, bool no_sensor, bool alerts_enabled);
+
+uint8_t alert_classify_input(AlertSensor sensor, const AlertInput& in, float value);
+
+// Code to commit for this reading, given the committed code `stable`. A
+// different code is held back while the reading is within the band of the
+// current code's range, and then until it has been seen for the dwell time.
+// OFF in either direction is immediate.
+uint8_t alert_filter_code(AlertSensor sensor, const AlertInput& in, uint8_t stable, AlertFilterState& state,
+                          uint32_t now_ms);
@@ -1,5 +1,6 @@
 #pragma once
 #include <atomic>
+#include "io.h"
 
 extern std::atomic<bool> client_connected;
 
@@ -8,7 +9,18 @@ extern std::atomic<bool> client_connected;
  */
 void init_ble();
 
+/**
+ * @brief Run init_ble() on a short-lived worker task so boot is not blocked
+ */
+void init_ble_async();
+
 /**
  * @brief Notify all connected clients with updated data
  */
 void notifyAll();
+
+/**
+ * @brief Notify subscribed characteristics whose data changed beyond the
+ * deadband or whose max interval elapsed. Called from the sensor task.
+ */
+void ble_service_telemetry(const Reading& snapshot, uint32_t now_ms);
@@ -0,0 +1,24 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "reading.h"
+
+// Legacy BLE payloads built from one Reading: the 20-byte packet on the
+// new characteristic and the compact JSON on the legacy one.
+//
+// Both write into caller-owned buffers and never touch the heap, so the
+// 10 Hz notify path stays allocation-free. No Arduino dependency; the
+// zero-allocation claim is checked on a host (test/test_ble_payload).
+
+constexpr size_t DATA_PACKET_LEN = 20;
+// Longest JSON: {"temp":-20.0,"hum":100.0,"ldr":20000,"mic":100,"soil":100,"ds18":-55.0}
+constexpr size_t JSON_PACKET_MAX_LEN = 96;
+
+// 0x02 0x00, then six { id, LE16 } fields: temperature x10 (s16), humidity
+// x10, lux, sound, soil, DS18B20 x10 (s16). Missing sensors send 0.
+// `buf` holds DATA_PACKET_LEN bytes; returns DATA_PACKET_LEN.
+size_t assm_pkt(const Reading& rec_pkt, uint8_t* buf);
+
+// NUL-terminated JSON with only the present sensors; truncated to
+// out_size - 1 characters. Returns the length without the NUL.
+size_t makeJson(const Reading& rec_pkt, char* out, size_t out_size);
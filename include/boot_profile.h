@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Boot phase timing. setup() wraps each stage in boot_phase_begin()/end();
+// the UI router marks the first rendered app frame. Durations are printed
+// once the first frame is on screen, and the last/best results per boot kind
+// are kept in RTC memory so they survive deep sleep.
+
+enum BootKind : uint8_t {
+    BOOT_KIND_COLD = 0,
+    BOOT_KIND_WAKE_EXT0,
+    BOOT_KIND_COUNT
+};
+
+void boot_profile_set_kind(BootKind kind);
+
+// Phases are sequential on the setup() path; begin closes any open phase.
+void boot_phase_begin(const char* name);
+void boot_phase_end();
+
+// Work that runs off the critical path (worker tasks) reports its own time.
+void boot_profile_record_async(const char* name, uint32_t duration_us);
+
+// Called by the UI task after the first app screen draw. Only the first call counts.
+void boot_profile_mark_first_pixel();
@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+
+// RGB565 blends shared by the lab screens. Header-only and Arduino-free so
+// their per-call cost is measured on a host (test/test_perf_bench); on the
+// target the loops that call them carry the PERF_COLOR_BLEND probe.
+
+// Per-channel average of a and b.
+inline uint16_t blend565(uint16_t a, uint16_t b) {
+    const uint8_t ar = (uint8_t)((a >> 11) & 0x1F);
+    const uint8_t ag = (uint8_t)((a >> 5) & 0x3F);
+    const uint8_t ab = (uint8_t)(a & 0x1F);
+    const uint8_t br = (uint8_t)((b >> 11) & 0x1F);
+    const uint8_t bg = (uint8_t)((b >> 5) & 0x3F);
+    const uint8_t bb = (uint8_t)(b & 0x1F);
+    return (uint16_t)(((uint8_t)((ar + br) / 2) << 11) |
+                      ((uint8_t)((ag + bg) / 2) << 5) |
+                      (uint8_t)((ab + bb) / 2));
+}
+
+// a to b in 256 steps; amount_b 0 gives a, 255 gives b.
+inline uint16_t mix565(uint16_t a, uint16_t b, uint8_t amount_b) {
+    const uint16_t ar = (a >> 11) & 0x1F;
+    const uint16_t ag = (a >> 5) & 0x3F;
+    const uint16_t ab = a & 0x1F;
+    const uint16_t br = (b >> 11) & 0x1F;
+    const uint16_t bg = (b >> 5) & 0x3F;
+    const uint16_t bb = b & 0x1F;
+    const uint16_t amount_a = 255 - amount_b;
+    const uint16_t r = (ar * amount_a + br * amount_b) / 255;
+    const uint16_t g = (ag * amount_a + bg * amount_b) / 255;
+    const uint16_t bl = (ab * amount_a + bb * amount_b) / 255;
+    return (uint16_t)((r << 11) | (g << 5) | bl);
+}
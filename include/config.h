@@ -17,7 +17,25 @@ constexpr uint32_t SENSOR_READ_INTERVAL_MS = 1000; // 1 segundo
 // Temporary UI laboratory screens for evaluating alternate graph/dashboard layouts.
 // Keep ON while iterating on visual concepts; set to 0 to hide the lab screens
 // from the carousel without touching the product screens.
+// esp32dev-prod builds with 0 and also leaves the lab modules out of the build;
+// esp32dev-lab builds with 1.
+#ifndef PBIT_ENABLE_GRAPH_LAB
 #define PBIT_ENABLE_GRAPH_LAB 1
+#endif
+
+// Lab screens that are not in the carousel: icon galleries, icon sizes/test,
+// overview and linear dashboards, and the standalone card/gauge/value views
+// (the sensor zone still uses those renderers). Nothing navigates to them, so
+// they are only linked when a lab build asks for them.
+#ifndef PBIT_ENABLE_LAB_GALLERY
+#define PBIT_ENABLE_LAB_GALLERY 0
+#endif
+
+// Cycle-count profiler for the hot kernels (see perf_probe.h).
+// Enabled by the esp32dev-perf environment; keep it OFF in regular builds.
+#ifndef PBIT_ENABLE_PERF_PROBE
+#define PBIT_ENABLE_PERF_PROBE 0
+#endif
 
 // --- Power management ---
 // IDLE is the product's visible sleep state.
@@ -29,6 +47,33 @@ constexpr uint32_t DEEP_SLEEP_TIMEOUT_MS = 120000; // 2 minutos
 constexpr uint16_t IDLE_BEEP_HZ = 700;
 constexpr uint16_t DEEP_SLEEP_BEEP_HZ = 900;
 
+// Power manager: the CPU runs at POWER_CPU_MIN_MHZ unless rendering or a
+// sensor burst holds a boost lock. 80 MHz keeps APB at 80 MHz, so SPI, UART
+// and LEDC timings do not change with the CPU clock.
+constexpr uint32_t POWER_CPU_MAX_MHZ = 240;
+constexpr uint32_t POWER_CPU_MIN_MHZ = 80;
+constexpr uint32_t POWER_LOOP_PERIOD_MS = 250;       // loop() sin eventos; un cambio de modo lo despierta antes
+constexpr uint32_t POWER_IDLE_UI_PERIOD_MS = 30;     // tarea UI en IDLE (5 ms en ACTIVE)
+constexpr uint32_t POWER_STATS_REPORT_MS = 60000;
+
+// Logging sleep: after a long IDLE with no BLE client the device drops into
+// real deep sleep, wakes on the RTC timer to log one reading into RTC memory,
+// and goes back to sleep. The encoder button (EXT0) still restores the UI.
+#ifndef PBIT_ENABLE_LOG_SLEEP
+#define PBIT_ENABLE_LOG_SLEEP 1
+#endif
+constexpr uint32_t LOG_SLEEP_AFTER_IDLE_MS = 600000;   // 10 minutos en IDLE
+constexpr uint32_t LOG_SLEEP_INTERVAL_S = 60;          // una muestra por minuto
+
+// ULP monitor for logging sleep: the ULP coprocessor samples the LDR and soil
+// channels and wakes the CPU only when an alert class changes or its buffer
+// fills. The RTC timer wake is not used while it is enabled.
+#ifndef PBIT_ENABLE_ULP_MONITOR
+#define PBIT_ENABLE_ULP_MONITOR PBIT_ENABLE_LOG_SLEEP
+#endif
+constexpr uint32_t ULP_MONITOR_INTERVAL_MS = 60000;    // una muestra LDR/suelo por minuto
+constexpr uint16_t ULP_MONITOR_CONFIRM_SAMPLES = 2;    // muestras seguidas fuera de zona para despertar
+
 // --- Debug: uncomment to enable Serial diagnostics ---
 // #define FIRMWARE_DEBUG
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// DHT11 response decoder, independent of how the pulses were captured.
+//
+// Input is the line as alternating levels with their lengths in µs, as the
+// RMT receiver reports them. Anything before the sensor's response (the tail
+// of the host start pulse) is skipped: the response is an ~80 µs low plus an
+// ~80 µs high, then 40 bits of ~50 µs low followed by a ~26 µs (0) or
+// ~70 µs (1) high, MSB first.
+
+struct DhtPulse {
+    uint8_t level;              // 0 low, 1 high
+    uint16_t us;
+};
+
+enum class DhtDecodeStatus : uint8_t {
+    Ok = 0,
+    NoResponse,                 // no 80/80 µs response found
+    ShortFrame,                 // fewer than 40 bits
+    BadTiming,                  // a bit low or high outside its window
+    Checksum,
+};
+
+struct DhtFrame {
+    uint8_t bytes[5];           // RH int, RH dec, T int, T dec (bit 7: negative), sum
+};
+
+DhtDecodeStatus dht_decode_pulses(const DhtPulse* pulses, size_t count, DhtFrame* out);
+
+// DHT11 frame to %RH and °C, with the same rules as the Adafruit library.
+void dht11_frame_values(const DhtFrame& frame, float* humidity, float* temp_c);
+
+const char* dht_decode_status_name(DhtDecodeStatus status);
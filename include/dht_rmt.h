@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+
+// DHT11 on the RMT receiver instead of a bit-banged read.
+//
+// The Adafruit library times the 40 bits in a busy loop with interrupts off
+// for ~5 ms on core 0. Here the calling task sleeps through the 20 ms start
+// pulse and blocks on the RMT ring buffer while the peripheral records the
+// response; interrupts stay on and the core is free meanwhile. The capture is
+// decoded with dht_decode_pulses() (dht_decode.h).
+//
+// Reads closer than DHT_MIN_INTERVAL_MS return the previous result, as the
+// library did. Sensor task only.
+
+constexpr uint32_t DHT_MIN_INTERVAL_MS = 2000;
+
+bool dht_rmt_begin(int pin);
+
+// Humidity (%RH) and temperature (°C); both NaN when the read failed.
+// Returns false on failure.
+bool dht_rmt_read(float* humidity, float* temp_c);
@@ -1,6 +1,8 @@
 #pragma once
 #include <stddef.h>
+#ifdef ARDUINO  // host builds (test/test_perf_bench) have no mux
 #include <Arduino.h>  // portMUX_TYPE
+#endif
 
 // Number of samples kept per sensor (1 sample/s → ~2 min 40 s of history).
 // Also equals the usable graph width in pixels.
@@ -26,4 +28,6 @@ extern GraphBuffer  g_graph_ds18;
 extern GraphBuffer  g_graph_light;
 extern GraphBuffer  g_graph_sound;
 extern GraphBuffer  g_graph_soil;
+#ifdef ARDUINO
 extern portMUX_TYPE g_graph_mux;
+#endif
@@ -0,0 +1,104 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "sleep_log_sample.h"
+
+// Framing for the BLE history download (MANUAL_TECNICO_PBIT.md, section 10).
+// No Arduino/NimBLE dependency: the encoder and decoder can be built on a host
+// to check a client implementation against the firmware.
+
+// Sensor ids match the live packet: 1 temp, 2 hum, 3 ldr, 4 mic, 5 soil, 6 ds18.
+constexpr uint8_t HISTORY_SENSOR_COUNT = 6;
+constexpr size_t  HISTORY_MAX_SAMPLES  = 160;   // == GRAPH_BUFFER_SIZE
+
+// Sources: the 1 s graph buffers, or the deep-sleep log (sleep_logger_read()).
+constexpr uint8_t HISTORY_SOURCE_GRAPH     = 0;
+constexpr uint8_t HISTORY_SOURCE_SLEEP_LOG = 1;
+
+// Client -> device commands.
+// 0x10 <mask u8> <snapshot_id u16> <sensor_id u8> <offset u16> [<source u8>]
+//   snapshot_id 0 (or a stale id) takes a new snapshot and starts from the top.
+//   A matching id resumes at (sensor_id, offset). Without the source byte the
+//   graph buffers are sent; the sleep log ignores mask and sensor_id.
+constexpr uint8_t HISTORY_CMD_START            = 0x10;
+constexpr size_t  HISTORY_CMD_START_LEN        = 7;
+constexpr size_t  HISTORY_CMD_START_SOURCE_LEN = 8;
+constexpr uint8_t HISTORY_CMD_ABORT            = 0x1E;
+
+// Device -> client frames.
+// 0x10 <sensor_id> <snapshot_id u16> <offset u16> <total u16> <scale u8> <int16 LE samples...>
+// 0x11 <snapshot_id u16> <offset u16> <14-byte LE records...>
+//   no total, so one record still fits a default-MTU payload (20 bytes).
+//   record: <t_s u32> <temp_x10 i16> <hum_x10 i16> <ds18_x10 i16> <ldr u16> <soil u8> <mic u8>
+// 0x1F <snapshot_id u16> <total_samples u16>   (records for the sleep log)
+constexpr uint8_t HISTORY_FRAME_DATA       = 0x10;
+constexpr uint8_t HISTORY_FRAME_LOG        = 0x11;
+constexpr uint8_t HISTORY_FRAME_END        = 0x1F;
+constexpr size_t  HISTORY_DATA_HEADER_LEN  = 9;
+constexpr size_t  HISTORY_LOG_HEADER_LEN   = 5;
+constexpr size_t  HISTORY_LOG_RECORD_LEN   = 14;
+constexpr size_t  HISTORY_END_FRAME_LEN    = 5;
+
+// Samples that do not fit the int16 range after scaling.
+constexpr int16_t HISTORY_SAMPLE_INVALID = INT16_MIN;
+
+struct HistorySnapshot {
+    uint16_t id;
+    uint16_t count[HISTORY_SENSOR_COUNT];
+    uint8_t  scale[HISTORY_SENSOR_COUNT];   // divide a sample by this to get the value
+    int16_t  samples[HISTORY_SENSOR_COUNT][HISTORY_MAX_SAMPLES];
+};
+
+// The sleep log is already a flat series; the snapshot only pins its id.
+struct HistoryLogSnapshot {
+    uint16_t id;
+    uint16_t count;
+    const SleepLogSample* samples;
+};
+
+struct HistoryStartRequest {
+    uint8_t  mask;          // bit (id - 1) selects sensor id
+    uint16_t snapshot_id;
+    uint8_t  sensor_id;
+    uint16_t offset;
+    uint8_t  source;        // HISTORY_SOURCE_*
+};
+
+struct HistoryCursor {
+    uint8_t  mask;
+    uint8_t  sensor_id;     // sensor being streamed, 0 once all data is out
+    uint16_t offset;        // sample index, or record index for the sleep log
+    uint8_t  source;
+    bool     active;        // false after the end frame has been produced
+};
+
+struct HistoryFrame {
+    uint8_t  type;
+    uint8_t  sensor_id;     // 0 in log frames
+    uint16_t snapshot_id;
+    uint16_t offset;        // data: first sample index / end: unused
+    uint16_t total;         // data: samples for this sensor / end: samples in the stream (log: records)
+    uint8_t  scale;
+    uint16_t sample_count;  // samples, or records in a log frame
+    const uint8_t* samples; // points into the decoded buffer
+};
+
+int16_t history_quantize(float value, uint8_t scale);
+
+size_t history_encode_start(const HistoryStartRequest& req, uint8_t* out, size_t cap);
+bool history_parse_start(const uint8_t* data, size_t len, HistoryStartRequest& req);
+
+// Position the cursor for a request. Resumes only when the snapshot id matches.
+void history_cursor_begin(HistoryCursor& cur, const HistorySnapshot& snap, const HistoryStartRequest& req);
+
+// Encode the next frame into out (cap = usable ATT payload). Returns its
+// length, or 0 once the end frame has already been produced.
+size_t history_encode_next(const HistorySnapshot& snap, HistoryCursor& cur, uint8_t* out, size_t cap);
+
+// Same pair for the sleep-log source.
+void history_log_cursor_begin(HistoryCursor& cur, const HistoryLogSnapshot& log, const HistoryStartRequest& req);
+size_t history_log_encode_next(const HistoryLogSnapshot& log, HistoryCursor& cur, uint8_t* out, size_t cap);
+
+bool history_decode_frame(const uint8_t* data, size_t len, HistoryFrame& frame);
+int16_t history_frame_sample(const HistoryFrame& frame, uint16_t index);
+bool history_frame_log_record(const HistoryFrame& frame, uint16_t index, SleepLogSample& rec);
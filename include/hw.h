@@ -12,6 +12,8 @@ constexpr size_t MAX_DEVICE_NAME_LEN = 20;
 #define PIN_SENSOR_HUMEDAD 35   // Soil moisture sensor (external J6)
 #define PIN_TEMP_DS18B20   33   // DS18B20 (external J3)
 #define PIN_DHT            4    // DHT11
+#define PIN_I2C_SDA        26   // external I2C, 4-pin connectors
+#define PIN_I2C_SCL        27
 
 /**
  * @brief MAC address of the device
@@ -32,6 +34,11 @@ void set_devicename();
  */
 void init_hw(); 
 
+/**
+ * Scan the DS18B20 1-Wire bus. Runs on the sensor task at startup.
+ */
+void init_ds18_bus();
+
 // --- Sensor helpers and persistence ---
 
 /**
@@ -137,6 +144,12 @@ int read_soil_raw_average();
  */
 int read_sound_level();
 
+/**
+ * Convert a raw soil ADC average to a calibrated percentage (0-100), no filtering.
+ * Returns NAN below the disconnected-sensor threshold.
+ */
+float soil_raw_to_percent(int raw_avg);
+
 /**
  * Read calibrated soil moisture as a percentage (0-100).
  * Returns NAN if the pin appears floating and the sensor is likely disconnected.
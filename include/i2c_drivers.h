@@ -0,0 +1,20 @@
+#pragma once
+#include "i2c_sched.h"
+
+// Sensor drivers for the external I2C bus, as I2cDriver descriptors.
+//
+// SCD41 (0x62): CO2, temperature and humidity in periodic mode, one
+//   sample every 5 s. Probing stops a measurement left running by a warm
+//   reset; reads are CRC checked.
+// BH1750 (0x23, ADDR low): one-shot high-resolution lux, once a second.
+//
+// Host buildable; the command sets follow the Sensirion and ROHM datasheets.
+
+constexpr uint8_t SCD41_I2C_ADDR = 0x62;
+constexpr uint8_t BH1750_I2C_ADDR = 0x23;
+
+extern const I2cDriver I2C_DRIVER_SCD41;
+extern const I2cDriver I2C_DRIVER_BH1750;
+
+// Sensirion CRC-8 (poly 0x31, init 0xFF); each data word is checked on its two bytes.
+uint8_t sensirion_crc8(const uint8_t* data, size_t len);
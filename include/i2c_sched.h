@@ -0,0 +1,102 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Time-multiplexed scheduler for slow sensors on the external I2C bus.
+//
+// Each sensor is a driver descriptor (probe, start measurement, poll ready,
+// read) and the scheduler keeps one slot per descriptor with the time its
+// next operation is due. i2c_sched_step() runs exactly one operation for
+// the slot due first, so a bus turn is one or two short transfers and
+// conversions of several devices overlap without anyone holding the bus
+// while a sensor integrates. Devices are probed at startup and re-probed
+// while absent; a device that fails I2C_SCHED_MAX_ERRORS operations in a
+// row counts as unplugged and its channels go back to NaN.
+//
+// No Arduino dependency: the bus is a table of function pointers, so the
+// same code runs against simulated devices on a host
+// (test/test_i2c_sched). i2c_sensors.cpp owns the firmware side.
+
+constexpr uint8_t  I2C_SCHED_MAX_DEVICES = 4;
+constexpr uint8_t  I2C_SCHED_MAX_ERRORS = 3;        // consecutive failures before a device is dropped
+constexpr uint32_t I2C_SCHED_REPROBE_MS = 10000;    // absent devices are probed again this often
+constexpr uint32_t I2C_SCHED_ERROR_RETRY_MS = 250;
+constexpr uint32_t I2C_SCHED_IDLE_MS = 1000;        // longest wait i2c_sched_step() returns
+
+// Published values; NaN while no device provides them.
+enum I2cChannel : uint8_t {
+    I2C_CH_CO2_PPM = 0,
+    I2C_CH_CO2_TEMP_C,
+    I2C_CH_CO2_HUMIDITY,
+    I2C_CH_LUX,
+    I2C_CH_COUNT
+};
+
+enum class I2cStatus : uint8_t {
+    Ok = 0,
+    Nack,                       // no device at the address, or it refused the data
+    Error,                      // timeout, arbitration or bus fault
+};
+
+struct I2cBus {
+    I2cStatus (*write)(void* ctx, uint8_t addr, const uint8_t* data, size_t len);
+    I2cStatus (*read)(void* ctx, uint8_t addr, uint8_t* data, size_t len);
+    void      (*wait_ms)(void* ctx, uint32_t ms);   // command execution gaps, a few ms at most
+    void*     ctx;
+};
+
+enum class I2cPoll : uint8_t {
+    Ready = 0,
+    NotReady,
+    Error,
+};
+
+// `state` is one byte owned by the driver, zeroed whenever the device is
+// (re)probed. Functions set *wait_ms to the time before the next operation
+// is worth doing.
+struct I2cDriver {
+    const char* name;
+    uint8_t     address;        // 7-bit, for logs
+    uint8_t     channel_mask;   // 1 << I2cChannel for every channel read() writes
+    uint32_t    period_ms;      // measurement cadence
+    uint32_t    poll_retry_ms;  // back-off after NotReady
+    bool        (*probe)(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms);
+    bool        (*start)(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms);
+    I2cPoll     (*poll)(const I2cBus& bus, uint8_t& state);     // nullptr: ready once start's wait elapsed
+    bool        (*read)(const I2cBus& bus, uint8_t& state, float* channels);
+};
+
+enum class I2cDeviceState : uint8_t {
+    Absent = 0,                 // probe due
+    Idle,                       // detected, next start due
+    Converting,                 // poll due
+    Reading,                    // ready, read due
+};
+
+struct I2cDevice {
+    const I2cDriver* driver;
+    I2cDeviceState state;
+    uint8_t driver_state;
+    uint8_t errors;             // consecutive failed operations
+    uint32_t due_ms;
+    uint32_t started_ms;
+    uint32_t samples;           // successful reads since boot
+};
+
+struct I2cScheduler {
+    I2cBus bus;
+    I2cDevice devices[I2C_SCHED_MAX_DEVICES];
+    uint8_t count;
+    float channels[I2C_CH_COUNT];
+};
+
+// Registers up to I2C_SCHED_MAX_DEVICES drivers; all are probed on the first steps.
+void i2c_sched_init(I2cScheduler& s, const I2cBus& bus, const I2cDriver* const* drivers, uint8_t count,
+                    uint32_t now_ms);
+
+// One operation for the device due first, if any is due. Returns the ms
+// until the next one is due (0: call again right away).
+uint32_t i2c_sched_step(I2cScheduler& s, uint32_t now_ms);
+
+// Bit i set when device i is currently detected.
+uint8_t i2c_sched_present_mask(const I2cScheduler& s);
@@ -0,0 +1,16 @@
+#pragma once
+#include "io.h"
+
+// External I2C sensors (SDA IO26, SCL IO27) on a task of their own.
+//
+// i2c_sensors_start() brings the bus up at 100 kHz and starts I2cTask on
+// core 0. The task runs the scheduler (i2c_sched.h) over the drivers in
+// i2c_drivers.h: detection at boot and again every I2C_SCHED_REPROBE_MS,
+// then one short bus operation per wake, sleeping until the next one is
+// due. The sensor task never touches the bus; it copies the last
+// published values into its snapshot with i2c_sensors_fill().
+
+void i2c_sensors_start();
+
+// I2C fields of `r`; NaN for sensors that are not connected. Any task.
+void i2c_sensors_fill(Reading& r);
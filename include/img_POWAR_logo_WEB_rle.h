@@ -0,0 +1,321 @@
+#pragma once
+
+// Generated by tools/rle565_encode.py, do not edit.
+// 160x128, 92 colours, 4644 bytes of stream (40960 bytes raw).
+
+#include "rle565.h"
+
+#define POWAR_LOGO_WEB_HEIGHT 128
+#define POWAR_LOGO_WEB_WIDTH 160
+
+static const uint16_t POWAR_logo_WEB_PALETTE[] PROGMEM = {
+  0xffff, 0x8067, 0x9f55, 0x1fbf, 0xbf5d, 0xdff7, 0xdf65, 0x9f96, 0x7fdf, 0xfdf7, 0xa88f, 0x5f86,
+  0xfae7, 0xfeff, 0xf8df, 0xbfef, 0xcfaf, 0xf9df, 0xff6d, 0x8167, 0xab97, 0xa477, 0xfef7, 0x1f76,
+  0xaa97, 0xdfae, 0xa26f, 0xd4c7, 0xf9e7, 0xa787, 0xbfa6, 0x9fe7, 0xcda7, 0xffb6, 0x5fcf, 0xa67f,
+  0xd4cf, 0x7f8e, 0x3fc7, 0x5f8e, 0xa377, 0xa57f, 0xd5cf, 0x7fd7, 0x9f9e, 0xd2bf, 0xd3c7, 0xf7d7,
+  0x3f7e, 0xd0b7, 0xbf9e, 0xfbef, 0xfcef, 0x9fdf, 0xd6cf, 0xab9f, 0x3f86, 0x5fd7, 0xa98f, 0x7f96,
+  0xa687, 0xbf55, 0xcea7, 0x1f7e, 0xd1b7, 0xa997, 0xdfef, 0x1fc7, 0xac9f, 0xbfe7, 0xfcf7, 0xfff7,
+  0xd1bf, 0xcca7, 0xceaf, 0xd6d7, 0xfbe7, 0x3fcf, 0x816f, 0xa36f, 0xcc9f, 0xdfa6, 0xa16f, 0xd3bf,
+  0xff75, 0xdf5d, 0xf6d7, 0xa47f, 0xffae, 0xdf6d, 0xdfb6, 0xffbe,
+};
+
+static const uint8_t POWAR_logo_WEB_DATA[] PROGMEM = {
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x25, 0x00,
+  0x80, 0x0d, 0x45, 0x00, 0x80, 0x05, 0x24, 0x03, 0x80, 0x43, 0x17, 0x00, 0x80, 0x2f, 0x07, 0x0a,
+  0x83, 0x18, 0x20, 0x1b, 0x09, 0x08, 0x00, 0x82, 0x4b, 0x37, 0x15, 0x01, 0x01, 0x83, 0x28, 0x3c,
+  0x4a, 0x33, 0x03, 0x00, 0x80, 0x14, 0x02, 0x0a, 0x80, 0x18, 0x03, 0x00, 0x80, 0x09, 0x03, 0x0a,
+  0x80, 0x0c, 0x03, 0x00, 0x80, 0x20, 0x02, 0x0a, 0x81, 0x3a, 0x0d, 0x02, 0x00, 0x80, 0x2d, 0x03,
+  0x0a, 0x80, 0x0e, 0x06, 0x00, 0x80, 0x0c, 0x07, 0x0a, 0x83, 0x41, 0x44, 0x40, 0x0c, 0x07, 0x00,
+  0x82, 0x08, 0x02, 0x55, 0x21, 0x06, 0x01, 0x04, 0x17, 0x00, 0x80, 0x24, 0x0b, 0x01, 0x81, 0x44,
+  0x09, 0x04, 0x00, 0x81, 0x0c, 0x1d, 0x08, 0x01, 0x80, 0x3e, 0x02, 0x00, 0x80, 0x41, 0x03, 0x01,
+  0x80, 0x34, 0x02, 0x00, 0x80, 0x2a, 0x03, 0x01, 0x80, 0x48, 0x03, 0x00, 0x80, 0x1a, 0x02, 0x01,
+  0x80, 0x29, 0x03, 0x00, 0x80, 0x28, 0x03, 0x01, 0x80, 0x18, 0x06, 0x00, 0x80, 0x0e, 0x0b, 0x01,
+  0x81, 0x1d, 0x1c, 0x05, 0x00, 0x82, 0x08, 0x02, 0x05, 0x21, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00,
+  0x80, 0x24, 0x0c, 0x01, 0x81, 0x29, 0x09, 0x02, 0x00, 0x81, 0x11, 0x1a, 0x0a, 0x01, 0x80, 0x0a,
+  0x01, 0x00, 0x80, 0x40, 0x03, 0x01, 0x80, 0x2a, 0x02, 0x00, 0x80, 0x3e, 0x03, 0x01, 0x80, 0x18,
+  0x02, 0x00, 0x80, 0x0c, 0x03, 0x01, 0x80, 0x20, 0x02, 0x00, 0x80, 0x2a, 0x04, 0x01, 0x81, 0x13,
+  0x34, 0x05, 0x00, 0x80, 0x0e, 0x0c, 0x01, 0x81, 0x4e, 0x0e, 0x04, 0x00, 0x82, 0x08, 0x02, 0x05,
+  0x21, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x29, 0x02, 0x14, 0x80,
+  0x1d, 0x04, 0x01, 0x80, 0x3a, 0x01, 0x00, 0x81, 0x09, 0x28, 0x03, 0x01, 0x84, 0x15, 0x3e, 0x31,
+  0x37, 0x13, 0x03, 0x01, 0x82, 0x20, 0x00, 0x0e, 0x03, 0x01, 0x80, 0x10, 0x02, 0x00, 0x80, 0x3c,
+  0x03, 0x01, 0x80, 0x1a, 0x02, 0x00, 0x80, 0x1b, 0x03, 0x01, 0x80, 0x1b, 0x02, 0x00, 0x80, 0x0a,
+  0x05, 0x01, 0x80, 0x31, 0x05, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x15, 0x01, 0x14, 0x82, 0x18,
+  0x1d, 0x13, 0x03, 0x01, 0x80, 0x15, 0x04, 0x00, 0x82, 0x08, 0x02, 0x05, 0x21, 0x00, 0x81, 0x03,
+  0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x03, 0x00, 0x81, 0x11, 0x1a, 0x03, 0x01,
+  0x82, 0x11, 0x00, 0x3e, 0x03, 0x01, 0x81, 0x3a, 0x0d, 0x02, 0x00, 0x81, 0x0c, 0x1a, 0x03, 0x01,
+  0x82, 0x0c, 0x00, 0x13, 0x02, 0x01, 0x80, 0x3a, 0x01, 0x00, 0x80, 0x16, 0x05, 0x01, 0x80, 0x0c,
+  0x01, 0x00, 0x80, 0x20, 0x03, 0x01, 0x80, 0x33, 0x01, 0x00, 0x80, 0x4c, 0x06, 0x01, 0x80, 0x15,
+  0x05, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x44, 0x03, 0x00, 0x81, 0x0c, 0x1a, 0x03, 0x01, 0x80,
+  0x0e, 0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x21, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24,
+  0x03, 0x01, 0x80, 0x10, 0x04, 0x00, 0x80, 0x10, 0x03, 0x01, 0x82, 0x48, 0x0d, 0x1a, 0x02, 0x01,
+  0x81, 0x13, 0x34, 0x04, 0x00, 0x80, 0x2d, 0x03, 0x01, 0x82, 0x49, 0x00, 0x1d, 0x02, 0x01, 0x80,
+  0x4f, 0x01, 0x00, 0x80, 0x56, 0x05, 0x01, 0x80, 0x2d, 0x01, 0x00, 0x80, 0x1d, 0x02, 0x01, 0x80,
+  0x28, 0x02, 0x00, 0x80, 0x4a, 0x02, 0x01, 0x80, 0x15, 0x03, 0x01, 0x80, 0x36, 0x04, 0x00, 0x80,
+  0x0e, 0x03, 0x01, 0x80, 0x44, 0x04, 0x00, 0x80, 0x20, 0x03, 0x01, 0x80, 0x1b, 0x03, 0x00, 0x82,
+  0x08, 0x02, 0x05, 0x0f, 0x00, 0x82, 0x22, 0x1e, 0x38, 0x01, 0x17, 0x82, 0x25, 0x21, 0x0f, 0x09,
+  0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x04, 0x00, 0x80, 0x1b,
+  0x03, 0x01, 0x81, 0x3e, 0x2f, 0x03, 0x01, 0x80, 0x0a, 0x05, 0x00, 0x80, 0x09, 0x03, 0x01, 0x82,
+  0x28, 0x00, 0x10, 0x03, 0x01, 0x82, 0x33, 0x00, 0x10, 0x05, 0x01, 0x80, 0x14, 0x01, 0x00, 0x80,
+  0x52, 0x02, 0x01, 0x80, 0x37, 0x02, 0x00, 0x80, 0x4f, 0x02, 0x01, 0x81, 0x40, 0x1d, 0x02, 0x01,
+  0x80, 0x41, 0x04, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x44, 0x04, 0x00, 0x80, 0x10, 0x03, 0x01,
+  0x80, 0x2a, 0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0d, 0x00, 0x81, 0x03, 0x06, 0x07, 0x02, 0x81,
+  0x25, 0x0f, 0x07, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x04,
+  0x00, 0x80, 0x20, 0x03, 0x01, 0x81, 0x31, 0x2e, 0x03, 0x01, 0x80, 0x49, 0x06, 0x00, 0x80, 0x28,
+  0x03, 0x01, 0x81, 0x09, 0x4b, 0x03, 0x01, 0x82, 0x2a, 0x00, 0x1d, 0x05, 0x01, 0x82, 0x28, 0x00,
+  0x0c, 0x03, 0x01, 0x80, 0x2d, 0x01, 0x00, 0x80, 0x1b, 0x03, 0x01, 0x81, 0x33, 0x2d, 0x03, 0x01,
+  0x80, 0x33, 0x03, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x44, 0x04, 0x00, 0x80, 0x3c, 0x03, 0x01,
+  0x80, 0x0c, 0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0b, 0x00, 0x81, 0x05, 0x38, 0x04, 0x02, 0x80,
+  0x3d, 0x04, 0x02, 0x81, 0x04, 0x26, 0x06, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03,
+  0x01, 0x80, 0x3e, 0x02, 0x09, 0x82, 0x33, 0x40, 0x13, 0x03, 0x01, 0x81, 0x11, 0x31, 0x03, 0x01,
+  0x80, 0x31, 0x06, 0x00, 0x80, 0x3c, 0x03, 0x01, 0x81, 0x0c, 0x09, 0x03, 0x01, 0x82, 0x10, 0x0d,
+  0x13, 0x01, 0x01, 0x81, 0x1a, 0x15, 0x02, 0x01, 0x81, 0x0c, 0x1b, 0x03, 0x01, 0x80, 0x1c, 0x01,
+  0x00, 0x80, 0x1d, 0x02, 0x01, 0x82, 0x1d, 0x00, 0x46, 0x03, 0x01, 0x80, 0x10, 0x03, 0x00, 0x80,
+  0x0e, 0x03, 0x01, 0x80, 0x0a, 0x02, 0x2f, 0x81, 0x1b, 0x0a, 0x03, 0x01, 0x80, 0x1d, 0x04, 0x00,
+  0x82, 0x08, 0x02, 0x05, 0x0a, 0x00, 0x81, 0x05, 0x17, 0x02, 0x02, 0x82, 0x27, 0x22, 0x05, 0x01,
+  0x00, 0x82, 0x1f, 0x19, 0x55, 0x02, 0x02, 0x80, 0x03, 0x05, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00,
+  0x80, 0x24, 0x0d, 0x01, 0x82, 0x18, 0x00, 0x4a, 0x03, 0x01, 0x80, 0x48, 0x06, 0x00, 0x80, 0x1d,
+  0x03, 0x01, 0x82, 0x1c, 0x00, 0x29, 0x02, 0x01, 0x81, 0x3a, 0x2f, 0x02, 0x01, 0x81, 0x41, 0x49,
+  0x02, 0x01, 0x81, 0x2e, 0x20, 0x02, 0x01, 0x80, 0x1a, 0x01, 0x00, 0x80, 0x0c, 0x03, 0x01, 0x80,
+  0x2d, 0x01, 0x00, 0x80, 0x0a, 0x02, 0x01, 0x80, 0x4f, 0x03, 0x00, 0x80, 0x0e, 0x0c, 0x01, 0x81,
+  0x4f, 0x0c, 0x04, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0a, 0x00, 0x80, 0x0b, 0x01, 0x02, 0x84, 0x06,
+  0x2b, 0x00, 0x26, 0x27, 0x01, 0x12, 0x83, 0x25, 0x2b, 0x05, 0x3b, 0x02, 0x02, 0x80, 0x08, 0x04,
+  0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x0c, 0x01, 0x83, 0x0a, 0x16, 0x00, 0x31, 0x03,
+  0x01, 0x80, 0x10, 0x06, 0x00, 0x80, 0x29, 0x03, 0x01, 0x82, 0x0c, 0x00, 0x20, 0x02, 0x01, 0x81,
+  0x1a, 0x31, 0x02, 0x01, 0x81, 0x48, 0x2a, 0x02, 0x01, 0x81, 0x37, 0x1d, 0x02, 0x01, 0x80, 0x3a,
+  0x01, 0x00, 0x80, 0x20, 0x03, 0x01, 0x80, 0x34, 0x01, 0x00, 0x80, 0x2e, 0x03, 0x01, 0x80, 0x2a,
+  0x02, 0x00, 0x80, 0x0e, 0x0b, 0x01, 0x81, 0x18, 0x33, 0x05, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0a,
+  0x00, 0x82, 0x4d, 0x30, 0x04, 0x01, 0x0f, 0x82, 0x3f, 0x02, 0x12, 0x01, 0x27, 0x84, 0x06, 0x02,
+  0x32, 0x00, 0x2c, 0x01, 0x02, 0x80, 0x17, 0x04, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x24,
+  0x0a, 0x01, 0x81, 0x3c, 0x1b, 0x02, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x50, 0x06, 0x00, 0x80,
+  0x1a, 0x03, 0x01, 0x82, 0x16, 0x00, 0x1b, 0x03, 0x01, 0x80, 0x15, 0x02, 0x01, 0x81, 0x11, 0x09,
+  0x02, 0x01, 0x81, 0x28, 0x4e, 0x02, 0x01, 0x83, 0x31, 0x00, 0x0d, 0x1a, 0x02, 0x01, 0x80, 0x29,
+  0x02, 0x1c, 0x80, 0x2f, 0x03, 0x01, 0x80, 0x0a, 0x02, 0x00, 0x80, 0x0e, 0x0a, 0x01, 0x81, 0x13,
+  0x0c, 0x06, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x84, 0x05, 0x00, 0x17, 0x04, 0x26, 0x03,
+  0x00, 0x84, 0x32, 0x02, 0x19, 0x00, 0x17, 0x01, 0x02, 0x80, 0x26, 0x03, 0x00, 0x81, 0x03, 0x04,
+  0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x3a, 0x02, 0x2e, 0x82, 0x24, 0x2f, 0x09, 0x04, 0x00,
+  0x80, 0x0c, 0x03, 0x01, 0x80, 0x1d, 0x05, 0x00, 0x80, 0x34, 0x03, 0x01, 0x80, 0x28, 0x01, 0x00,
+  0x80, 0x34, 0x06, 0x01, 0x80, 0x1a, 0x01, 0x00, 0x80, 0x29, 0x06, 0x01, 0x82, 0x2f, 0x00, 0x2e,
+  0x0d, 0x01, 0x80, 0x0c, 0x01, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x41, 0x01, 0x33, 0x80, 0x4a,
+  0x03, 0x01, 0x80, 0x3a, 0x06, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0e, 0x00, 0x8b, 0x0f, 0x35, 0x00,
+  0x22, 0x25, 0x3b, 0x39, 0x00, 0x25, 0x3d, 0x42, 0x2b, 0x01, 0x02, 0x80, 0x0b, 0x03, 0x00, 0x81,
+  0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x0b, 0x00, 0x80, 0x23, 0x03, 0x01,
+  0x80, 0x0c, 0x04, 0x00, 0x80, 0x10, 0x03, 0x01, 0x80, 0x20, 0x02, 0x00, 0x80, 0x15, 0x05, 0x01,
+  0x80, 0x18, 0x01, 0x00, 0x80, 0x3e, 0x05, 0x01, 0x83, 0x13, 0x0d, 0x00, 0x1d, 0x0d, 0x01, 0x80,
+  0x3e, 0x01, 0x00, 0x80, 0x0e, 0x03, 0x01, 0x80, 0x37, 0x01, 0x00, 0x81, 0x0d, 0x28, 0x03, 0x01,
+  0x80, 0x56, 0x05, 0x00, 0x82, 0x08, 0x02, 0x05, 0x11, 0x00, 0x80, 0x26, 0x01, 0x00, 0x80, 0x2c,
+  0x01, 0x0f, 0x85, 0x02, 0x21, 0x00, 0x06, 0x02, 0x04, 0x03, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00,
+  0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x0b, 0x00, 0x80, 0x53, 0x03, 0x01, 0x81, 0x29, 0x34, 0x02,
+  0x00, 0x81, 0x4b, 0x13, 0x02, 0x01, 0x81, 0x13, 0x4c, 0x02, 0x00, 0x80, 0x37, 0x05, 0x01, 0x80,
+  0x2d, 0x01, 0x00, 0x80, 0x36, 0x05, 0x01, 0x82, 0x3c, 0x00, 0x0c, 0x0e, 0x01, 0x83, 0x1a, 0x0d,
+  0x00, 0x0e, 0x03, 0x01, 0x80, 0x37, 0x02, 0x00, 0x80, 0x2e, 0x03, 0x01, 0x80, 0x29, 0x05, 0x00,
+  0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x81, 0x26, 0x45, 0x03, 0x00, 0x88, 0x35, 0x00, 0x08, 0x03,
+  0x00, 0x06, 0x07, 0x00, 0x25, 0x01, 0x02, 0x80, 0x0f, 0x02, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00,
+  0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x0c, 0x00, 0x80, 0x1d, 0x03, 0x01, 0x83, 0x52, 0x18, 0x49,
+  0x1d, 0x04, 0x01, 0x80, 0x10, 0x03, 0x00, 0x80, 0x2d, 0x05, 0x01, 0x80, 0x0c, 0x01, 0x00, 0x80,
+  0x16, 0x05, 0x01, 0x82, 0x3e, 0x00, 0x20, 0x03, 0x01, 0x80, 0x31, 0x05, 0x1c, 0x80, 0x3a, 0x03,
+  0x01, 0x82, 0x1b, 0x00, 0x0e, 0x03, 0x01, 0x80, 0x37, 0x03, 0x00, 0x80, 0x29, 0x03, 0x01, 0x80,
+  0x2d, 0x04, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x83, 0x04, 0x02, 0x0b, 0x39, 0x01, 0x00,
+  0x80, 0x06, 0x03, 0x00, 0x83, 0x17, 0x3b, 0x00, 0x2c, 0x01, 0x02, 0x80, 0x1f, 0x02, 0x00, 0x81,
+  0x03, 0x04, 0x17, 0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x0c, 0x00, 0x81, 0x46, 0x29, 0x0a,
+  0x01, 0x80, 0x37, 0x04, 0x00, 0x80, 0x0c, 0x04, 0x01, 0x80, 0x1a, 0x03, 0x00, 0x80, 0x1d, 0x04,
+  0x01, 0x82, 0x2a, 0x16, 0x1a, 0x03, 0x01, 0x80, 0x09, 0x05, 0x00, 0x80, 0x2a, 0x03, 0x01, 0x82,
+  0x1d, 0x00, 0x0e, 0x03, 0x01, 0x80, 0x37, 0x03, 0x00, 0x80, 0x36, 0x03, 0x01, 0x81, 0x1a, 0x09,
+  0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0b, 0x00, 0x80, 0x05, 0x03, 0x02, 0x82, 0x54, 0x3b, 0x38,
+  0x04, 0x00, 0x82, 0x0f, 0x00, 0x3b, 0x01, 0x02, 0x80, 0x1f, 0x02, 0x00, 0x81, 0x03, 0x04, 0x17,
+  0x00, 0x80, 0x24, 0x03, 0x01, 0x80, 0x10, 0x0d, 0x00, 0x82, 0x16, 0x20, 0x13, 0x06, 0x01, 0x81,
+  0x1a, 0x2d, 0x06, 0x00, 0x80, 0x1a, 0x03, 0x01, 0x80, 0x18, 0x03, 0x00, 0x80, 0x10, 0x04, 0x01,
+  0x81, 0x46, 0x53, 0x03, 0x01, 0x80, 0x3a, 0x06, 0x00, 0x81, 0x0d, 0x1a, 0x03, 0x01, 0x81, 0x1c,
+  0x0e, 0x03, 0x01, 0x80, 0x37, 0x04, 0x00, 0x80, 0x0a, 0x03, 0x01, 0x80, 0x20, 0x03, 0x00, 0x82,
+  0x08, 0x02, 0x05, 0x0c, 0x00, 0x05, 0x02, 0x82, 0x04, 0x51, 0x42, 0x04, 0x00, 0x82, 0x39, 0x30,
+  0x02, 0x03, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x0e, 0x03, 0x14, 0x80, 0x1b, 0x0f, 0x00,
+  0x88, 0x34, 0x48, 0x37, 0x0a, 0x29, 0x3a, 0x50, 0x1b, 0x0d, 0x07, 0x00, 0x80, 0x31, 0x03, 0x14,
+  0x80, 0x36, 0x03, 0x00, 0x80, 0x11, 0x03, 0x14, 0x82, 0x49, 0x00, 0x31, 0x03, 0x14, 0x80, 0x4b,
+  0x07, 0x00, 0x80, 0x40, 0x03, 0x14, 0x81, 0x1b, 0x0c, 0x03, 0x14, 0x80, 0x2d, 0x04, 0x00, 0x80,
+  0x0c, 0x04, 0x20, 0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x80, 0x17, 0x07, 0x02, 0x81,
+  0x3b, 0x35, 0x04, 0x00, 0x80, 0x1f, 0x03, 0x00, 0x81, 0x03, 0x04, 0x1c, 0x00, 0x85, 0x09, 0x2f,
+  0x1b, 0x2e, 0x2a, 0x0e, 0x05, 0x00, 0x0f, 0x11, 0x82, 0x16, 0x00, 0x4c, 0x0b, 0x0c, 0x80, 0x46,
+  0x08, 0x00, 0x80, 0x33, 0x01, 0x1c, 0x80, 0x34, 0x09, 0x00, 0x03, 0x1c, 0x80, 0x33, 0x0a, 0x00,
+  0x80, 0x34, 0x03, 0x1c, 0x03, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x80, 0x03, 0x08, 0x02,
+  0x80, 0x06, 0x09, 0x00, 0x81, 0x03, 0x04, 0x1a, 0x00, 0x81, 0x0e, 0x3a, 0x05, 0x01, 0x82, 0x1a,
+  0x44, 0x33, 0x01, 0x00, 0x80, 0x0d, 0x0f, 0x01, 0x82, 0x0e, 0x00, 0x23, 0x0b, 0x01, 0x80, 0x10,
+  0x07, 0x00, 0x81, 0x09, 0x1a, 0x01, 0x01, 0x80, 0x23, 0x08, 0x00, 0x80, 0x16, 0x03, 0x01, 0x80,
+  0x15, 0x0a, 0x00, 0x80, 0x57, 0x03, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x03,
+  0x00, 0x81, 0x1f, 0x03, 0x01, 0x19, 0x81, 0x26, 0x47, 0x03, 0x00, 0x80, 0x0b, 0x07, 0x02, 0x80,
+  0x22, 0x09, 0x00, 0x81, 0x03, 0x04, 0x19, 0x00, 0x80, 0x48, 0x09, 0x01, 0x83, 0x13, 0x36, 0x00,
+  0x0d, 0x0f, 0x01, 0x82, 0x0e, 0x00, 0x23, 0x0b, 0x01, 0x80, 0x10, 0x07, 0x00, 0x80, 0x40, 0x03,
+  0x01, 0x80, 0x2f, 0x07, 0x00, 0x80, 0x16, 0x04, 0x01, 0x80, 0x24, 0x08, 0x00, 0x80, 0x2a, 0x04,
+  0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x03, 0x00, 0x80, 0x04, 0x03, 0x02, 0x81,
+  0x04, 0x22, 0x03, 0x00, 0x80, 0x2c, 0x04, 0x02, 0x81, 0x06, 0x22, 0x0a, 0x00, 0x81, 0x03, 0x04,
+  0x18, 0x00, 0x80, 0x2f, 0x02, 0x01, 0x86, 0x3c, 0x56, 0x0d, 0x00, 0x09, 0x2a, 0x29, 0x01, 0x01,
+  0x82, 0x13, 0x0c, 0x00, 0x05, 0x11, 0x80, 0x0a, 0x01, 0x01, 0x80, 0x28, 0x05, 0x11, 0x82, 0x16,
+  0x00, 0x23, 0x01, 0x01, 0x80, 0x23, 0x08, 0x0e, 0x80, 0x34, 0x07, 0x00, 0x80, 0x15, 0x03, 0x01,
+  0x80, 0x41, 0x07, 0x00, 0x80, 0x16, 0x04, 0x01, 0x80, 0x3c, 0x08, 0x00, 0x80, 0x1d, 0x04, 0x01,
+  0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x03, 0x00, 0x80, 0x07, 0x05, 0x02, 0x80, 0x2b,
+  0x02, 0x00, 0x85, 0x05, 0x06, 0x19, 0x07, 0x32, 0x26, 0x0c, 0x00, 0x81, 0x03, 0x04, 0x18, 0x00,
+  0x80, 0x37, 0x01, 0x01, 0x81, 0x13, 0x09, 0x04, 0x00, 0x81, 0x46, 0x1a, 0x01, 0x01, 0x80, 0x37,
+  0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a,
+  0x10, 0x00, 0x80, 0x1b, 0x01, 0x01, 0x81, 0x28, 0x13, 0x01, 0x01, 0x80, 0x0c, 0x06, 0x00, 0x80,
+  0x16, 0x05, 0x01, 0x80, 0x0e, 0x06, 0x00, 0x80, 0x11, 0x05, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82,
+  0x08, 0x02, 0x05, 0x03, 0x00, 0x81, 0x0f, 0x3d, 0x01, 0x02, 0x83, 0x59, 0x30, 0x04, 0x06, 0x02,
+  0x00, 0x81, 0x03, 0x3f, 0x10, 0x00, 0x81, 0x03, 0x04, 0x18, 0x00, 0x80, 0x0a, 0x01, 0x01, 0x80,
+  0x28, 0x06, 0x00, 0x80, 0x49, 0x01, 0x15, 0x80, 0x3a, 0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80,
+  0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x10, 0x00, 0x80, 0x3c, 0x01, 0x01, 0x81,
+  0x40, 0x18, 0x01, 0x01, 0x80, 0x50, 0x06, 0x00, 0x80, 0x16, 0x02, 0x01, 0x80, 0x41, 0x01, 0x01,
+  0x80, 0x18, 0x06, 0x00, 0x80, 0x14, 0x01, 0x01, 0x80, 0x41, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00,
+  0x82, 0x08, 0x02, 0x05, 0x04, 0x00, 0x80, 0x58, 0x02, 0x02, 0x83, 0x04, 0x5a, 0x06, 0x2c, 0x01,
+  0x00, 0x81, 0x25, 0x19, 0x01, 0x00, 0x84, 0x21, 0x17, 0x12, 0x30, 0x43, 0x09, 0x00, 0x81, 0x03,
+  0x04, 0x18, 0x00, 0x80, 0x4a, 0x02, 0x01, 0x80, 0x2d, 0x10, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80,
+  0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x0f, 0x00, 0x80, 0x2f, 0x01, 0x01, 0x82,
+  0x13, 0x09, 0x2f, 0x01, 0x01, 0x81, 0x13, 0x46, 0x05, 0x00, 0x80, 0x16, 0x02, 0x01, 0x81, 0x2a,
+  0x13, 0x01, 0x01, 0x80, 0x4c, 0x04, 0x00, 0x84, 0x34, 0x13, 0x01, 0x4e, 0x2a, 0x02, 0x01, 0x80,
+  0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x05, 0x00, 0x81, 0x19, 0x3d, 0x02, 0x02, 0x87, 0x03,
+  0x54, 0x03, 0x00, 0x12, 0x08, 0x00, 0x1e, 0x03, 0x02, 0x80, 0x21, 0x09, 0x00, 0x81, 0x03, 0x04,
+  0x18, 0x00, 0x81, 0x34, 0x4f, 0x02, 0x01, 0x82, 0x3c, 0x2e, 0x46, 0x0d, 0x00, 0x80, 0x18, 0x01,
+  0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x0f, 0x00, 0x80, 0x3a, 0x01,
+  0x01, 0x80, 0x37, 0x01, 0x00, 0x80, 0x29, 0x01, 0x01, 0x80, 0x10, 0x05, 0x00, 0x80, 0x16, 0x02,
+  0x01, 0x81, 0x2f, 0x50, 0x01, 0x01, 0x80, 0x20, 0x04, 0x00, 0x80, 0x4a, 0x01, 0x01, 0x81, 0x20,
+  0x4b, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x06, 0x00, 0x8c, 0x05, 0x43,
+  0x19, 0x21, 0x2b, 0x0f, 0x04, 0x08, 0x02, 0x00, 0x08, 0x04, 0x12, 0x01, 0x02, 0x80, 0x12, 0x0a,
+  0x00, 0x81, 0x03, 0x04, 0x19, 0x00, 0x81, 0x0c, 0x29, 0x04, 0x01, 0x82, 0x1d, 0x31, 0x0c, 0x0a,
+  0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x02, 0x01, 0x07, 0x13, 0x80,
+  0x0c, 0x05, 0x00, 0x80, 0x4c, 0x02, 0x01, 0x80, 0x0e, 0x01, 0x00, 0x80, 0x2d, 0x01, 0x01, 0x81,
+  0x1a, 0x0d, 0x04, 0x00, 0x80, 0x16, 0x02, 0x01, 0x81, 0x2a, 0x4c, 0x01, 0x01, 0x81, 0x4e, 0x09,
+  0x02, 0x00, 0x81, 0x16, 0x1a, 0x01, 0x01, 0x81, 0x33, 0x24, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00,
+  0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x85, 0x19, 0x06, 0x12, 0x05, 0x3f, 0x2c, 0x01, 0x02, 0x81,
+  0x17, 0x0f, 0x0a, 0x00, 0x81, 0x03, 0x04, 0x1a, 0x00, 0x82, 0x0d, 0x2d, 0x29, 0x05, 0x01, 0x81,
+  0x0a, 0x0e, 0x08, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x0a, 0x01,
+  0x80, 0x0c, 0x05, 0x00, 0x80, 0x50, 0x01, 0x01, 0x80, 0x23, 0x02, 0x00, 0x81, 0x16, 0x1a, 0x01,
+  0x01, 0x80, 0x53, 0x04, 0x00, 0x80, 0x16, 0x02, 0x01, 0x82, 0x1b, 0x00, 0x41, 0x01, 0x01, 0x80,
+  0x31, 0x02, 0x00, 0x80, 0x48, 0x01, 0x01, 0x82, 0x18, 0x00, 0x2e, 0x02, 0x01, 0x80, 0x0d, 0x02,
+  0x00, 0x82, 0x08, 0x02, 0x05, 0x0c, 0x00, 0x87, 0x05, 0x04, 0x17, 0x30, 0x08, 0x0f, 0x08, 0x0f,
+  0x0c, 0x00, 0x81, 0x03, 0x04, 0x1d, 0x00, 0x82, 0x0c, 0x31, 0x1d, 0x04, 0x01, 0x80, 0x10, 0x07,
+  0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x29, 0x07,
+  0x1b, 0x80, 0x09, 0x04, 0x00, 0x81, 0x09, 0x13, 0x01, 0x01, 0x80, 0x2e, 0x03, 0x00, 0x80, 0x20,
+  0x01, 0x01, 0x80, 0x15, 0x04, 0x00, 0x80, 0x16, 0x02, 0x01, 0x82, 0x2d, 0x00, 0x2f, 0x01, 0x01,
+  0x80, 0x28, 0x02, 0x00, 0x80, 0x15, 0x01, 0x01, 0x82, 0x0e, 0x00, 0x2d, 0x02, 0x01, 0x80, 0x0d,
+  0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0d, 0x00, 0x82, 0x27, 0x02, 0x07, 0x10, 0x00, 0x81, 0x03,
+  0x04, 0x20, 0x00, 0x82, 0x09, 0x2d, 0x15, 0x02, 0x01, 0x80, 0x2a, 0x06, 0x00, 0x80, 0x18, 0x01,
+  0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x0d, 0x00, 0x80, 0x31, 0x02,
+  0x01, 0x80, 0x2d, 0x03, 0x2e, 0x80, 0x3e, 0x02, 0x01, 0x80, 0x36, 0x03, 0x00, 0x80, 0x16, 0x02,
+  0x01, 0x80, 0x40, 0x01, 0x00, 0x80, 0x1d, 0x01, 0x01, 0x82, 0x1b, 0x00, 0x2a, 0x01, 0x01, 0x80,
+  0x0a, 0x01, 0x00, 0x80, 0x31, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0d,
+  0x00, 0x82, 0x21, 0x02, 0x45, 0x10, 0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x80, 0x16, 0x02, 0x33,
+  0x06, 0x00, 0x81, 0x34, 0x28, 0x01, 0x01, 0x80, 0x0a, 0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80,
+  0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x0c, 0x00, 0x81, 0x0d, 0x28, 0x0b, 0x01,
+  0x80, 0x1d, 0x03, 0x00, 0x80, 0x16, 0x02, 0x01, 0x80, 0x10, 0x01, 0x00, 0x80, 0x2a, 0x01, 0x01,
+  0x82, 0x23, 0x00, 0x1d, 0x01, 0x01, 0x80, 0x36, 0x01, 0x00, 0x80, 0x10, 0x02, 0x01, 0x80, 0x0d,
+  0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0d, 0x00, 0x81, 0x26, 0x12, 0x11, 0x00, 0x81, 0x03, 0x04,
+  0x17, 0x00, 0x80, 0x2a, 0x02, 0x01, 0x80, 0x0e, 0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x28,
+  0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x0a,
+  0x0c, 0x00, 0x80, 0x2e, 0x0d, 0x01, 0x80, 0x11, 0x02, 0x00, 0x80, 0x16, 0x02, 0x01, 0x80, 0x10,
+  0x02, 0x00, 0x80, 0x15, 0x01, 0x01, 0x80, 0x31, 0x01, 0x01, 0x80, 0x29, 0x02, 0x00, 0x80, 0x10,
+  0x02, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x0d, 0x00, 0x81, 0x22, 0x0b, 0x11,
+  0x00, 0x81, 0x03, 0x04, 0x17, 0x00, 0x81, 0x46, 0x4e, 0x01, 0x01, 0x80, 0x18, 0x05, 0x00, 0x81,
+  0x0d, 0x15, 0x01, 0x01, 0x80, 0x3c, 0x06, 0x00, 0x80, 0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00,
+  0x80, 0x23, 0x01, 0x01, 0x80, 0x0a, 0x0c, 0x00, 0x80, 0x29, 0x01, 0x01, 0x80, 0x0a, 0x07, 0x09,
+  0x80, 0x28, 0x01, 0x01, 0x80, 0x14, 0x02, 0x00, 0x80, 0x16, 0x02, 0x01, 0x80, 0x10, 0x02, 0x00,
+  0x80, 0x2d, 0x04, 0x01, 0x80, 0x2e, 0x02, 0x00, 0x80, 0x10, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00,
+  0x82, 0x08, 0x02, 0x05, 0x21, 0x00, 0x81, 0x03, 0x04, 0x18, 0x00, 0x80, 0x40, 0x02, 0x01, 0x86,
+  0x3c, 0x2e, 0x1c, 0x34, 0x0c, 0x24, 0x3c, 0x02, 0x01, 0x80, 0x53, 0x06, 0x00, 0x80, 0x18, 0x01,
+  0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x01, 0x01, 0x80, 0x29, 0x08, 0x36, 0x80, 0x1c, 0x01,
+  0x00, 0x80, 0x4b, 0x02, 0x01, 0x80, 0x2a, 0x07, 0x00, 0x80, 0x10, 0x02, 0x01, 0x80, 0x33, 0x01,
+  0x00, 0x80, 0x16, 0x02, 0x01, 0x80, 0x10, 0x02, 0x00, 0x81, 0x0d, 0x1a, 0x02, 0x01, 0x81, 0x28,
+  0x0d, 0x02, 0x00, 0x80, 0x10, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x21,
+  0x00, 0x81, 0x03, 0x04, 0x19, 0x00, 0x81, 0x40, 0x13, 0x09, 0x01, 0x80, 0x20, 0x07, 0x00, 0x80,
+  0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x0b, 0x01, 0x80, 0x44, 0x01, 0x00, 0x80,
+  0x0a, 0x01, 0x01, 0x80, 0x28, 0x08, 0x00, 0x81, 0x34, 0x13, 0x01, 0x01, 0x80, 0x3e, 0x01, 0x00,
+  0x80, 0x16, 0x02, 0x01, 0x80, 0x10, 0x03, 0x00, 0x80, 0x10, 0x02, 0x01, 0x80, 0x40, 0x03, 0x00,
+  0x80, 0x10, 0x02, 0x01, 0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x05, 0x21, 0x00, 0x81, 0x03,
+  0x04, 0x1a, 0x00, 0x82, 0x34, 0x3e, 0x57, 0x04, 0x01, 0x82, 0x13, 0x41, 0x2f, 0x08, 0x00, 0x80,
+  0x18, 0x01, 0x01, 0x80, 0x15, 0x07, 0x00, 0x80, 0x23, 0x0b, 0x01, 0x82, 0x44, 0x00, 0x1c, 0x02,
+  0x01, 0x80, 0x31, 0x09, 0x00, 0x80, 0x18, 0x01, 0x01, 0x83, 0x52, 0x09, 0x00, 0x16, 0x02, 0x01,
+  0x80, 0x10, 0x03, 0x00, 0x84, 0x09, 0x13, 0x01, 0x52, 0x09, 0x03, 0x00, 0x80, 0x10, 0x02, 0x01,
+  0x80, 0x0d, 0x02, 0x00, 0x82, 0x08, 0x02, 0x25, 0x21, 0x07, 0x81, 0x30, 0x04, 0x1d, 0x00, 0x81,
+  0x46, 0x11, 0x01, 0x2f, 0x80, 0x0c, 0x0b, 0x00, 0x80, 0x0d, 0x01, 0x09, 0x80, 0x16, 0x07, 0x00,
+  0x0c, 0x09, 0x80, 0x16, 0x01, 0x00, 0x02, 0x09, 0x0a, 0x00, 0x80, 0x0d, 0x02, 0x09, 0x02, 0x00,
+  0x02, 0x09, 0x80, 0x0d, 0x04, 0x00, 0x82, 0x16, 0x09, 0x16, 0x04, 0x00, 0x80, 0x0d, 0x02, 0x09,
+  0x03, 0x00, 0x80, 0x45, 0x24, 0x0b, 0x80, 0x3b, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x81, 0x26, 0x22, 0x7f, 0x00, 0x1d, 0x00, 0x81,
+  0x07, 0x32, 0x53, 0x00, 0x8a, 0x17, 0x35, 0x00, 0x0f, 0x12, 0x05, 0x00, 0x2b, 0x30, 0x39, 0x38,
+  0x01, 0x00, 0x81, 0x21, 0x07, 0x01, 0x00, 0x83, 0x32, 0x21, 0x07, 0x03, 0x01, 0x00, 0x81, 0x3f,
+  0x39, 0x01, 0x00, 0x81, 0x12, 0x0f, 0x02, 0x00, 0x81, 0x12, 0x19, 0x01, 0x06, 0x80, 0x19, 0x01,
+  0x00, 0x84, 0x47, 0x07, 0x04, 0x06, 0x1e, 0x01, 0x00, 0x84, 0x12, 0x0f, 0x00, 0x1f, 0x12, 0x01,
+  0x00, 0x84, 0x22, 0x0b, 0x00, 0x1f, 0x38, 0x01, 0x06, 0x80, 0x03, 0x01, 0x00, 0x8a, 0x17, 0x32,
+  0x06, 0x4d, 0x05, 0x27, 0x04, 0x06, 0x19, 0x00, 0x38, 0x01, 0x04, 0x80, 0x38, 0x01, 0x00, 0x83,
+  0x07, 0x04, 0x06, 0x5b, 0x01, 0x00, 0x8f, 0x2b, 0x3f, 0x04, 0x12, 0x22, 0x00, 0x05, 0x06, 0x19,
+  0x06, 0x04, 0x19, 0x03, 0x06, 0x04, 0x2c, 0x05, 0x00, 0x84, 0x58, 0x06, 0x04, 0x25, 0x05, 0x01,
+  0x00, 0x83, 0x07, 0x04, 0x06, 0x1e, 0x01, 0x00, 0x89, 0x21, 0x3b, 0x38, 0x04, 0x54, 0x08, 0x27,
+  0x3d, 0x12, 0x2b, 0x1d, 0x00, 0x8e, 0x25, 0x19, 0x00, 0x21, 0x02, 0x03, 0x00, 0x19, 0x07, 0x05,
+  0x02, 0x05, 0x00, 0x17, 0x04, 0x01, 0x00, 0x8a, 0x06, 0x08, 0x21, 0x0b, 0x00, 0x35, 0x02, 0x07,
+  0x00, 0x39, 0x12, 0x03, 0x00, 0xab, 0x02, 0x2c, 0x05, 0x2b, 0x04, 0x22, 0x00, 0x07, 0x30, 0x05,
+  0x0f, 0x17, 0x19, 0x00, 0x38, 0x03, 0x00, 0x19, 0x02, 0x22, 0x00, 0x2c, 0x1e, 0x00, 0x54, 0x19,
+  0x00, 0x08, 0x02, 0x0f, 0x00, 0x04, 0x0b, 0x08, 0x05, 0x1e, 0x0b, 0x00, 0x45, 0x04, 0x39, 0x00,
+  0x07, 0x32, 0x01, 0x00, 0x97, 0x07, 0x0b, 0x47, 0x1f, 0x04, 0x08, 0x00, 0x04, 0x26, 0x00, 0x26,
+  0x04, 0x00, 0x42, 0x02, 0x19, 0x47, 0x22, 0x02, 0x25, 0x05, 0x1f, 0x04, 0x2b, 0x03, 0x00, 0x97,
+  0x26, 0x06, 0x1f, 0x00, 0x25, 0x3b, 0x00, 0x07, 0x30, 0x05, 0x0f, 0x17, 0x19, 0x00, 0x1e, 0x06,
+  0x35, 0x47, 0x27, 0x02, 0x22, 0x00, 0x51, 0x17, 0x1d, 0x00, 0x9b, 0x43, 0x30, 0x00, 0x38, 0x1e,
+  0x27, 0x00, 0x30, 0x4d, 0x00, 0x30, 0x26, 0x0f, 0x12, 0x0b, 0x22, 0x0f, 0x04, 0x00, 0x0f, 0x04,
+  0x00, 0x19, 0x32, 0x06, 0x00, 0x1e, 0x32, 0x03, 0x00, 0x81, 0x02, 0x1f, 0x01, 0x00, 0x84, 0x2c,
+  0x07, 0x00, 0x02, 0x08, 0x01, 0x00, 0x8b, 0x22, 0x06, 0x00, 0x21, 0x25, 0x00, 0x17, 0x1e, 0x07,
+  0x00, 0x12, 0x2b, 0x02, 0x00, 0x86, 0x1f, 0x08, 0x04, 0x2b, 0x00, 0x04, 0x08, 0x01, 0x00, 0x88,
+  0x51, 0x17, 0x35, 0x00, 0x0f, 0x05, 0x00, 0x07, 0x32, 0x01, 0x00, 0x81, 0x3d, 0x22, 0x01, 0x0f,
+  0x81, 0x27, 0x51, 0x01, 0x00, 0x87, 0x05, 0x1f, 0x39, 0x02, 0x0f, 0x42, 0x02, 0x05, 0x01, 0x00,
+  0x81, 0x04, 0x2b, 0x01, 0x00, 0x81, 0x17, 0x03, 0x03, 0x00, 0x81, 0x0b, 0x19, 0x01, 0x00, 0x84,
+  0x0f, 0x03, 0x00, 0x3d, 0x08, 0x01, 0x00, 0x84, 0x22, 0x06, 0x00, 0x1e, 0x25, 0x01, 0x00, 0x81,
+  0x03, 0x12, 0x01, 0x00, 0x81, 0x08, 0x3d, 0x1d, 0x00, 0x91, 0x05, 0x04, 0x42, 0x06, 0x47, 0x06,
+  0x05, 0x04, 0x05, 0x00, 0x21, 0x3b, 0x21, 0x1e, 0x03, 0x07, 0x03, 0x25, 0x01, 0x00, 0x87, 0x12,
+  0x2b, 0x17, 0x1f, 0x30, 0x08, 0x3f, 0x39, 0x03, 0x00, 0x81, 0x02, 0x1f, 0x01, 0x00, 0x84, 0x19,
+  0x0b, 0x42, 0x02, 0x05, 0x01, 0x00, 0x8a, 0x1f, 0x02, 0x00, 0x45, 0x06, 0x0f, 0x12, 0x05, 0x06,
+  0x42, 0x04, 0x01, 0x00, 0x88, 0x03, 0x06, 0x27, 0x07, 0x3d, 0x39, 0x00, 0x04, 0x08, 0x02, 0x00,
+  0x80, 0x19, 0x01, 0x12, 0x80, 0x21, 0x01, 0x00, 0x84, 0x07, 0x32, 0x00, 0x0f, 0x02, 0x03, 0x06,
+  0x8a, 0x1e, 0x00, 0x19, 0x12, 0x25, 0x3b, 0x02, 0x0f, 0x42, 0x02, 0x05, 0x01, 0x00, 0x81, 0x04,
+  0x08, 0x01, 0x00, 0x81, 0x3f, 0x03, 0x03, 0x00, 0x81, 0x17, 0x03, 0x03, 0x00, 0x82, 0x05, 0x02,
+  0x05, 0x01, 0x00, 0x84, 0x45, 0x02, 0x00, 0x1e, 0x25, 0x01, 0x00, 0x81, 0x43, 0x17, 0x01, 0x00,
+  0x81, 0x35, 0x02, 0x1e, 0x00, 0x80, 0x17, 0x01, 0x07, 0x83, 0x00, 0x27, 0x32, 0x30, 0x01, 0x00,
+  0x87, 0x1f, 0x06, 0x30, 0x08, 0x05, 0x06, 0x25, 0x26, 0x01, 0x00, 0x86, 0x1e, 0x07, 0x12, 0x00,
+  0x21, 0x2c, 0x04, 0x04, 0x00, 0x81, 0x02, 0x1f, 0x01, 0x00, 0x84, 0x2c, 0x07, 0x00, 0x02, 0x35,
+  0x01, 0x00, 0x81, 0x22, 0x55, 0x01, 0x00, 0x86, 0x12, 0x07, 0x1e, 0x00, 0x30, 0x32, 0x25, 0x01,
+  0x00, 0x81, 0x3d, 0x35, 0x01, 0x00, 0x84, 0x06, 0x39, 0x00, 0x04, 0x08, 0x01, 0x00, 0x88, 0x1f,
+  0x05, 0x00, 0x08, 0x06, 0x03, 0x00, 0x07, 0x32, 0x01, 0x00, 0x81, 0x02, 0x1f, 0x03, 0x00, 0x89,
+  0x0f, 0x02, 0x05, 0x00, 0x05, 0x02, 0x0f, 0x42, 0x02, 0x05, 0x01, 0x00, 0x81, 0x04, 0x08, 0x01,
+  0x00, 0x81, 0x3f, 0x03, 0x03, 0x00, 0x81, 0x27, 0x19, 0x01, 0x00, 0x84, 0x05, 0x2b, 0x00, 0x3d,
+  0x35, 0x01, 0x00, 0x84, 0x39, 0x04, 0x00, 0x1e, 0x25, 0x01, 0x00, 0x81, 0x43, 0x17, 0x01, 0x00,
+  0x81, 0x35, 0x02, 0x1e, 0x00, 0x86, 0x19, 0x02, 0x22, 0x00, 0x26, 0x02, 0x21, 0x02, 0x00, 0x01,
+  0x06, 0x01, 0x00, 0x82, 0x30, 0x3d, 0x05, 0x01, 0x00, 0x89, 0x39, 0x02, 0x1e, 0x00, 0x0f, 0x02,
+  0x27, 0x00, 0x05, 0x4d, 0x01, 0x00, 0x88, 0x02, 0x1e, 0x00, 0x1f, 0x04, 0x22, 0x00, 0x07, 0x38,
+  0x01, 0x05, 0x81, 0x3f, 0x1e, 0x01, 0x00, 0x86, 0x2c, 0x02, 0x08, 0x00, 0x21, 0x02, 0x43, 0x01,
+  0x00, 0x88, 0x3d, 0x43, 0x05, 0x21, 0x02, 0x22, 0x00, 0x04, 0x08, 0x01, 0x00, 0x88, 0x38, 0x07,
+  0x00, 0x05, 0x12, 0x03, 0x00, 0x32, 0x27, 0x01, 0x00, 0x81, 0x3b, 0x0b, 0x01, 0x05, 0x8b, 0x1e,
+  0x2b, 0x45, 0x02, 0x2b, 0x05, 0x1e, 0x02, 0x45, 0x42, 0x02, 0x05, 0x01, 0x00, 0x81, 0x04, 0x08,
+  0x01, 0x00, 0x8e, 0x3f, 0x03, 0x00, 0x2b, 0x0f, 0x00, 0x26, 0x06, 0x0f, 0x00, 0x2c, 0x27, 0x00,
+  0x2c, 0x38, 0x01, 0x05, 0x84, 0x3f, 0x32, 0x00, 0x1e, 0x25, 0x01, 0x00, 0x81, 0x43, 0x17, 0x01,
+  0x00, 0x81, 0x35, 0x02, 0x1e, 0x00, 0x81, 0x35, 0x12, 0x01, 0x00, 0x82, 0x05, 0x12, 0x45, 0x02,
+  0x00, 0x01, 0x1e, 0x01, 0x00, 0x81, 0x03, 0x27, 0x03, 0x00, 0x81, 0x12, 0x08, 0x01, 0x00, 0x84,
+  0x0b, 0x26, 0x00, 0x08, 0x12, 0x01, 0x00, 0x84, 0x02, 0x07, 0x06, 0x04, 0x19, 0x01, 0x00, 0x84,
+  0x47, 0x07, 0x06, 0x04, 0x2c, 0x02, 0x00, 0x81, 0x39, 0x17, 0x01, 0x00, 0x82, 0x0f, 0x12, 0x05,
+  0x01, 0x00, 0x88, 0x26, 0x06, 0x04, 0x07, 0x30, 0x03, 0x00, 0x17, 0x35, 0x01, 0x00, 0x81, 0x0f,
+  0x38, 0x01, 0x04, 0x80, 0x2c, 0x01, 0x00, 0x85, 0x08, 0x06, 0x17, 0x00, 0x05, 0x07, 0x01, 0x04,
+  0x83, 0x3b, 0x47, 0x00, 0x21, 0x01, 0x04, 0x85, 0x51, 0x12, 0x2b, 0x05, 0x06, 0x05, 0x01, 0x00,
+  0x81, 0x17, 0x35, 0x01, 0x00, 0x84, 0x27, 0x26, 0x00, 0x27, 0x21, 0x01, 0x00, 0x84, 0x21, 0x06,
+  0x04, 0x27, 0x05, 0x01, 0x00, 0x83, 0x2c, 0x06, 0x04, 0x2c, 0x01, 0x00, 0x81, 0x21, 0x32, 0x01,
+  0x00, 0x81, 0x4d, 0x0b, 0x01, 0x00, 0x81, 0x1f, 0x12, 0x3d, 0x00, 0x81, 0x02, 0x1f, 0x7f, 0x00,
+  0x1d, 0x00, 0x81, 0x02, 0x1f, 0x7f, 0x00, 0x1d, 0x00, 0x81, 0x19, 0x05, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x6e, 0x00,
+};
+
+static const Rle565Image POWAR_logo_WEB_RLE = {
+    160, 128, 92,
+    POWAR_logo_WEB_PALETTE,
+    POWAR_logo_WEB_DATA,
+    sizeof(POWAR_logo_WEB_DATA)
+};
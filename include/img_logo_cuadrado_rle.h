@@ -0,0 +1,199 @@
+#pragma once
+
+// Generated by tools/rle565_encode.py, do not edit.
+// 160x128, 41 colours, 2759 bytes of stream (40960 bytes raw).
+
+#include "rle565.h"
+
+#define PBIT_TFT_160X128_2_HEIGHT 128
+#define PBIT_TFT_160X128_2_WIDTH 160
+
+static const uint16_t PBIT_TFT_160x128_2_PALETTE[] PROGMEM = {
+  0xffff, 0x7f55, 0x3f86, 0xbfa6, 0x7f96, 0x9fe7, 0x7fdf, 0x9f5d, 0xffb6, 0x9f55, 0xdff7, 0x9f9e,
+  0xbfef, 0xbf5d, 0xdf65, 0x1f7e, 0x1fbf, 0x7fd7, 0x5f8e, 0x1f76, 0x3fcf, 0x5fd7, 0xdfae, 0xff6d,
+  0xdf6d, 0xffbe, 0x3fc7, 0xbf65, 0x5fcf, 0x9fdf, 0x1fc7, 0xbfe7, 0xff75, 0x5f86, 0x3f7e, 0xdfb6,
+  0xfff7, 0x7f8e, 0x9fa6, 0xdfef, 0xbfae,
+};
+
+static const uint8_t PBIT_TFT_160x128_2_DATA[] PROGMEM = {
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+  0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x41, 0x00, 0x80, 0x1e, 0x5b, 0x02,
+  0x80, 0x0c, 0x41, 0x00, 0x80, 0x03, 0x5b, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x5b, 0x01,
+  0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x13, 0x55, 0x08, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03,
+  0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04,
+  0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00,
+  0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01,
+  0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x2e, 0x00, 0x81, 0x0a, 0x05, 0x01, 0x06, 0x81, 0x1f, 0x24,
+  0x20, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x29, 0x00,
+  0x84, 0x0a, 0x1e, 0x04, 0x13, 0x07, 0x05, 0x01, 0x84, 0x0d, 0x0f, 0x0b, 0x14, 0x0a, 0x1b, 0x00,
+  0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x27, 0x00, 0x82, 0x10,
+  0x0f, 0x09, 0x0d, 0x01, 0x82, 0x09, 0x12, 0x14, 0x19, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x82, 0x0a, 0x16, 0x0d, 0x13, 0x01, 0x81, 0x18,
+  0x10, 0x17, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x23,
+  0x00, 0x81, 0x10, 0x1b, 0x17, 0x01, 0x81, 0x17, 0x11, 0x15, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41,
+  0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x81, 0x0c, 0x02, 0x1b, 0x01, 0x80, 0x0b,
+  0x14, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00,
+  0x81, 0x11, 0x0d, 0x1d, 0x01, 0x81, 0x13, 0x0c, 0x12, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1f, 0x00, 0x81, 0x1e, 0x09, 0x0b, 0x01, 0x81, 0x1b, 0x02,
+  0x02, 0x04, 0x82, 0x25, 0x13, 0x0d, 0x0b, 0x01, 0x81, 0x0e, 0x05, 0x11, 0x00, 0x02, 0x01, 0x80,
+  0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1e, 0x00, 0x81, 0x10, 0x09, 0x08, 0x01,
+  0x83, 0x09, 0x02, 0x1a, 0x27, 0x07, 0x00, 0x82, 0x05, 0x16, 0x17, 0x09, 0x01, 0x81, 0x0d, 0x05,
+  0x10, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1d, 0x00,
+  0x81, 0x14, 0x09, 0x07, 0x01, 0x82, 0x09, 0x03, 0x0c, 0x0d, 0x00, 0x81, 0x06, 0x0f, 0x08, 0x01,
+  0x81, 0x0e, 0x0c, 0x0f, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x1c, 0x00, 0x81, 0x1d, 0x07, 0x07, 0x01, 0x81, 0x21, 0x1f, 0x05, 0x00, 0x86, 0x11, 0x08,
+  0x03, 0x0b, 0x03, 0x19, 0x11, 0x04, 0x00, 0x81, 0x1c, 0x18, 0x07, 0x01, 0x80, 0x13, 0x0f, 0x00,
+  0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1c, 0x00, 0x80, 0x17,
+  0x06, 0x01, 0x81, 0x09, 0x08, 0x04, 0x00, 0x82, 0x1c, 0x21, 0x09, 0x06, 0x01, 0x82, 0x0d, 0x04,
+  0x0c, 0x02, 0x00, 0x81, 0x0a, 0x21, 0x07, 0x01, 0x80, 0x0b, 0x0e, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1b, 0x00, 0x80, 0x08, 0x06, 0x01, 0x81, 0x0d,
+  0x1c, 0x03, 0x00, 0x81, 0x11, 0x17, 0x0b, 0x01, 0x81, 0x09, 0x03, 0x03, 0x00, 0x80, 0x03, 0x06,
+  0x01, 0x81, 0x09, 0x11, 0x0d, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x1c, 0x00, 0x82, 0x06, 0x04, 0x09, 0x02, 0x01, 0x81, 0x09, 0x15, 0x03, 0x00, 0x80,
+  0x0b, 0x0f, 0x01, 0x81, 0x13, 0x0c, 0x02, 0x00, 0x80, 0x03, 0x06, 0x01, 0x80, 0x17, 0x0d, 0x00,
+  0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x1e, 0x00, 0x84, 0x27,
+  0x16, 0x1b, 0x01, 0x19, 0x02, 0x00, 0x81, 0x0a, 0x02, 0x04, 0x01, 0x88, 0x0f, 0x08, 0x1d, 0x0a,
+  0x00, 0x0a, 0x1d, 0x16, 0x17, 0x03, 0x01, 0x81, 0x0e, 0x0c, 0x02, 0x00, 0x80, 0x04, 0x06, 0x01,
+  0x80, 0x10, 0x0c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04,
+  0x21, 0x00, 0x80, 0x15, 0x03, 0x00, 0x80, 0x22, 0x03, 0x01, 0x81, 0x02, 0x05, 0x08, 0x00, 0x81,
+  0x19, 0x07, 0x02, 0x01, 0x81, 0x20, 0x0a, 0x02, 0x00, 0x80, 0x17, 0x05, 0x01, 0x80, 0x0e, 0x0c,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x25, 0x00, 0x80,
+  0x03, 0x02, 0x01, 0x81, 0x09, 0x19, 0x0b, 0x00, 0x81, 0x05, 0x0e, 0x02, 0x01, 0x80, 0x04, 0x02,
+  0x00, 0x80, 0x11, 0x06, 0x01, 0x80, 0x1a, 0x0b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x25, 0x00, 0x81, 0x05, 0x04, 0x01, 0x09, 0x80, 0x14, 0x05, 0x00,
+  0x82, 0x0a, 0x0c, 0x0a, 0x04, 0x00, 0x81, 0x05, 0x0d, 0x02, 0x01, 0x80, 0x11, 0x02, 0x00, 0x80,
+  0x04, 0x05, 0x01, 0x80, 0x02, 0x0b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x27, 0x00, 0x81, 0x0a, 0x15, 0x04, 0x00, 0x81, 0x1a, 0x20, 0x02, 0x01, 0x81,
+  0x0f, 0x1c, 0x03, 0x00, 0x80, 0x14, 0x02, 0x01, 0x80, 0x13, 0x02, 0x00, 0x80, 0x05, 0x05, 0x01,
+  0x81, 0x09, 0x0a, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x2d, 0x00, 0x88, 0x0b, 0x01, 0x18, 0x28, 0x10, 0x26, 0x0e, 0x01, 0x03, 0x03, 0x00, 0x80,
+  0x12, 0x02, 0x01, 0x80, 0x1d, 0x02, 0x00, 0x80, 0x0f, 0x05, 0x01, 0x80, 0x10, 0x0a, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x2c, 0x00, 0x82, 0x0c, 0x18,
+  0x04, 0x04, 0x00, 0x82, 0x04, 0x01, 0x10, 0x02, 0x00, 0x80, 0x06, 0x02, 0x01, 0x80, 0x0b, 0x02,
+  0x00, 0x80, 0x1e, 0x05, 0x01, 0x80, 0x04, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x35, 0x00, 0x81, 0x13, 0x1b, 0x03, 0x00, 0x80, 0x20, 0x01, 0x01,
+  0x80, 0x17, 0x02, 0x00, 0x80, 0x0c, 0x05, 0x01, 0x80, 0x17, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x35, 0x00, 0x82, 0x10, 0x01, 0x06, 0x02, 0x00,
+  0x80, 0x0b, 0x01, 0x01, 0x81, 0x09, 0x0a, 0x02, 0x00, 0x80, 0x0e, 0x04, 0x01, 0x80, 0x09, 0x0a,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x81,
+  0x16, 0x1e, 0x0c, 0x00, 0x81, 0x0a, 0x0c, 0x02, 0x00, 0x82, 0x15, 0x01, 0x1a, 0x02, 0x00, 0x80,
+  0x10, 0x02, 0x01, 0x80, 0x1d, 0x02, 0x00, 0x80, 0x12, 0x05, 0x01, 0x80, 0x1f, 0x09, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x84, 0x0d, 0x01,
+  0x1b, 0x03, 0x0a, 0x08, 0x00, 0x82, 0x0a, 0x18, 0x0b, 0x02, 0x00, 0x82, 0x0c, 0x12, 0x06, 0x02,
+  0x00, 0x80, 0x14, 0x02, 0x01, 0x80, 0x06, 0x02, 0x00, 0x80, 0x0b, 0x05, 0x01, 0x80, 0x06, 0x09,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80,
+  0x15, 0x03, 0x01, 0x82, 0x09, 0x04, 0x05, 0x06, 0x00, 0x82, 0x04, 0x01, 0x26, 0x08, 0x00, 0x80,
+  0x10, 0x02, 0x01, 0x80, 0x11, 0x02, 0x00, 0x80, 0x03, 0x05, 0x01, 0x80, 0x15, 0x09, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x16, 0x06,
+  0x01, 0x81, 0x0f, 0x14, 0x03, 0x00, 0x80, 0x1d, 0x01, 0x01, 0x80, 0x1e, 0x08, 0x00, 0x81, 0x15,
+  0x0e, 0x01, 0x01, 0x80, 0x0c, 0x02, 0x00, 0x80, 0x16, 0x05, 0x01, 0x80, 0x1c, 0x09, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x0b, 0x08,
+  0x01, 0x84, 0x18, 0x08, 0x24, 0x00, 0x12, 0x01, 0x01, 0x80, 0x0c, 0x0a, 0x00, 0x81, 0x1a, 0x02,
+  0x03, 0x00, 0x80, 0x03, 0x05, 0x01, 0x80, 0x15, 0x09, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x21, 0x0a, 0x01, 0x84, 0x0d, 0x0b, 0x09,
+  0x01, 0x13, 0x11, 0x00, 0x80, 0x25, 0x05, 0x01, 0x80, 0x06, 0x09, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x12, 0x0e, 0x01, 0x80, 0x03,
+  0x11, 0x00, 0x80, 0x0f, 0x05, 0x01, 0x80, 0x0a, 0x09, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x0b, 0x0f, 0x01, 0x81, 0x20, 0x10, 0x0f,
+  0x00, 0x82, 0x15, 0x02, 0x09, 0x02, 0x01, 0x80, 0x07, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41,
+  0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x16, 0x11, 0x01, 0x82, 0x0e, 0x23,
+  0x0a, 0x0e, 0x00, 0x84, 0x1f, 0x03, 0x0d, 0x01, 0x0f, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41,
+  0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x20, 0x00, 0x80, 0x06, 0x13, 0x01, 0x82, 0x07, 0x04,
+  0x05, 0x0e, 0x00, 0x82, 0x0a, 0x16, 0x08, 0x0a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x80, 0x0d, 0x14, 0x01, 0x82, 0x09, 0x22, 0x14, 0x1a,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x80,
+  0x0b, 0x17, 0x01, 0x81, 0x20, 0x1c, 0x18, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03,
+  0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x81, 0x0c, 0x09, 0x17, 0x01, 0x80, 0x1c, 0x18, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x22, 0x00, 0x80, 0x03, 0x16,
+  0x01, 0x80, 0x02, 0x19, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x23, 0x00, 0x80, 0x13, 0x14, 0x01, 0x81, 0x1b, 0x0c, 0x19, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x0b, 0x00, 0x8b, 0x0a, 0x1a, 0x0b, 0x22, 0x0e,
+  0x07, 0x01, 0x09, 0x0d, 0x13, 0x0b, 0x14, 0x0b, 0x00, 0x81, 0x0c, 0x1b, 0x12, 0x01, 0x81, 0x09,
+  0x06, 0x1a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x0a,
+  0x00, 0x81, 0x19, 0x09, 0x0a, 0x01, 0x81, 0x0e, 0x08, 0x0a, 0x00, 0x81, 0x1f, 0x18, 0x10, 0x01,
+  0x81, 0x0d, 0x15, 0x1b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x0a, 0x00, 0x80, 0x1c, 0x0d, 0x01, 0x81, 0x13, 0x0c, 0x09, 0x00, 0x81, 0x0a, 0x02, 0x0e,
+  0x01, 0x81, 0x20, 0x1f, 0x1c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x0b, 0x00, 0x80, 0x07, 0x0d, 0x01, 0x81, 0x0e, 0x05, 0x0a, 0x00, 0x81, 0x14, 0x18,
+  0x0a, 0x01, 0x81, 0x0d, 0x19, 0x1e, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x0b, 0x00, 0x80, 0x04, 0x0e, 0x01, 0x81, 0x0e, 0x0a, 0x09, 0x00, 0x84, 0x0a,
+  0x09, 0x20, 0x02, 0x18, 0x04, 0x01, 0x82, 0x1b, 0x12, 0x1a, 0x20, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x0b, 0x00, 0x80, 0x06, 0x06, 0x01, 0x81, 0x09,
+  0x0d, 0x06, 0x01, 0x80, 0x02, 0x09, 0x00, 0x80, 0x1e, 0x01, 0x01, 0x86, 0x05, 0x00, 0x0a, 0x1d,
+  0x06, 0x1d, 0x0a, 0x23, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x0c, 0x00, 0x80, 0x0f, 0x06, 0x01, 0x82, 0x18, 0x21, 0x20, 0x05, 0x01, 0x80, 0x10, 0x08,
+  0x00, 0x82, 0x12, 0x01, 0x17, 0x2a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x0c, 0x00, 0x80, 0x11, 0x08, 0x01, 0x83, 0x02, 0x1e, 0x0e, 0x09, 0x02, 0x01,
+  0x80, 0x0e, 0x08, 0x00, 0x82, 0x0d, 0x01, 0x03, 0x2a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00,
+  0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x0d, 0x00, 0x80, 0x04, 0x08, 0x01, 0x84, 0x0d, 0x14, 0x10,
+  0x0d, 0x09, 0x01, 0x01, 0x80, 0x19, 0x06, 0x00, 0x80, 0x11, 0x01, 0x01, 0x80, 0x06, 0x08, 0x00,
+  0x80, 0x0a, 0x01, 0x0c, 0x1e, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x0d, 0x00, 0x81, 0x0a, 0x0e, 0x09, 0x01, 0x82, 0x03, 0x0a, 0x02, 0x01, 0x01, 0x80,
+  0x0d, 0x06, 0x00, 0x82, 0x03, 0x01, 0x07, 0x06, 0x00, 0x82, 0x05, 0x0b, 0x0e, 0x02, 0x01, 0x83,
+  0x09, 0x17, 0x0b, 0x1c, 0x1a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x0e, 0x00, 0x81, 0x05, 0x0d, 0x09, 0x01, 0x85, 0x04, 0x00, 0x08, 0x09, 0x01, 0x02,
+  0x05, 0x00, 0x82, 0x0f, 0x01, 0x02, 0x05, 0x00, 0x81, 0x03, 0x09, 0x08, 0x01, 0x80, 0x0b, 0x19,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x0f, 0x00, 0x81,
+  0x06, 0x0d, 0x09, 0x01, 0x86, 0x02, 0x00, 0x14, 0x09, 0x01, 0x0f, 0x24, 0x03, 0x00, 0x82, 0x07,
+  0x01, 0x23, 0x04, 0x00, 0x80, 0x12, 0x0a, 0x01, 0x80, 0x11, 0x19, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x10, 0x00, 0x81, 0x0c, 0x02, 0x09, 0x01, 0x85,
+  0x12, 0x00, 0x1a, 0x09, 0x01, 0x02, 0x02, 0x00, 0x80, 0x05, 0x01, 0x01, 0x80, 0x06, 0x03, 0x00,
+  0x80, 0x03, 0x0a, 0x01, 0x80, 0x13, 0x1a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03,
+  0x01, 0x01, 0x80, 0x04, 0x12, 0x00, 0x81, 0x1a, 0x0f, 0x08, 0x01, 0x82, 0x16, 0x00, 0x08, 0x01,
+  0x01, 0x80, 0x03, 0x01, 0x00, 0x83, 0x10, 0x01, 0x09, 0x0a, 0x02, 0x00, 0x80, 0x11, 0x0b, 0x01,
+  0x80, 0x14, 0x1a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04,
+  0x14, 0x00, 0x88, 0x0c, 0x19, 0x0b, 0x12, 0x22, 0x12, 0x0b, 0x23, 0x11, 0x02, 0x00, 0x87, 0x0f,
+  0x01, 0x09, 0x11, 0x00, 0x03, 0x01, 0x18, 0x03, 0x00, 0x80, 0x20, 0x01, 0x01, 0x82, 0x0d, 0x04,
+  0x1b, 0x05, 0x01, 0x80, 0x21, 0x1b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x20, 0x00, 0x87, 0x1f, 0x07, 0x01, 0x18, 0x00, 0x12, 0x01, 0x12, 0x02, 0x00,
+  0x80, 0x15, 0x01, 0x01, 0x82, 0x02, 0x10, 0x09, 0x05, 0x01, 0x81, 0x0e, 0x0a, 0x1b, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x21, 0x00, 0x80, 0x23, 0x01,
+  0x01, 0x83, 0x0b, 0x0f, 0x01, 0x03, 0x02, 0x00, 0x84, 0x0e, 0x01, 0x03, 0x19, 0x09, 0x05, 0x01,
+  0x81, 0x0e, 0x1f, 0x1c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x22, 0x00, 0x85, 0x1b, 0x01, 0x09, 0x07, 0x01, 0x19, 0x01, 0x00, 0x84, 0x02, 0x01, 0x0b,
+  0x1a, 0x09, 0x05, 0x01, 0x81, 0x12, 0x0c, 0x1d, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x22, 0x00, 0x80, 0x16, 0x03, 0x01, 0x8d, 0x1a, 0x00, 0x02, 0x01,
+  0x04, 0x00, 0x04, 0x13, 0x0e, 0x1b, 0x17, 0x22, 0x16, 0x05, 0x1f, 0x00, 0x02, 0x01, 0x80, 0x05,
+  0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x22, 0x00, 0x81, 0x0a, 0x0d, 0x02, 0x01, 0x84,
+  0x15, 0x02, 0x01, 0x0e, 0x0a, 0x28, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x23, 0x00, 0x80, 0x04, 0x02, 0x01, 0x83, 0x0f, 0x01, 0x09, 0x11, 0x29, 0x00,
+  0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x23, 0x00, 0x80, 0x14,
+  0x04, 0x01, 0x80, 0x04, 0x2a, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01,
+  0x80, 0x04, 0x24, 0x00, 0x80, 0x07, 0x02, 0x01, 0x81, 0x09, 0x1f, 0x2a, 0x00, 0x02, 0x01, 0x80,
+  0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x80, 0x0f, 0x02, 0x01, 0x80,
+  0x04, 0x2b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24,
+  0x00, 0x80, 0x0b, 0x02, 0x01, 0x80, 0x1d, 0x2b, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x80, 0x10, 0x01, 0x01, 0x80, 0x17, 0x2c, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x80, 0x1c, 0x01,
+  0x01, 0x80, 0x0b, 0x2c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x24, 0x00, 0x80, 0x06, 0x01, 0x01, 0x80, 0x1e, 0x2c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41,
+  0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x80, 0x06, 0x01, 0x01, 0x80, 0x06, 0x2c,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x24, 0x00, 0x80,
+  0x15, 0x01, 0x01, 0x80, 0x1d, 0x2c, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x24, 0x00, 0x80, 0x0c, 0x01, 0x19, 0x80, 0x0a, 0x2c, 0x00, 0x02, 0x01, 0x80,
+  0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41,
+  0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80,
+  0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01,
+  0x01, 0x80, 0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80,
+  0x04, 0x55, 0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55,
+  0x00, 0x02, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x04, 0x55, 0x00, 0x02,
+  0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x01, 0x01, 0x80, 0x02, 0x55, 0x06, 0x02, 0x01, 0x80,
+  0x05, 0x41, 0x00, 0x80, 0x03, 0x5b, 0x01, 0x80, 0x05, 0x41, 0x00, 0x80, 0x03, 0x5b, 0x01, 0x80,
+  0x05, 0x41, 0x00, 0x80, 0x16, 0x5b, 0x07, 0x80, 0x05, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f,
+  0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f,
+  0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f,
+  0x00, 0x7f, 0x00, 0x7f, 0x00, 0x5f, 0x00,
+};
+
+static const Rle565Image PBIT_TFT_160x128_2_RLE = {
+    160, 128, 41,
+    PBIT_TFT_160x128_2_PALETTE,
+    PBIT_TFT_160x128_2_DATA,
+    sizeof(PBIT_TFT_160x128_2_DATA)
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interrupt-driven input for the rotary encoder and its push button.
+//
+// Quadrature is decoded in hardware by PCNT unit 0 (both edges of A and B,
+// glitch filtered). The counter limits are one detent, so the PCNT interrupt
+// fires once per click with its direction and the counter restarts from
+// zero; a fast spin cannot skip a detent even if the consumer is late.
+// The button has a GPIO CHANGE interrupt that timestamps every edge;
+// debounce runs on those timestamps in the consumer.
+//
+// Both ISRs are installed from the same core, so they never preempt each
+// other and act as the single producer of a lock-free ring. The consumer task
+// (the UI task) is woken with a task notification.
+
+enum class InputEventType : uint8_t {
+    Turn,      // value = +1 / -1 detent
+    Button     // value = 1 pressed, 0 released (raw level, not debounced)
+};
+
+struct InputEvent {
+    uint32_t t_us;          // low 32 bits of esp_timer_get_time() in the ISR
+    InputEventType type;
+    int8_t value;
+};
+
+// Configure PCNT and the button interrupt. Safe to call more than once.
+void input_events_begin();
+
+// Task woken by new events. nullptr while no task is waiting (boot menus poll).
+void input_events_set_consumer(TaskHandle_t task);
+
+// Block the consumer until an event arrives or the timeout expires.
+void input_events_wait(TickType_t timeout);
+
+bool input_events_pop(InputEvent& ev);
+
+// Detents that arrived while the ring was full; counted, never lost.
+int32_t input_events_take_overflow_detents();
+
+// True once after button edges were dropped on a full ring; the consumer
+// should resync from the pin level.
+bool input_events_take_button_overflow();
+
+bool input_button_pressed_now();
@@ -1,18 +1,6 @@
 #pragma once
 #include <Arduino.h>
-
-typedef struct {
-    float humidity;
-    float temperature; 
-    float ldr;
-    float ldr_raw;
-    float mic;
-
-    // --- Sensores Adicionales ---
-    float soil_humidity; 
-    float temp_ds18b20; 
-    // ----------------------------
-} Reading;
+#include "reading.h"
 
 extern Reading global_readings;
 extern volatile bool g_sensor_data_ready;
@@ -20,4 +8,10 @@ extern portMUX_TYPE readings_mux;
 extern portMUX_TYPE timerMux;
 
 void sensor_reading_task(void *param);
+
+// One blocking pass over every sensor, for wakes that run without the tasks.
+void read_sensors_once(Reading &r);
+
+// LDR ADC counts to lux (0-20000), without the EMA applied by the sensor task.
+float ldr_raw_to_lux(float ldr_raw);
 // ------------------------------------------
\ No newline at end of file
@@ -3,19 +3,52 @@
 
 // --- Core hardware helpers ---
 void init_leds_and_buzzer();
+
+// Steady LED colour. Channels that already hold the value are not written,
+// so callers may repeat it every frame. While an effect runs the colour is
+// only remembered and comes back when the effect ends.
 void set_rgb(uint8_t r, uint8_t g, uint8_t b);
 
+// --- LED effects ---
+// Frames come from a 50 Hz esp_timer that only runs while an effect does.
+enum class LedEffect : uint8_t {
+    None = 0,
+    Breathe,                    // smooth rise and fall of the colour
+    Pulse,                      // full flash, then fade out
+    Rainbow,                    // hue wheel, colour ignored
+    Blink,                      // half period on, half off
+};
+
+// repeats == 0 runs until stopped. Starting the effect that already runs
+// with the same arguments is a no-op, so it can be requested every frame.
+void led_effect_start(LedEffect effect, uint8_t r, uint8_t g, uint8_t b,
+                      uint16_t period_ms, uint8_t repeats = 0);
+// Stop `only` if it is running; LedEffect::None stops any effect.
+void led_effect_stop(LedEffect only = LedEffect::None);
+
 // --- Sound helpers ---
 struct ToneStep {
-    int freq_hz;
+    int freq_hz;                // 0 or less: silence
     int duration_ms;
 };
 
-// Schedule a tone and let loop_buzzer() stop it later.
-void beep(int freq_hz, int duration_ms);
-void play_tone_sequence(const ToneStep* steps, size_t count);
-void loop_buzzer();
-void stop_beep();
+// Who asked for a sound, lowest priority first. A request interrupts a
+// lower-priority melody and waits behind an equal or higher one. UI clicks
+// are the exception: a click replaces the click playing and is dropped while
+// anything else sounds, since late feedback is only noise.
+enum class ToneSource : uint8_t {
+    Ui = 0,                     // encoder clicks, confirm and double beeps
+    Alert,                      // sensor alert tones and melodies
+    TimerAlarm,                 // countdown finished
+    System,                     // boot animation, sleep signals
+};
 
-// Blocking tone helper used by the boot sequence and short melodies.
-void play_tone_blocking(int freq_hz, int duration_ms);
+// Melodies run on an esp_timer one-shot, so steps are timed to the
+// microsecond and no caller blocks or polls. play_tone_sequence() keeps a
+// reference to steps, which must outlive playback (static tables); any
+// length is fine. beep() copies its single step.
+void beep(int freq_hz, int duration_ms, ToneSource source = ToneSource::Ui);
+void play_tone_sequence(const ToneStep* steps, size_t count, ToneSource source = ToneSource::Ui);
+
+// Silence the buzzer and drop every queued melody.
+void stop_beep();
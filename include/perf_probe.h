@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "config.h"
+#endif
+
+// Host builds (test/) never enable the probes.
+#ifndef PBIT_ENABLE_PERF_PROBE
+#define PBIT_ENABLE_PERF_PROBE 0
+#endif
+
+// On-target micro-profiler for the code paths that run at 10 Hz or every frame.
+// Each probe accumulates time, call count, worst case and heap allocations
+// made by the calling task while the probe is open. Cycles are converted to
+// ns with the CPU frequency read when each scope closes, so samples taken at
+// 80 MHz and at 240 MHz under DFS are both right. A JSON line is printed
+// periodically so captures can be diffed with tools/perf_diff.py; the host
+// counterpart is test/test_perf_bench.
+//
+// Build the `esp32dev-perf` environment to enable it. The default build
+// compiles every PERF_PROBE_SCOPE() away.
+
+enum PerfProbeId : uint8_t {
+    PERF_GRAPH_PUSH = 0,
+    PERF_GRAPH_GET,
+    PERF_LDR_LUX,
+    PERF_BLE_PKT,
+    PERF_BLE_JSON,
+    PERF_ALERT_REFRESH,
+    PERF_RENDER_GRAPH,
+    PERF_COLOR_BLEND,           // gradient loops calling mix565()
+    PERF_GLYPH_DRAW,
+    PERF_PROBE_COUNT
+};
+
+#if PBIT_ENABLE_PERF_PROBE
+
+class PerfProbeScope {
+public:
+    explicit PerfProbeScope(PerfProbeId id);
+    ~PerfProbeScope();
+
+private:
+    PerfProbeId id_;
+    uint32_t start_cycles_;
+    uint32_t start_allocs_;
+};
+
+#define PERF_PROBE_CONCAT_INNER(a, b) a##b
+#define PERF_PROBE_CONCAT(a, b) PERF_PROBE_CONCAT_INNER(a, b)
+#define PERF_PROBE_SCOPE(id) PerfProbeScope PERF_PROBE_CONCAT(_perf_scope_, __LINE__)(id)
+
+// Register a task so its stack high-water mark is included in the report.
+void perf_probe_register_task(const char* name);
+
+// Print the JSON report when the interval has elapsed. Call from loop().
+void perf_probe_report_if_due(uint32_t now_ms);
+
+#else
+
+#define PERF_PROBE_SCOPE(id) ((void)0)
+inline void perf_probe_register_task(const char*) {}
+inline void perf_probe_report_if_due(uint32_t) {}
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "tft_display.h"
+
+// CPU frequency policy built on ESP-IDF power-management locks.
+//
+// The clock may drop to POWER_CPU_MIN_MHZ whenever no boost lock is held.
+// The UI task holds POWER_LOCK_RENDER while it draws and the sensor task
+// holds POWER_LOCK_SENSORS during its ADC/1-Wire/DHT burst. In POWER_IDLE
+// the "awake" lock is released as well, so automatic light sleep can run
+// when the IDF build has tickless idle.
+//
+// Builds whose IDF has no CONFIG_PM_ENABLE fall back to setCpuFrequencyMhz():
+// max clock in POWER_ACTIVE, min clock in POWER_IDLE, no light sleep.
+//
+// Time spent at each level and per lock is accumulated and printed every
+// POWER_STATS_REPORT_MS in debug builds.
+
+enum PowerLockId : uint8_t {
+    POWER_LOCK_RENDER = 0,
+    POWER_LOCK_SENSORS,
+    POWER_LOCK_COUNT
+};
+
+enum PowerLevel : uint8_t {
+    POWER_LEVEL_MAX = 0,         // max clock (boost held, or ACTIVE in fallback)
+    POWER_LEVEL_MIN,             // min clock, light sleep not allowed
+    POWER_LEVEL_LIGHT_SLEEP,     // min clock, automatic light sleep allowed
+    POWER_LEVEL_COUNT
+};
+
+struct PowerStats {
+    uint64_t level_us[POWER_LEVEL_COUNT];
+    uint64_t lock_us[POWER_LOCK_COUNT];
+    uint32_t lock_count[POWER_LOCK_COUNT];
+};
+
+// Configure DFS (or the fallback) and create the locks. Call once in setup()
+// before the tasks start.
+void power_manager_begin();
+
+// Apply g_power_mode changes and print stats when due. Call from loop().
+void power_manager_service(uint32_t now_ms);
+
+// loop() blocks in power_manager_wait() between services. Whoever changes
+// g_power_mode calls power_manager_wake_service() so the change is applied
+// now rather than up to POWER_LOOP_PERIOD_MS later. Wake is safe from any
+// task; wait only from the task that called power_manager_begin().
+void power_manager_wait(uint32_t timeout_ms);
+void power_manager_wake_service();
+
+// Nestable; safe from any task, not from ISRs.
+void power_boost_acquire(PowerLockId id);
+void power_boost_release(PowerLockId id);
+
+// Snapshot including the intervals that are still open.
+PowerStats power_manager_get_stats();
+
+class PowerBoostScope {
+public:
+    explicit PowerBoostScope(PowerLockId id) : id_(id) { power_boost_acquire(id_); }
+    ~PowerBoostScope() { power_boost_release(id_); }
+    PowerBoostScope(const PowerBoostScope&) = delete;
+    PowerBoostScope& operator=(const PowerBoostScope&) = delete;
+
+private:
+    PowerLockId id_;
+};
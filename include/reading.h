@@ -0,0 +1,24 @@
+#pragma once
+
+// One pass over every sensor. NaN marks a channel with no value; the
+// DS18B20 field reads below -100 °C while no probe answers. Kept apart from io.h
+// so the encoders that consume it build on a host.
+
+typedef struct {
+    float humidity;
+    float temperature; 
+    float ldr;
+    float ldr_raw;
+    float mic;
+
+    // --- Sensores Adicionales ---
+    float soil_humidity; 
+    float temp_ds18b20; 
+
+    // External I2C (i2c_sensors.h); NaN when not connected.
+    float co2_ppm;
+    float co2_temperature;
+    float co2_humidity;
+    float lux_i2c;
+    // ----------------------------
+} Reading;
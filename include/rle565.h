@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Generated images are declared PROGMEM; empty on the ESP32, and the reader
+// is also built on a host (test/test_rle565).
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+class TFT_eSPI;
+
+// Palette + run-length RGB565 images produced by tools/rle565_encode.py.
+//
+// The stream is a sequence of tokens over palette indices, in row order:
+//   0x00..0x7F  run:     (token + 1) copies of the index in the next byte
+//   0x80..0xFF  literal: (token & 0x7F) + 1 indices follow
+// Runs may cross row boundaries; the reader keeps its state between calls.
+
+struct Rle565Image {
+    uint16_t width;
+    uint16_t height;
+    uint16_t palette_count;
+    const uint16_t* palette;     // RGB565, same byte order as the raw arrays
+    const uint8_t* data;
+    uint32_t data_len;
+};
+
+class Rle565Reader {
+public:
+    explicit Rle565Reader(const Rle565Image& image) : image_(image) {}
+
+    // Decode up to count pixels into out and return how many were written.
+    // Returns less than count only at the end of the stream.
+    size_t read(uint16_t* out, size_t count);
+
+private:
+    const Rle565Image& image_;
+    uint32_t pos_ = 0;
+    uint8_t left_ = 0;           // pixels left in the current token
+    bool literal_ = false;
+    uint16_t color_ = 0;         // run colour
+};
+
+// Stream the image to the panel at (x, y) in strips of a few rows, inside one
+// address window. The image must fit on screen. Defined in rle565_draw.cpp,
+// so rle565.cpp keeps no TFT dependency.
+void rle565_draw(TFT_eSPI& tft, int32_t x, int32_t y, const Rle565Image& image);
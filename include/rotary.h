@@ -1,20 +1,51 @@
 #pragma once
 
-#include <ESP32RotaryEncoder.h>
+#include <Arduino.h>
 
 constexpr uint8_t DI_ENCODER_A = 14;
 constexpr uint8_t DI_ENCODER_B = 12;
 constexpr int8_t  DI_ENCODER_SW = 13;
 constexpr int8_t  DO_ENCODER_VCC = -1;
+constexpr uint8_t ENCODER_STEPS_PER_DETENT = 2;   // quadrature edges per click
 
-extern RotaryEncoder rotaryEncoder;
+/**
+ * Bounded knob value moved by PCNT detents (input_events.h). Keeps the
+ * boundary/value calls of the encoder library object it replaces: past a
+ * boundary a circular range jumps to the other end, otherwise it clamps.
+ */
+class EncoderKnob {
+public:
+    void setBoundaries(long min_value, long max_value, bool circular);
+    void setStepValue(long step) { step_ = step; }
+    void setEncoderValue(long value);
+    long getEncoderValue() const { return value_; }
+
+    // Apply signed detents one by one and return the new value.
+    long applyDetents(int32_t detents);
+
+private:
+    long min_ = 0;
+    long max_ = 0;
+    long step_ = 1;
+    long value_ = 0;
+    bool circular_ = false;
+};
+
+extern EncoderKnob rotaryEncoder;
 
 /**
- * Initialize the rotary encoder, callbacks, and default boundaries.
+ * Start the encoder/button interrupts and set the app boundaries.
  */
 void init_rotary();
 
 /**
- * Handle debounce, short presses on release, and long-press actions while held.
+ * Drain the input event queue (knob turns, debounced presses, long presses)
+ * and run the time-based button actions. Called from the UI task.
+ */
+void rotary_process_input();
+
+/**
+ * True while a button edge is still inside its debounce window, so the
+ * caller should come back within BUTTON_DEBOUNCE_MS.
  */
-void poll_rotary_aux();
+bool rotary_input_settling();
@@ -21,3 +21,8 @@ UiOverlayState runtime_get_ui_overlay();
 
 void runtime_set_last_active_screen_before_sleep(Screen screen);
 Screen runtime_get_last_active_screen_before_sleep();
+
+// Set by setup() right before the UI task starts. The sensor task runs
+// earlier on cold boot and keeps alert sounds off the buzzer until then.
+void runtime_mark_app_ready();
+bool runtime_app_ready();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include "tft_display.h"
+
+// Declarative screen table shared by the UI router, the rotary dispatch and
+// the sleep/restore logic. There is one constexpr row per Screen value,
+// indexed by the enum, so every lookup is O(1). Lab rows are under
+// PBIT_ENABLE_GRAPH_LAB like their enum values, so production builds carry
+// neither the rows nor the draw code they reference. Gallery rows (lab screens
+// outside the carousel) only carry a draw function with PBIT_ENABLE_LAB_GALLERY.
+//
+// Adding a screen: add the enum value, one row in screen_registry.cpp and, if
+// it is part of the lab carousel, its kCarousel slot in rotary.cpp.
+
+// Draw entry point. `tick` is the periodic refresh set by refresh_ms.
+using ScreenDrawFn = void (*)(bool screen_changed, bool data_changed, bool tick);
+
+enum ScreenFlags : uint8_t {
+    SCREEN_RESTORABLE = 1 << 0,   // can be restored after IDLE or deep sleep
+    SCREEN_LED_DARK   = 1 << 1    // LED stays off, even for alerts (LDR screen)
+};
+
+constexpr uint32_t SCREEN_RGB_KEEP = 0xFF000000UL;   // leave the LED as it is
+
+// Short press outside a menu.
+enum class ScreenPress : uint8_t {
+    None,
+    Cycle,          // call ScreenDesc::cycle and click
+    ToggleUnit,     // °C / °F
+    ToggleSound,    // global sound flag
+    TimerRunPause,
+    SwapSoundVu     // stack <-> wave view
+};
+
+// Action while the button is held.
+enum class ScreenHold : uint8_t {
+    None,
+    OpenMenu,       // MENU_LONG_PRESS_MS opens the screen menu
+    Timer,          // reset / open or confirm the duration menu
+    SensorMenu      // lab sensor slot: open the classic menu of that sensor
+};
+
+enum class MenuFeedback : uint8_t {
+    Range,          // confirm click in [confirm_first, confirm_last], double beep on saved_state
+    SoilWizard      // calibration steps have their own tones
+};
+
+// Settings menu hosted by a screen. handle_button() returns the next state;
+// 0 means the menu closed and the knob goes back to the carousel.
+struct ScreenMenu {
+    bool    (*is_active)();
+    void    (*start)();
+    int     (*encoder_min)();
+    int     (*encoder_max)();
+    int     (*encoder_value)();
+    void    (*set_input)(int value);
+    bool    (*circular)();          // knob wraps in the current state
+    uint8_t (*state)();             // current state, for feedback
+    uint8_t (*handle_button)();
+    MenuFeedback feedback;
+    uint8_t confirm_first;
+    uint8_t confirm_last;
+    uint8_t saved_state;            // 0 when the menu has no "saved" state
+    bool    full_redraw;            // request a full redraw after each input
+};
+
+struct ScreenDesc {
+    Screen              id;
+    ScreenDrawFn        draw;           // nullptr: nothing to draw (boot)
+    uint16_t            (*refresh_ms)(); // periodic redraw, 0 or nullptr = on data only
+    uint32_t            rgb;            // 0xRRGGBB idle colour, or SCREEN_RGB_KEEP
+    void                (*rgb_fn)();    // dynamic idle colour, overrides rgb
+    uint8_t             flags;
+    const ScreenMenu*   menu;
+    ScreenPress         press;
+    void                (*cycle)();
+    ScreenHold          hold;
+};
+
+const ScreenDesc& screen_desc(Screen screen);
+
+// Accepts raw values read back from RTC memory.
+bool screen_is_restorable(uint8_t screen);
+
+bool screen_menu_is_active(const ScreenDesc& desc);
+
+// Set the LED to the screen's idle colour (no alert active).
+void screen_apply_idle_rgb(Screen screen);
+
+// Settings UI flag used by the sleep policy. The rotary driver refreshes it
+// after each dispatched input, which is the only place a menu opens or closes.
+void screen_refresh_settings_ui_flag();
+bool screen_settings_ui_active();
@@ -5,6 +5,14 @@
 // Typed snapshots loaded from / persisted to NVS.
 // The hardware layer stays responsible for validation and in-memory caches,
 // while this module only owns raw storage concerns.
+//
+// Every setting lives in one versioned, CRC-checked record read with a single
+// getBytes() at boot (settings_store_begin()). Older layouts, including the
+// legacy one-key-per-setting format, are migrated on load.
+//
+// Saves are write-back: save_*_store() updates the RAM record and returns at
+// once. settings_store_service() writes the blob after a short debounce;
+// call settings_store_flush() before idle, sleep or esp_restart().
 
 struct SoilCalibrationData {
     int dry_raw;
@@ -91,17 +99,33 @@ void save_system_sleep_timeout_store(uint32_t timeout_ms);
 
 void clear_all_settings_store();
 
+enum class SettingsLoadResult : uint8_t {
+    Loaded = 0,     // blob read (and upgraded if it was older)
+    Migrated,       // no blob: built from the legacy keys, or empty on a fresh device
+    Unreadable,     // blob kept in NVS but not used (CRC, length, unknown or newer version)
+};
+
+// Load (and migrate if needed) the settings record. Safe to call more than once.
+void settings_store_begin();
+// How the record was obtained at boot. Unreadable means defaults are in use
+// and the blob is only replaced once the user saves a setting.
+SettingsLoadResult settings_store_load_result();
+// Commit every pending save now.
+void settings_store_flush();
+// Commit pending saves once edits have settled. Call from loop().
+void settings_store_service(uint32_t now_ms);
+
 // Sensor zone navigation persistence
 uint8_t load_sz_sensor_store();
 void    save_sz_sensor_store(uint8_t sensor_id);
 uint8_t load_sz_viz_store(uint8_t sensor_id);
 void    save_sz_viz_store(uint8_t sensor_id, uint8_t viz_mode);
 
-// BLE feature gate — factory-disabled. Cleared on every new flash (build hash reset).
+// BLE feature gate — factory-disabled. Cleared on every new flash (build stamp change).
 bool load_ble_enabled_store();
 void save_ble_enabled_store(bool enabled);
 
-// Firmware build stamp — resets NVS whenever a new binary is flashed.
+// Firmware build stamp — detects a newly flashed binary.
 // Stores/loads a 32-bit FNV-1a hash of the build timestamp.
 uint32_t load_fw_build_stamp_store();
 void     save_fw_build_stamp_store(uint32_t stamp);
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+// Header-only signal conditioning for the sensor channels.
+//
+// Every stage keeps its state inline (no heap), costs the same on every
+// sample, and has reset() so a channel can start over after a disconnect or
+// a calibration change. Stages are chained declaratively:
+//
+//   FilterChain<MedianFilter<float, 3>, EmaFilter> chain(MedianFilter<float, 3>(), EmaFilter(0.3f));
+//   float y = chain.update(x);
+//
+// The float stages treat NaN as "no sample": they pass it through without
+// touching their state. Only DropoutHold acts on it. EmaFilterFixed is the
+// integer variant for channels that are already integral (sound level).
+// Sensor task only; none of these are thread safe.
+
+namespace filter_detail {
+
+// Insertion sort for the small fixed windows used here (N <= 9).
+template <typename T, size_t N>
+void sort_window(T (&v)[N], size_t count) {
+    for (size_t i = 1; i < count; ++i) {
+        const T x = v[i];
+        size_t j = i;
+        while (j > 0 && v[j - 1] > x) {
+            v[j] = v[j - 1];
+            --j;
+        }
+        v[j] = x;
+    }
+}
+
+template <typename T>
+bool is_missing(T) { return false; }
+inline bool is_missing(float x) { return isnan(x); }
+
+} // namespace filter_detail
+
+// Median of the last N samples (N odd). Removes single-sample spikes with a
+// delay of N/2 samples. Until the window fills, the median of what is there.
+template <typename T, size_t N>
+class MedianFilter {
+    static_assert(N % 2 == 1 && N <= 9, "MedianFilter wants a small odd window");
+public:
+    T update(T x) {
+        if (filter_detail::is_missing(x)) return x;
+        window_[head_] = x;
+        head_ = (head_ + 1) % N;
+        if (count_ < N) ++count_;
+        T sorted[N];
+        for (size_t i = 0; i < count_; ++i) sorted[i] = window_[i];
+        filter_detail::sort_window(sorted, count_);
+        return sorted[count_ / 2];
+    }
+    void reset() { head_ = 0; count_ = 0; }
+
+private:
+    T window_[N] = {};
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+// y += alpha * (x - y). alpha is the weight of the new sample; the first
+// sample after reset() primes the output.
+class EmaFilter {
+public:
+    explicit EmaFilter(float alpha) : alpha_(alpha) {}
+
+    float update(float x) {
+        if (isnan(x)) return x;
+        y_ = primed_ ? y_ + alpha_ * (x - y_) : x;
+        primed_ = true;
+        return y_;
+    }
+    void reset() { primed_ = false; }
+
+private:
+    float alpha_;
+    float y_ = 0.0f;
+    bool primed_ = false;
+};
+
+// Integer EMA with alpha in Q8 (alpha_q8 / 256). The state keeps 8 extra
+// fraction bits, so small steps are not lost to truncation.
+class EmaFilterFixed {
+public:
+    explicit EmaFilterFixed(uint16_t alpha_q8) : alpha_q8_(alpha_q8) {}
+
+    int32_t update(int32_t x) {
+        const int32_t x_q8 = x * 256;
+        y_q8_ = primed_ ? y_q8_ + (int32_t)(((int64_t)(x_q8 - y_q8_) * alpha_q8_) / 256) : x_q8;
+        primed_ = true;
+        return y_q8_ / 256;
+    }
+    void reset() { primed_ = false; }
+
+private:
+    uint16_t alpha_q8_;
+    int32_t y_q8_ = 0;
+    bool primed_ = false;
+};
+
+// Hampel identifier over the last N samples: a sample further than
+// k * 1.4826 * MAD from the window median is replaced by the median.
+// Unlike MedianFilter, clean samples pass unchanged and undelayed.
+template <size_t N>
+class HampelFilter {
+    static_assert(N % 2 == 1 && N <= 9, "HampelFilter wants a small odd window");
+public:
+    explicit HampelFilter(float k) : k_(k) {}
+
+    float update(float x) {
+        if (isnan(x)) return x;
+        window_[head_] = x;
+        head_ = (head_ + 1) % N;
+        if (count_ < N) ++count_;
+        if (count_ < N) return x;
+
+        float sorted[N];
+        for (size_t i = 0; i < N; ++i) sorted[i] = window_[i];
+        filter_detail::sort_window(sorted, N);
+        const float median = sorted[N / 2];
+        for (size_t i = 0; i < N; ++i) sorted[i] = fabsf(window_[i] - median);
+        filter_detail::sort_window(sorted, N);
+        const float mad = sorted[N / 2];
+        // The outlier stays in the window, so a real step wins once it
+        // fills half of it.
+        return fabsf(x - median) > k_ * 1.4826f * mad ? median : x;
+    }
+    void reset() { head_ = 0; count_ = 0; }
+
+private:
+    float k_;
+    float window_[N] = {};
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+// Scalar Kalman filter for a value that is assumed constant between
+// samples: q is the process noise variance, r the measurement noise.
+class Kalman1D {
+public:
+    Kalman1D(float q, float r) : q_(q), r_(r) {}
+
+    float update(float x) {
+        if (isnan(x)) return x;
+        if (!primed_) {
+            x_ = x;
+            p_ = r_;
+            primed_ = true;
+            return x_;
+        }
+        p_ += q_;
+        const float gain = p_ / (p_ + r_);
+        x_ += gain * (x - x_);
+        p_ *= (1.0f - gain);
+        return x_;
+    }
+    void reset() { primed_ = false; }
+
+private:
+    float q_;
+    float r_;
+    float x_ = 0.0f;
+    float p_ = 0.0f;
+    bool primed_ = false;
+};
+
+// Holds the output until the input moves more than `band` away from it.
+// Stops the last digit from flickering on a steady signal.
+template <typename T>
+class Deadband {
+public:
+    explicit Deadband(T band) : band_(band) {}
+
+    T update(T x) {
+        if (filter_detail::is_missing(x)) return x;
+        const T delta = x > y_ ? x - y_ : y_ - x;
+        if (!primed_ || delta > band_) {
+            y_ = x;
+            primed_ = true;
+        }
+        return y_;
+    }
+    void reset() { primed_ = false; }
+
+private:
+    T band_;
+    T y_ = T();
+    bool primed_ = false;
+};
+
+// Bridges short dropouts: a NaN sample repeats the last good value up to
+// max_held times in a row, then NaN goes through.
+class DropoutHold {
+public:
+    explicit DropoutHold(uint8_t max_held) : max_held_(max_held) {}
+
+    float update(float x) {
+        if (!isnan(x)) {
+            last_ = x;
+            held_ = 0;
+            return x;
+        }
+        if (held_ < max_held_) {
+            ++held_;
+            return last_;
+        }
+        return x;
+    }
+    void reset() {
+        last_ = NAN;
+        held_ = 0;
+    }
+
+private:
+    uint8_t max_held_;
+    uint8_t held_ = 0;
+    float last_ = NAN;
+};
+
+// Stages applied in order; each stage's output feeds the next.
+template <typename... Stages>
+class FilterChain;
+
+template <>
+class FilterChain<> {
+public:
+    template <typename T>
+    T update(T x) { return x; }
+    void reset() {}
+};
+
+template <typename First, typename... Rest>
+class FilterChain<First, Rest...> {
+public:
+    explicit FilterChain(const First& first, const Rest&... rest) : first_(first), rest_(rest...) {}
+
+    template <typename T>
+    T update(T x) { return rest_.update(first_.update(x)); }
+    void reset() {
+        first_.reset();
+        rest_.reset();
+    }
+
+private:
+    First first_;
+    FilterChain<Rest...> rest_;
+};
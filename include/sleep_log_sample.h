@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+
+// One deep-sleep log record (sleep_logger.h). No Arduino dependency so the
+// history stream can frame it on a host (test/test_history_stream).
+struct SleepLogSample {
+    uint32_t t_s;          // seconds of RTC time
+    int16_t  temp_x10;     // INT16_MIN = no reading
+    int16_t  hum_x10;
+    int16_t  ds18_x10;
+    uint16_t ldr;
+    uint8_t  soil;         // 0xFF = no reading
+    uint8_t  mic;          // 0xFF = no reading (ULP-only samples)
+};
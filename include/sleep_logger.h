@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "sleep_log_sample.h"
+
+// Duty-cycled logging in deep sleep. Samples collect in an RTC_DATA_ATTR ring
+// buffer; the wake that fills it appends it to an NVS archive, and so does
+// the encoder-button wake that ends the session. The archive is its own
+// timestamped series, separate from the 1 s graph buffers. With
+// PBIT_ENABLE_ULP_MONITOR the ULP samples LDR and soil in between and the CPU
+// wakes only when it asks to.
+
+constexpr size_t SLEEP_LOG_CAPACITY = 120;   // 2 h at one sample per minute
+constexpr uint8_t SLEEP_LOG_ARCHIVE_BLOCKS = 3;   // a full ring each: 6 h more in NVS
+constexpr size_t SLEEP_LOG_HISTORY_MAX = SLEEP_LOG_ARCHIVE_BLOCKS * SLEEP_LOG_CAPACITY + SLEEP_LOG_CAPACITY;
+
+#if PBIT_ENABLE_LOG_SLEEP
+
+// True when this boot is a logging wake (RTC timer or ULP while in logging sleep).
+bool sleep_logger_is_log_wake();
+
+// Take one reading, append it and go back to sleep. Does not return.
+void sleep_logger_run_log_wake();
+
+// Arm timer + encoder wake and enter deep sleep. Does not return.
+void sleep_logger_enter();
+
+// End of a logging session (encoder wake): collect the ULP buffer and
+// archive what is left in the ring. Returns the number of samples archived.
+size_t sleep_logger_archive();
+
+// Copy the logged history, oldest first, into out (SLEEP_LOG_HISTORY_MAX
+// holds all of it). Returns the number of samples copied.
+size_t sleep_logger_read(SleepLogSample* out, size_t cap);
+
+#else
+
+inline bool sleep_logger_is_log_wake() { return false; }
+inline void sleep_logger_run_log_wake() {}
+inline void sleep_logger_enter() {}
+inline size_t sleep_logger_archive() { return 0; }
+inline size_t sleep_logger_read(SleepLogSample*, size_t) { return 0; }
+
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Shared backing store for every TFT_eSprite in the UI.
+//
+// Sprites no longer call createSprite(): a SpriteLease binds a 16-bit sprite
+// to a slice of one static arena, so the heap never sees sprite buffers and
+// a sprite cannot fail to allocate in the middle of a session. The router
+// calls sprite_pool_release_all() whenever the active screen changes; the
+// leases of the previous screen go stale and the next screen reuses the
+// whole arena.
+//
+// SPRITE_ARENA_BYTES covers the largest single screen (the graph sprite,
+// 154x64). Every user static_asserts its own worst case against it.
+// UI task only.
+
+constexpr size_t SPRITE_ARENA_BYTES = 20 * 1024;
+
+constexpr size_t sprite_bytes(int w, int h) {
+    return ((size_t)w * (size_t)h * 2 + 3) & ~(size_t)3;
+}
+
+struct SpritePoolStats {
+    uint32_t arena_bytes;
+    uint32_t used_bytes;        // current screen
+    uint32_t peak_bytes;        // since boot
+    uint16_t active_leases;
+    uint32_t leases;            // acquisitions since boot
+    uint32_t failures;          // requests that did not fit
+};
+
+// TFT_eSprite drawing into memory it does not own. attach() sets up the same
+// state createSprite() does for a single-frame 16-bit sprite; detach() drops
+// the buffer so deleteSprite() never frees arena memory.
+class ArenaSprite : public TFT_eSprite {
+public:
+    explicit ArenaSprite(TFT_eSPI* tft) : TFT_eSprite(tft) {}
+    ~ArenaSprite() { detach(); }
+
+    void attach(uint16_t* buffer, int16_t w, int16_t h);
+    void detach();
+};
+
+class SpriteLease {
+public:
+    SpriteLease(TFT_eSPI* tft) : sprite_(tft) {}   // implicit: arrays use { {&tft}, ... }
+    ~SpriteLease() { release(); }
+    SpriteLease(const SpriteLease&) = delete;
+    SpriteLease& operator=(const SpriteLease&) = delete;
+
+    // The sprite of this lease, bound to a w x h slice of the arena. Returns
+    // the same sprite while the lease is still current and the size matches;
+    // nullptr if the arena cannot fit it (counted in the stats). *fresh, if
+    // given, is set when the sprite was (re)bound and so holds only black.
+    TFT_eSprite* acquire(int16_t w, int16_t h, bool* fresh = nullptr);
+
+    // Give the slice back early. Only the newest slice returns to the arena
+    // right away; the rest is reclaimed on the next screen change.
+    void release();
+
+private:
+    ArenaSprite sprite_;
+    uint32_t generation_ = 0;   // 0: not bound
+    uint32_t offset_ = 0;
+    uint32_t bytes_ = 0;
+};
+
+// Invalidate every lease and rewind the arena. Called by the UI router on a
+// screen change, before the new screen draws.
+void sprite_pool_release_all();
+
+SpritePoolStats sprite_pool_get_stats();
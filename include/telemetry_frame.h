@@ -0,0 +1,89 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Telemetry frame v3 for the main BLE characteristic (MANUAL_TECNICO_PBIT.md,
+// section 10). Self-describing and delta encoded; clients opt in with the
+// 0x03 command, everyone else keeps receiving the fixed 20-byte v2 packet.
+// No Arduino dependency so the firmware and a host decoder share this code.
+//
+// Layout:
+//   byte 0      (version << 4) | flags          flags bit0 = key frame
+//   byte 1      sequence number (u8, wraps)
+//   varint      field bitmap (TELEMETRY_FIELD_*)
+//   fields      in bitmap order, each a zigzag varint:
+//               key frame   -> absolute value
+//               delta frame -> value minus the previous frame's value
+//   DS18 field  count u8 followed by one zigzag varint per probe
+//   ALERTS      absolute varint, 3 bits per AlertSensor
+// A field missing from a delta frame is unchanged. The timestamp is always sent.
+
+constexpr uint8_t TELEMETRY_FRAME_VERSION = 3;
+constexpr uint8_t TELEMETRY_FLAG_KEY = 0x01;
+constexpr uint8_t TELEMETRY_MAX_DS18 = 4;
+constexpr uint8_t TELEMETRY_KEYFRAME_INTERVAL = 32;
+// Longest possible frame: every field present at its longest varint.
+// Clients may only select v3 once the ATT payload holds this much.
+constexpr size_t  TELEMETRY_FRAME_MAX_LEN = 2 + 2 + 5 * 5 + (1 + TELEMETRY_MAX_DS18 * 5) + 5 + 5 + 5;
+
+// Stored for fields whose sensor is missing (NaN, no probe).
+constexpr int32_t TELEMETRY_INVALID = INT32_MIN;
+
+enum TelemetryField : uint16_t {
+    TELEMETRY_FIELD_TEMP      = 1u << 0,  // DHT °C x10
+    TELEMETRY_FIELD_HUM       = 1u << 1,  // % x10
+    TELEMETRY_FIELD_LDR       = 1u << 2,  // lux
+    TELEMETRY_FIELD_MIC       = 1u << 3,  // %
+    TELEMETRY_FIELD_SOIL      = 1u << 4,  // %
+    TELEMETRY_FIELD_DS18      = 1u << 5,  // °C x10 per probe
+    TELEMETRY_FIELD_LDR_RAW   = 1u << 6,  // ADC counts
+    TELEMETRY_FIELD_ALERTS    = 1u << 7,
+    TELEMETRY_FIELD_TIMESTAMP = 1u << 8,  // ms since boot
+};
+
+struct TelemetrySample {
+    uint32_t timestamp_ms;
+    int32_t  temp_x10;
+    int32_t  hum_x10;
+    int32_t  ldr_lux;
+    int32_t  mic;
+    int32_t  soil;
+    int32_t  ldr_raw;
+    uint32_t alert_codes;
+    uint8_t  ds18_count;
+    int32_t  ds18_x10[TELEMETRY_MAX_DS18];
+};
+
+struct TelemetryEncoder {
+    TelemetrySample prev;
+    bool    has_prev;
+    uint8_t seq;
+    uint8_t since_key;
+};
+
+struct TelemetryDecoder {
+    TelemetrySample prev;
+    bool    synced;      // false until a key frame arrives or after a gap
+    uint8_t next_seq;
+};
+
+enum class TelemetryDecodeStatus : uint8_t {
+    Ok = 0,
+    NeedKeyFrame,        // delta frame received while out of sync
+    BadFrame
+};
+
+struct TelemetryDecodeResult {
+    TelemetryDecodeStatus status;
+    uint8_t lost;        // frames missing before this one
+};
+
+void telemetry_encoder_reset(TelemetryEncoder& enc);
+void telemetry_decoder_reset(TelemetryDecoder& dec);
+
+// Returns the frame length, or 0 when it does not fit in cap (state untouched).
+size_t telemetry_encode(TelemetryEncoder& enc, const TelemetrySample& sample, bool force_key,
+                        uint8_t* out, size_t cap);
+
+TelemetryDecodeResult telemetry_decode(TelemetryDecoder& dec, const uint8_t* data, size_t len,
+                                       TelemetrySample& out);
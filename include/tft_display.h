@@ -4,7 +4,7 @@
 #include "io.h"
 
 // --- Screen enum ---
-// Keep this in sync with the router and the screen modules.
+// Each value has one row in the screen table (screen_registry.cpp).
 enum Screen {
     BOOT_SCREEN,
     TEMP_SCREEN,
@@ -45,9 +45,11 @@ enum Screen {
 #if PBIT_ENABLE_GRAPH_LAB
 constexpr Screen FIRST_APP_SCREEN = LAB_HOME_CARDS_SCREEN;
 constexpr Screen LAST_APP_SCREEN = SENSOR_ZONE_SCREEN;
+constexpr uint8_t SCREEN_COUNT = SENSOR_ZONE_SCREEN + 1;
 #else
 constexpr Screen FIRST_APP_SCREEN = TEMP_SCREEN;
 constexpr Screen LAST_APP_SCREEN = GRAPH_SCREEN;
+constexpr uint8_t SCREEN_COUNT = BLE_TOGGLE_SCREEN + 1;
 #endif
 
 enum UiOverlayState {
@@ -1,5 +1,11 @@
 #pragma once
 #include "tft_display.h"
 
-// Public API for the startup logo sequence.
-void run_boot_sequence();
+// Cold-boot logo sequence (logos, tones and LED colours).
+//
+// boot_animation_start() returns at once: the sequence runs as a timed state
+// machine on the BootAnim task while setup() goes on with NVS, hardware and
+// sensor init. Nothing else may draw on the TFT or use the buzzer until
+// boot_animation_wait() has returned; the screen is left black.
+void boot_animation_start();
+void boot_animation_wait();
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// ULP coprocessor monitor for the LDR and soil channels during logging sleep.
+// The ULP samples both ADC1 inputs every ULP_MONITOR_INTERVAL_MS into RTC slow
+// memory and wakes the CPU when a light or soil alert class changes or the
+// buffer fills. The threshold logic is ulp_monitor_model.h.
+
+constexpr size_t ULP_MONITOR_CAPACITY = 60;   // 1 h at one sample per minute
+
+struct UlpMonitorSample {
+    uint16_t ldr_raw;
+    uint16_t soil_raw;
+};
+
+#if PBIT_ENABLE_ULP_MONITOR
+
+// Derive thresholds from the current alert settings, take the reference zones
+// from a fresh reading, load the program and start the ULP timer. Call right
+// before deep sleep; settings must be loaded (init_hw).
+bool ulp_monitor_start();
+
+// Stop the ULP timer so the main cores can use ADC1 again.
+void ulp_monitor_stop();
+
+// UlpMonWake left by the last run.
+uint8_t ulp_monitor_wake_reason();
+
+// Copy the buffered samples oldest first and empty the buffer.
+size_t ulp_monitor_take_samples(UlpMonitorSample* out, size_t max);
+
+#else
+
+inline bool ulp_monitor_start() { return false; }
+inline void ulp_monitor_stop() {}
+inline uint8_t ulp_monitor_wake_reason() { return 0; }
+inline size_t ulp_monitor_take_samples(UlpMonitorSample*, size_t) { return 0; }
+
+#endif
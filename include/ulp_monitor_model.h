@@ -0,0 +1,57 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Reference model of the ULP threshold monitor (MANUAL_TECNICO_PBIT.md,
+// section 11). The ULP program in ulp_monitor.cpp runs exactly this logic on
+// the boundaries derived here. No Arduino dependency so it builds on a host.
+//
+// An alert classification is a step function of the raw ADC value. Each
+// channel is reduced to the ascending raw values where the class changes; the
+// zone of a sample is the number of boundaries <= raw, so a class change is
+// exactly a zone change. The ULP only needs compares, no float math.
+
+constexpr uint8_t  ULP_MON_CHANNELS = 2;
+constexpr uint8_t  ULP_MON_MAX_BOUNDARIES = 4;
+constexpr uint16_t ULP_MON_ADC_MAX = 4095;
+constexpr uint16_t ULP_MON_NO_BOUNDARY = 0xFFFF;   // above any 12-bit sample
+
+enum UlpMonChannel : uint8_t {
+    ULP_MON_CH_LDR = 0,    // GPIO39, ADC1_CH3
+    ULP_MON_CH_SOIL = 1    // GPIO35, ADC1_CH7
+};
+
+enum UlpMonWake : uint8_t {
+    ULP_MON_WAKE_NONE = 0,
+    ULP_MON_WAKE_CROSSING = 1,
+    ULP_MON_WAKE_FULL = 2
+};
+
+// Maps a raw ADC value to an alert code.
+typedef uint8_t (*UlpMonClassifier)(uint16_t raw, const void* ctx);
+
+struct UlpMonState {
+    uint16_t boundary[ULP_MON_CHANNELS][ULP_MON_MAX_BOUNDARIES];
+    uint16_t ref_zone[ULP_MON_CHANNELS];
+    uint16_t count;        // samples stored since the last arm
+    uint16_t capacity;
+    uint16_t streak;       // consecutive samples outside the reference zones
+    uint16_t confirm;      // streak that reports a crossing, >= 1
+    uint16_t wake;         // UlpMonWake, sticky until the next arm
+};
+
+// Scan 0..ULP_MON_ADC_MAX and store each raw value where the class changes.
+// Returns the number of changes; only the first ULP_MON_MAX_BOUNDARIES are
+// kept and unused slots are ULP_MON_NO_BOUNDARY.
+uint8_t ulp_mon_derive_boundaries(UlpMonClassifier classify, const void* ctx,
+                                  uint16_t out[ULP_MON_MAX_BOUNDARIES]);
+
+uint16_t ulp_mon_zone(uint16_t raw, const uint16_t boundary[ULP_MON_MAX_BOUNDARIES]);
+
+// Empty the buffer, clear the wake reason and take the reference zones from
+// the given samples. Boundaries, capacity and confirm must already be set.
+void ulp_mon_arm(UlpMonState& s, uint16_t ldr_raw, uint16_t soil_raw);
+
+// One ULP period. Nothing is stored once a wake is pending or the buffer is
+// full. Returns the pending wake reason.
+UlpMonWake ulp_mon_step(UlpMonState& s, uint16_t ldr_raw, uint16_t soil_raw);
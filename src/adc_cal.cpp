@@ -0,0 +1,57 @@
+// adc_cal.cpp
+// eFuse ADC characterization sampled into per-attenuation lookup tables.
+
+#include "adc_cal.h"
+#include "config.h"
+#include <esp_adc_cal.h>
+
+namespace {
+
+constexpr uint32_t ADC_CAL_DEFAULT_VREF_MV = 1100;
+constexpr uint8_t ADC_CAL_KNOT_SHIFT = 4;                   // one knot every 16 counts
+constexpr size_t ADC_CAL_KNOTS = (4096 >> ADC_CAL_KNOT_SHIFT) + 1;
+
+uint16_t g_mv_table[ADC_ATTEN_MAX][ADC_CAL_KNOTS];
+AdcCalSource g_source[ADC_ATTEN_MAX] = {};
+
+} // namespace
+
+void adc_cal_prepare(adc_atten_t atten) {
+    if ((unsigned)atten >= ADC_ATTEN_MAX || g_source[atten] != AdcCalSource::None) return;
+
+    esp_adc_cal_characteristics_t chars;
+    const esp_adc_cal_value_t kind =
+        esp_adc_cal_characterize(ADC_UNIT_1, atten, ADC_WIDTH_BIT_12, ADC_CAL_DEFAULT_VREF_MV, &chars);
+
+    uint16_t* table = g_mv_table[atten];
+    for (size_t i = 0; i < ADC_CAL_KNOTS; ++i) {
+        uint32_t raw = (uint32_t)i << ADC_CAL_KNOT_SHIFT;
+        if (raw > 4095) raw = 4095;
+        table[i] = (uint16_t)esp_adc_cal_raw_to_voltage(raw, &chars);
+    }
+
+    g_source[atten] = kind == ESP_ADC_CAL_VAL_EFUSE_TP   ? AdcCalSource::EfuseTwoPoint
+                    : kind == ESP_ADC_CAL_VAL_EFUSE_VREF ? AdcCalSource::EfuseVref
+                    : AdcCalSource::DefaultVref;
+    DPRINT("[ADC] atten %d calibrated from %s: 0 -> %u mV, 4095 -> %u mV\n", (int)atten,
+           kind == ESP_ADC_CAL_VAL_EFUSE_TP ? "eFuse two-point" :
+           kind == ESP_ADC_CAL_VAL_EFUSE_VREF ? "eFuse Vref" : "default Vref",
+           (unsigned)table[0], (unsigned)table[ADC_CAL_KNOTS - 1]);
+}
+
+uint16_t adc_raw_to_mv(uint16_t raw, adc_atten_t atten) {
+    if ((unsigned)atten >= ADC_ATTEN_MAX) return 0;
+    if (g_source[atten] == AdcCalSource::None) adc_cal_prepare(atten);
+    if (raw > 4095) raw = 4095;
+
+    const uint16_t* table = g_mv_table[atten];
+    const uint16_t i = raw >> ADC_CAL_KNOT_SHIFT;
+    const int32_t frac = raw & ((1 << ADC_CAL_KNOT_SHIFT) - 1);
+    const int32_t lo = table[i];
+    const int32_t hi = table[i + 1];
+    return (uint16_t)(lo + (((hi - lo) * frac) >> ADC_CAL_KNOT_SHIFT));
+}
+
+AdcCalSource adc_cal_source(adc_atten_t atten) {
+    return (unsigned)atten < ADC_ATTEN_MAX ? g_source[atten] : AdcCalSource::None;
+}
@@ -1,6 +1,7 @@
 #include "alert_engine.h"
 #include "hw.h"
 #include "led_control.h"
+#include "perf_probe.h"
 
 namespace {
 
@@ -33,6 +34,12 @@ GlobalAlertSummary g_global_alert_summary = {
 
 uint32_t g_last_audio_ms[(size_t)AlertSensor::Count] = {0};
 
+// Sensor task only.
+AlertFilterState g_filter_state[(size_t)AlertSensor::Count] = {};
+
+AlertHistoryEntry g_history[ALERT_HISTORY_CAPACITY] = {};
+uint32_t g_history_seq = 0;
+
 constexpr ToneStep SOIL_DRY_MELODY[] = {
     {988, 38},
     {0,   12},
@@ -124,7 +131,18 @@ static const char* sensor_short_name(AlertSensor sensor) {
 
 } // namespace
 
-static AlertEvent update_alert_state(AlertSensor sensor, uint8_t code, bool screen_changed) {
+// Caller holds g_alert_engine_mux.
+static void push_history_locked(AlertSensor sensor, uint8_t from_code, uint8_t to_code, uint32_t now_ms) {
+    const uint32_t seq = ++g_history_seq;
+    AlertHistoryEntry& entry = g_history[(seq - 1) % ALERT_HISTORY_CAPACITY];
+    entry.seq = seq;
+    entry.time_ms = now_ms;
+    entry.sensor = sensor;
+    entry.from_code = from_code;
+    entry.to_code = to_code;
+}
+
+static AlertEvent update_alert_state(AlertSensor sensor, uint8_t code, bool screen_changed, uint32_t now_ms) {
     const size_t index = (size_t)sensor;
     portENTER_CRITICAL(&g_alert_engine_mux);
     uint8_t previous = g_current_alert_code[index];
@@ -140,6 +158,7 @@ static AlertEvent update_alert_state(AlertSensor sensor, uint8_t code, bool scre
     bool exited = changed && previous != ALERT_CODE_OFF && code == ALERT_CODE_OFF;
 
     g_current_alert_code[index] = code;
+    if (changed) push_history_locked(sensor, previous, code, now_ms);
     portEXIT_CRITICAL(&g_alert_engine_mux);
     return {code, changed, entered, exited};
 }
@@ -204,61 +223,13 @@ static void refresh_global_summary_locked(uint32_t now_ms) {
     g_global_alert_summary = build_global_summary_locked(now_ms);
 }
 
-static int classify_soil_category(float soil, bool no_sensor) {
-    if (no_sensor) return -1;
-    if (soil < (float)get_soil_threshold_dry()) return 0;
-    if (soil < (float)get_soil_threshold_optimal()) return 1;
-    if (soil < (float)get_soil_threshold_moist()) return 2;
-    return 3;
-}
-
-uint8_t classify_temp_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm) {
-    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
-    if (temp_c <= (float)low_alarm) return ALERT_CODE_LOW;
-    if (temp_c >= (float)high_alarm) return ALERT_CODE_HIGH;
-    return ALERT_CODE_OK;
-}
-
-uint8_t classify_humidity_alert(float humidity, bool no_sensor, bool alerts_enabled, int dry_max, int comfort_max) {
-    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
-    if (humidity < (float)dry_max) return ALERT_CODE_LOW;
-    if (humidity > (float)comfort_max) return ALERT_CODE_HIGH;
-    return ALERT_CODE_OK;
-}
-
-uint8_t classify_light_alert(float lux, bool alerts_enabled, int dim_max, int bright_max) {
-    if (!alerts_enabled) return ALERT_CODE_OFF;
-    if (lux < (float)dim_max) return ALERT_CODE_LOW;
-    if (lux >= (float)bright_max) return ALERT_CODE_HIGH;
-    return ALERT_CODE_OK;
-}
-
-uint8_t classify_sound_alert(float level, bool alerts_enabled, int normal_max, int loud_max) {
-    if (!alerts_enabled) return ALERT_CODE_OFF;
-    if (level >= (float)loud_max) return ALERT_CODE_CRITICAL;
-    if (level >= (float)normal_max) return ALERT_CODE_HIGH;
-    return ALERT_CODE_OK;
-}
-
-uint8_t classify_ds18_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm) {
-    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
-    if (temp_c <= (float)low_alarm) return ALERT_CODE_LOW;
-    if (temp_c >= (float)high_alarm) return ALERT_CODE_HIGH;
-    return ALERT_CODE_OK;
-}
-
-uint8_t classify_soil_alert(int category_id, bool no_sensor, bool alerts_enabled) {
-    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
-    switch (category_id) {
-        case 0: return ALERT_CODE_LOW;
-        case 1: return ALERT_CODE_OK;
-        case 2: return ALERT_CODE_MOIST;
-        case 3: return ALERT_CODE_CRITICAL;
-        default: return ALERT_CODE_OFF;
-    }
+int classify_soil_category(float soil, bool no_sensor) {
+    return classify_soil_category_with(soil, no_sensor, get_soil_threshold_dry(), get_soil_threshold_optimal(),
+                                       get_soil_threshold_moist());
 }
 
 void alert_engine_refresh_from_reading(const Reading& reading, bool sound_enabled) {
+    PERF_PROBE_SCOPE(PERF_ALERT_REFRESH);
     uint32_t now_ms = millis();
     const bool temp_no_sensor = isnan(reading.temperature);
     const bool humidity_no_sensor = isnan(reading.humidity);
@@ -268,38 +239,50 @@ void alert_engine_refresh_from_reading(const Reading& reading, bool sound_enable
     const bool soil_alerts_enabled = get_soil_alerts_enabled();
     const bool ds18_no_sensor = reading.temp_ds18b20 < -100.0f;
 
-    const uint8_t codes[(size_t)AlertSensor::Count] = {
-        classify_temp_alert(reading.temperature,
-                            temp_no_sensor,
-                            get_temp_alerts_enabled(),
-                            get_temp_alarm_low(),
-                            get_temp_alarm_high()),
-        classify_humidity_alert(reading.humidity,
-                                humidity_no_sensor,
-                                get_humidity_alerts_enabled(),
-                                get_humidity_threshold_dry(),
-                                get_humidity_threshold_comfort()),
-        classify_light_alert(reading.ldr,
-                             light_alerts_enabled,
-                             get_light_threshold_dim(),
-                             get_light_threshold_bright()),
-        classify_sound_alert(reading.mic,
-                             sound_alerts_enabled,
-                             get_sound_threshold_quiet(),
-                             get_sound_threshold_loud()),
-        classify_soil_alert(classify_soil_category(reading.soil_humidity, soil_no_sensor),
-                            soil_no_sensor,
-                            soil_alerts_enabled),
-        classify_ds18_alert(reading.temp_ds18b20,
-                            ds18_no_sensor,
-                            get_ds18_alerts_enabled(),
-                            get_ds18_alarm_low(),
-                            get_ds18_alarm_high())
+    const AlertInput inputs[(size_t)AlertSensor::Count] = {
+        {reading.temperature,
+         temp_no_sensor,
+         get_temp_alerts_enabled(),
+         get_temp_alarm_low(),
+         0,
+         get_temp_alarm_high()},
+        {reading.humidity,
+         humidity_no_sensor,
+         get_humidity_alerts_enabled(),
+         get_humidity_threshold_dry(),
+         0,
+         get_humidity_threshold_comfort()},
+        {reading.ldr,
+         false,
+         light_alerts_enabled,
+         get_light_threshold_dim(),
+         0,
+         get_light_threshold_bright()},
+        {reading.mic,
+         false,
+         sound_alerts_enabled,
+         get_sound_threshold_quiet(),
+         0,
+         get_sound_threshold_loud()},
+        {reading.soil_humidity,
+         soil_no_sensor,
+         soil_alerts_enabled,
+         get_soil_threshold_dry(),
+         get_soil_threshold_optimal(),
+         get_soil_threshold_moist()},
+        {reading.temp_ds18b20,
+         ds18_no_sensor,
+         get_ds18_alerts_enabled(),
+         get_ds18_alarm_low(),
+         0,
+         get_ds18_alarm_high()}
     };
 
     for (size_t i = 0; i < (size_t)AlertSensor::Count; ++i) {
         AlertSensor sensor = static_cast<AlertSensor>(i);
-        AlertEvent event = update_alert_state(sensor, codes[i], false);
+        const uint8_t code = alert_filter_code(sensor, inputs[i], alert_engine_get_code(sensor), g_filter_state[i],
+                                               now_ms);
+        AlertEvent event = update_alert_state(sensor, code, false, now_ms);
         alert_engine_emit_audio(sensor, event, sound_enabled);
     }
 
@@ -347,9 +330,29 @@ bool alert_engine_has_entry_notice() {
     return active;
 }
 
+size_t alert_engine_get_history(AlertHistoryEntry* out, size_t max_entries, uint32_t after_seq) {
+    size_t count = 0;
+    portENTER_CRITICAL(&g_alert_engine_mux);
+    const uint32_t newest = g_history_seq;
+    uint32_t seq = newest > ALERT_HISTORY_CAPACITY ? newest - ALERT_HISTORY_CAPACITY + 1 : 1;
+    if (after_seq >= seq) seq = after_seq + 1;
+    for (; seq <= newest && count < max_entries; ++seq) {
+        out[count++] = g_history[(seq - 1) % ALERT_HISTORY_CAPACITY];
+    }
+    portEXIT_CRITICAL(&g_alert_engine_mux);
+    return count;
+}
+
+uint32_t alert_engine_history_seq() {
+    portENTER_CRITICAL(&g_alert_engine_mux);
+    const uint32_t seq = g_history_seq;
+    portEXIT_CRITICAL(&g_alert_engine_mux);
+    return seq;
+}
+
 AlertEvent alert_engine_update(AlertSensor sensor, uint8_t code, bool screen_changed) {
-    AlertEvent event = update_alert_state(sensor, code, screen_changed);
     uint32_t now_ms = millis();
+    AlertEvent event = update_alert_state(sensor, code, screen_changed, now_ms);
     portENTER_CRITICAL(&g_alert_engine_mux);
     refresh_global_summary_locked(now_ms);
     portEXIT_CRITICAL(&g_alert_engine_mux);
@@ -370,25 +373,25 @@ void alert_engine_emit_audio(AlertSensor sensor, const AlertEvent& event, bool s
     switch (sensor) {
         case AlertSensor::Temp:
             if (event.code == ALERT_CODE_LOW) {
-                beep(760, 110);
+                beep(760, 110, ToneSource::Alert);
             } else if (event.code == ALERT_CODE_HIGH) {
-                beep(1680, 80);
+                beep(1680, 80, ToneSource::Alert);
             }
             break;
 
         case AlertSensor::Humidity:
             if (event.code == ALERT_CODE_LOW) {
-                beep(1700, 90);
+                beep(1700, 90, ToneSource::Alert);
             } else if (event.code == ALERT_CODE_HIGH) {
-                beep(760, 140);
+                beep(760, 140, ToneSource::Alert);
             }
             break;
 
         case AlertSensor::Light:
             if (event.code == ALERT_CODE_LOW) {
-                beep(860, 70);
+                beep(860, 70, ToneSource::Alert);
             } else if (event.code == ALERT_CODE_HIGH) {
-                beep(1560, 55);
+                beep(1560, 55, ToneSource::Alert);
             }
             break;
 
@@ -398,19 +401,19 @@ void alert_engine_emit_audio(AlertSensor sensor, const AlertEvent& event, bool s
 
         case AlertSensor::Soil:
             if (event.code == ALERT_CODE_LOW) {
-                play_tone_sequence(SOIL_DRY_MELODY, sizeof(SOIL_DRY_MELODY) / sizeof(SOIL_DRY_MELODY[0]));
+                play_tone_sequence(SOIL_DRY_MELODY, sizeof(SOIL_DRY_MELODY) / sizeof(SOIL_DRY_MELODY[0]), ToneSource::Alert);
             } else if (event.code == ALERT_CODE_OK) {
-                play_tone_sequence(SOIL_OK_MELODY, sizeof(SOIL_OK_MELODY) / sizeof(SOIL_OK_MELODY[0]));
+                play_tone_sequence(SOIL_OK_MELODY, sizeof(SOIL_OK_MELODY) / sizeof(SOIL_OK_MELODY[0]), ToneSource::Alert);
             } else if (event.code == ALERT_CODE_CRITICAL) {
-                play_tone_sequence(SOIL_WET_MELODY, sizeof(SOIL_WET_MELODY) / sizeof(SOIL_WET_MELODY[0]));
+                play_tone_sequence(SOIL_WET_MELODY, sizeof(SOIL_WET_MELODY) / sizeof(SOIL_WET_MELODY[0]), ToneSource::Alert);
             }
             break;
 
         case AlertSensor::Ds18:
             if (event.code == ALERT_CODE_LOW) {
-                beep(720, 110);
+                beep(720, 110, ToneSource::Alert);
             } else if (event.code == ALERT_CODE_HIGH) {
-                beep(1760, 80);
+                beep(1760, 80, ToneSource::Alert);
             }
             break;
 
@@ -424,6 +427,7 @@ void alert_engine_reset() {
     for (size_t i = 0; i < (size_t)AlertSensor::Count; ++i) {
         g_current_alert_code[i] = ALERT_CODE_OFF;
         g_last_audio_ms[i] = 0;
+        g_filter_state[i] = {ALERT_CODE_OFF, 0};
     }
     g_global_alert_summary = {
         false,
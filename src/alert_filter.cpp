@@ -0,0 +1,107 @@
+// alert_filter.cpp
+// Alert classifiers and the hysteresis/dwell filter.
+
+#include "alert_filter.h"
+#include <math.h>
+
+int classify_soil_category_with(float soil, bool no_sensor, int dry, int optimal, int moist) {
+    if (no_sensor) return -1;
+    if (soil < (float)dry) return 0;
+    if (soil < (float)optimal) return 1;
+    if (soil < (float)moist) return 2;
+    return 3;
+}
+
+uint8_t classify_temp_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm) {
+    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
+    if (temp_c <= (float)low_alarm) return ALERT_CODE_LOW;
+    if (temp_c >= (float)high_alarm) return ALERT_CODE_HIGH;
+    return ALERT_CODE_OK;
+}
+
+uint8_t classify_humidity_alert(float humidity, bool no_sensor, bool alerts_enabled, int dry_max, int comfort_max) {
+    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
+    if (humidity < (float)dry_max) return ALERT_CODE_LOW;
+    if (humidity > (float)comfort_max) return ALERT_CODE_HIGH;
+    return ALERT_CODE_OK;
+}
+
+uint8_t classify_light_alert(float lux, bool alerts_enabled, int dim_max, int bright_max) {
+    if (!alerts_enabled) return ALERT_CODE_OFF;
+    if (lux < (float)dim_max) return ALERT_CODE_LOW;
+    if (lux >= (float)bright_max) return ALERT_CODE_HIGH;
+    return ALERT_CODE_OK;
+}
+
+uint8_t classify_sound_alert(float level, bool alerts_enabled, int normal_max, int loud_max) {
+    if (!alerts_enabled) return ALERT_CODE_OFF;
+    if (level >= (float)loud_max) return ALERT_CODE_CRITICAL;
+    if (level >= (float)normal_max) return ALERT_CODE_HIGH;
+    return ALERT_CODE_OK;
+}
+
+uint8_t classify_ds18_alert(float temp_c, bool no_sensor, bool alerts_enabled, int low_alarm, int high_alarm) {
+    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
+    if (temp_c <= (float)low_alarm) return ALERT_CODE_LOW;
+    if (temp_c >= (float)high_alarm) return ALERT_CODE_HIGH;
+    return ALERT_CODE_OK;
+}
+
+uint8_t classify_soil_alert(int category_id, bool no_sensor, bool alerts_enabled) {
+    if (no_sensor || !alerts_enabled) return ALERT_CODE_OFF;
+    switch (category_id) {
+        case 0: return ALERT_CODE_LOW;
+        case 1: return ALERT_CODE_OK;
+        case 2: return ALERT_CODE_MOIST;
+        case 3: return ALERT_CODE_CRITICAL;
+        default: return ALERT_CODE_OFF;
+    }
+}
+
+uint8_t alert_classify_input(AlertSensor sensor, const AlertInput& in, float value) {
+    switch (sensor) {
+        case AlertSensor::Temp:
+            return classify_temp_alert(value, in.no_sensor, in.enabled, in.low, in.high);
+        case AlertSensor::Humidity:
+            return classify_humidity_alert(value, in.no_sensor, in.enabled, in.low, in.high);
+        case AlertSensor::Light:
+            return classify_light_alert(value, in.enabled, in.low, in.high);
+        case AlertSensor::Sound:
+            return classify_sound_alert(value, in.enabled, in.low, in.high);
+        case AlertSensor::Soil:
+            return classify_soil_alert(classify_soil_category_with(value, in.no_sensor, in.low, in.mid, in.high),
+                                       in.no_sensor, in.enabled);
+        case AlertSensor::Ds18:
+            return classify_ds18_alert(value, in.no_sensor, in.enabled, in.low, in.high);
+        default:
+            return ALERT_CODE_OFF;
+    }
+}
+
+// Classifiers are monotonic in the value, so probing value +/- band is enough.
+uint8_t alert_filter_code(AlertSensor sensor, const AlertInput& in, uint8_t stable, AlertFilterState& state,
+                          uint32_t now_ms) {
+    const size_t index = (size_t)sensor;
+    const uint8_t raw = alert_classify_input(sensor, in, in.value);
+
+    if (raw == stable || raw == ALERT_CODE_OFF || stable == ALERT_CODE_OFF) {
+        state.pending_code = raw;
+        return raw;
+    }
+
+    const AlertFilterSpec& spec = ALERT_FILTER_SPEC[index];
+    const float rel_band = fabsf(in.value) * (float)spec.band_pct / 100.0f;
+    const float band = rel_band > spec.band_abs ? rel_band : spec.band_abs;
+    if (alert_classify_input(sensor, in, in.value - band) == stable ||
+        alert_classify_input(sensor, in, in.value + band) == stable) {
+        state.pending_code = stable;
+        return stable;
+    }
+
+    if (state.pending_code != raw) {
+        state.pending_code = raw;
+        state.pending_since_ms = now_ms;
+    }
+    if ((uint32_t)(now_ms - state.pending_since_ms) < spec.dwell_ms) return stable;
+    return raw;
+}
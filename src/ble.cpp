@@ -5,12 +5,20 @@
 #include "io.h"
 #include "hw.h"
 #include "config.h"
+#include "perf_probe.h"
+#include "ble_payload.h"
+#include "graph_buffer.h"
+#include "history_stream.h"
+#include "sleep_logger.h"
+#include "telemetry_frame.h"
+#include "alert_engine.h"
+#include "boot_profile.h"
+#include <esp_timer.h>
 
 
-constexpr int DATA_PACKET_LEN = 20;
-
 constexpr char NEW_SERVICE_UUID[] = "4fafc201-1fb5-459e-8fcc-c5c9c331914b";
 constexpr char NEW_CHAR_UUID[]    = "beb5483e-36e1-4688-b7f5-ea07361b26a8";
+constexpr char HISTORY_CHAR_UUID[] = "beb5483f-36e1-4688-b7f5-ea07361b26a8";
 
 constexpr uint16_t LEGACY_SERVICE_UUID16 = 0x181A; // Environmental Sensing
 constexpr uint16_t LEGACY_CHAR_UUID16 = 0x2A6E; // Temperature
@@ -21,85 +29,397 @@ NimBLECharacteristic * pLegacyChar = nullptr;
 
 std::atomic<bool> client_connected{false};
 
+// Notification buffers are reused on every pass so the 10 Hz notify path
+// never touches the heap. notifyAll() can run from the sensor task and from
+// the NimBLE host task (instant request), so the buffers sit behind a mutex.
+static uint8_t g_pkt_buf[DATA_PACKET_LEN];
+static char g_json_buf[JSON_PACKET_MAX_LEN];
+static StaticSemaphore_t g_notify_mutex_storage;
+static SemaphoreHandle_t g_notify_mutex = nullptr;
+
+// ---------------- Telemetry scheduler ----------------
+// A characteristic is notified only when its CCCD is enabled and either a
+// field moved beyond its deadband (rate-limited by the min interval) or the
+// max interval elapsed without any notification (heartbeat).
+constexpr uint8_t  BLE_CMD_INSTANT_PACKET = 0x01;
+constexpr uint8_t  BLE_CMD_SET_RATE       = 0x02;
+constexpr uint8_t  BLE_CMD_SET_FORMAT     = 0x03;
+constexpr uint8_t  BLE_FRAME_LEGACY       = 0x02;   // byte 0 of the 20-byte packet
+constexpr uint16_t TELEMETRY_MIN_INTERVAL_DEFAULT_MS = 100;
+constexpr uint16_t TELEMETRY_MAX_INTERVAL_DEFAULT_MS = 1000;
+constexpr uint16_t TELEMETRY_MIN_INTERVAL_FLOOR_MS   = 100;   // sensor task period
+constexpr uint16_t TELEMETRY_MAX_INTERVAL_CEIL_MS    = 60000;
+
+// Deadbands in the unit of each Reading field.
+constexpr float DEADBAND_TEMP_C    = 0.1f;
+constexpr float DEADBAND_HUM_PCT   = 0.5f;
+constexpr float DEADBAND_LDR_LUX   = 5.0f;
+constexpr float DEADBAND_LDR_REL   = 0.03f; // 3 % above the absolute band
+constexpr float DEADBAND_MIC_PCT   = 2.0f;
+constexpr float DEADBAND_SOIL_PCT  = 1.0f;
+
+struct TelemetryChannel {
+    NimBLECharacteristic* chr;
+    std::atomic<bool> subscribed;
+    bool has_last;              // with last and last_ms, guarded by g_notify_mutex
+    Reading last;
+    uint32_t last_ms;
+};
+
+static TelemetryChannel g_new_channel    = { nullptr, {false}, false, {}, 0 };
+static TelemetryChannel g_legacy_channel = { nullptr, {false}, false, {}, 0 };
+static std::atomic<uint16_t> g_min_interval_ms{TELEMETRY_MIN_INTERVAL_DEFAULT_MS};
+static std::atomic<uint16_t> g_max_interval_ms{TELEMETRY_MAX_INTERVAL_DEFAULT_MS};
+
+// Frame format negotiated on the main characteristic (0x03 command).
+static std::atomic<uint8_t> g_frame_version{BLE_FRAME_LEGACY};
+static TelemetryEncoder g_frame_encoder = {};
+static bool g_frame_force_key = false;
+static uint8_t g_frame_buf[TELEMETRY_FRAME_MAX_LEN];
+
+// ---------------- History download ----------------
+// The graph buffers (or the deep-sleep log) are frozen into a snapshot when a
+// download starts so offsets stay valid across reconnects. Frames are pumped
+// from the sensor task a few at a time; NimBLE queues back-to-back notifications.
+static_assert(HISTORY_MAX_SAMPLES == GRAPH_BUFFER_SIZE, "history snapshot must hold a full graph buffer");
+constexpr uint16_t BLE_PREFERRED_MTU = 247;
+constexpr size_t   HISTORY_FRAME_MAX_LEN = BLE_PREFERRED_MTU - 3;
+constexpr uint8_t  HISTORY_FRAMES_PER_PASS = 6;
+
+static NimBLECharacteristic* pHistoryChar = nullptr;
+static std::atomic<bool> g_history_subscribed{false};
+static std::atomic<uint16_t> g_conn_handle{0xFFFF};
+static HistorySnapshot g_hist_snapshot = {};
+static SleepLogSample g_hist_log_samples[PBIT_ENABLE_LOG_SLEEP ? SLEEP_LOG_HISTORY_MAX : 1];
+static HistoryLogSnapshot g_hist_log = { 0, 0, g_hist_log_samples };
+static uint16_t g_hist_last_id = 0;      // shared by both sources so an id never matches the wrong one
+static HistoryCursor g_hist_cursor = {};
+static HistoryStartRequest g_hist_request = {};
+static bool g_hist_request_pending = false;
+static bool g_hist_notify_ok = false;   // set by HistoryCharCB::onStatus() inside notify()
+static float g_hist_scratch[GRAPH_BUFFER_SIZE];
+static uint8_t g_hist_frame[HISTORY_FRAME_MAX_LEN];
+
+// Usable notification payload for the current connection.
+static size_t peer_payload_limit(size_t cap) {
+    NimBLEServer* server = NimBLEDevice::getServer();
+    if (server && g_conn_handle.load() != 0xFFFF) {
+        const uint16_t mtu = server->getPeerMTU(g_conn_handle.load());
+        if (mtu > 3 && (size_t)(mtu - 3) < cap) cap = mtu - 3;
+    }
+    return cap;
+}
+
 void notifyAll();
 
 
-std::string assm_pkt(const Reading& rec_pkt) {
-    uint8_t buf[DATA_PACKET_LEN];
-    memset(buf, 0, sizeof(buf));
-    buf[0] = 0x02;
-    buf[1] = 0x00;
+static bool field_changed(float prev, float now, float band) {
+    if (isnan(prev) || isnan(now)) return isnan(prev) != isnan(now);
+    return fabsf(now - prev) >= band;
+}
 
-    auto put_u16 = [&](int idx, uint8_t id, uint16_t val) {
-        int base = 2 + idx * 3;
-        buf[base] = id;
-        buf[base + 1] = val & 0xFF;
-        buf[base + 2] = (val >> 8) & 0xFF;
-    };
+static bool reading_changed(const Reading& prev, const Reading& now) {
+    const bool prev_ds18 = prev.temp_ds18b20 >= -100.0f;
+    const bool now_ds18  = now.temp_ds18b20 >= -100.0f;
+    if (prev_ds18 != now_ds18) return true;
+    if (now_ds18 && fabsf(now.temp_ds18b20 - prev.temp_ds18b20) >= DEADBAND_TEMP_C) return true;
 
-    auto put_s16 = [&](int idx, uint8_t id, int16_t val) {
-        int base = 2 + idx * 3;
-        uint16_t raw = (uint16_t)val; // serializar en complemento a dos little-endian
-        buf[base] = id;
-        buf[base + 1] = raw & 0xFF;
-        buf[base + 2] = (raw >> 8) & 0xFF;
-    };
+    const float ldr_band = fmaxf(DEADBAND_LDR_LUX, fabsf(prev.ldr) * DEADBAND_LDR_REL);
+    return field_changed(prev.temperature,   now.temperature,   DEADBAND_TEMP_C)
+        || field_changed(prev.humidity,      now.humidity,      DEADBAND_HUM_PCT)
+        || field_changed(prev.ldr,           now.ldr,           ldr_band)
+        || field_changed(prev.mic,           now.mic,           DEADBAND_MIC_PCT)
+        || field_changed(prev.soil_humidity, now.soil_humidity, DEADBAND_SOIL_PCT);
+}
+
+static int32_t frame_x10(float v) {
+    return isnan(v) ? TELEMETRY_INVALID : (int32_t)lroundf(v * 10.0f);
+}
+
+static int32_t frame_int(float v) {
+    return isnan(v) ? TELEMETRY_INVALID : (int32_t)lroundf(v);
+}
 
-    // IDs 1 (temp) y 6 (ds18) viajan como int16_t x10 para soportar negativos.
-    int16_t  t10   = isnan(rec_pkt.temperature)   ? 0 : (int16_t)lroundf(rec_pkt.temperature * 10.0f);
-    uint16_t h10   = isnan(rec_pkt.humidity)      ? 0 : (uint16_t)lroundf(rec_pkt.humidity * 10.0f);
-    uint16_t lraw  = isnan(rec_pkt.ldr)           ? 0 : (uint16_t)lroundf(rec_pkt.ldr);
-    uint16_t mraw  = isnan(rec_pkt.mic)           ? 0 : (uint16_t)lroundf(rec_pkt.mic);
-    uint16_t soil  = isnan(rec_pkt.soil_humidity) ? 0 : (uint16_t)lroundf(rec_pkt.soil_humidity);
-    int16_t  ds18  = (rec_pkt.temp_ds18b20 < -100.0f) ? 0 : (int16_t)lroundf(rec_pkt.temp_ds18b20 * 10.0f);
-
-    put_s16(0, 1, t10);
-    put_u16(1, 2, h10);
-    put_u16(2, 3, lraw);
-    put_u16(3, 4, mraw);
-    put_u16(4, 5, soil);
-    put_s16(5, 6, ds18);
-
-    return std::string((char*)buf, sizeof(buf));
-}
-
-String makeJson(const Reading& rec_pkt) {
-    String s = "{";
-    if (!isnan(rec_pkt.temperature)) s += "\"temp\":" + String(rec_pkt.temperature, 1) + ",";
-    if (!isnan(rec_pkt.humidity))    s += "\"hum\":"  + String(rec_pkt.humidity, 1)  + ",";
-    if (!isnan(rec_pkt.ldr))         s += "\"ldr\":"  + String((int)rec_pkt.ldr) + ",";
-    if (!isnan(rec_pkt.mic))         s += "\"mic\":"  + String((int)rec_pkt.mic) + ",";
-    if (!isnan(rec_pkt.soil_humidity)) s += "\"soil\":" + String((int)rec_pkt.soil_humidity) + ",";
-    if (rec_pkt.temp_ds18b20 >= -100.0f) s += "\"ds18\":" + String(rec_pkt.temp_ds18b20, 1) + ",";
-    if (s[s.length() - 1] == ',') s.remove(s.length() - 1);
-    s += "}";
+static TelemetrySample make_frame_sample(const Reading& r, uint32_t now_ms) {
+    TelemetrySample s = {};
+    s.timestamp_ms = now_ms;
+    s.temp_x10 = frame_x10(r.temperature);
+    s.hum_x10 = frame_x10(r.humidity);
+    s.ldr_lux = frame_int(r.ldr);
+    s.mic = frame_int(r.mic);
+    s.soil = frame_int(r.soil_humidity);
+    s.ldr_raw = frame_int(r.ldr_raw);
+    if (r.temp_ds18b20 >= -100.0f) {
+        s.ds18_count = 1;
+        s.ds18_x10[0] = frame_x10(r.temp_ds18b20);
+    }
+    for (uint8_t i = 0; i < (uint8_t)AlertSensor::Count; ++i) {
+        s.alert_codes |= (uint32_t)(alert_engine_get_code((AlertSensor)i) & 0x07) << (i * 3);
+    }
     return s;
 }
 
+// Caller holds g_notify_mutex.
+static void send_channel(TelemetryChannel& ch, const Reading& snapshot, uint32_t now_ms) {
+    if (&ch == &g_new_channel) {
+        if (g_frame_version.load() == TELEMETRY_FRAME_VERSION) {
+            // v3 is only accepted once the payload holds TELEMETRY_FRAME_MAX_LEN.
+            const TelemetrySample sample = make_frame_sample(snapshot, now_ms);
+            const size_t len = telemetry_encode(g_frame_encoder, sample, g_frame_force_key,
+                                                g_frame_buf, peer_payload_limit(sizeof(g_frame_buf)));
+            if (len == 0) return;
+            g_frame_force_key = false;
+            ch.chr->setValue(g_frame_buf, len);
+        } else {
+            size_t len;
+            {
+                PERF_PROBE_SCOPE(PERF_BLE_PKT);
+                len = assm_pkt(snapshot, g_pkt_buf);
+            }
+            ch.chr->setValue(g_pkt_buf, len);
+        }
+    } else {
+        size_t js_len;
+        {
+            PERF_PROBE_SCOPE(PERF_BLE_JSON);
+            js_len = makeJson(snapshot, g_json_buf, sizeof(g_json_buf));
+        }
+        ch.chr->setValue((const uint8_t*)g_json_buf, js_len);
+    }
+    // NimBLE copies the value into the attribute storage, which only grows
+    // the first time a longer payload is set and is reused afterwards.
+    ch.chr->notify();
+    ch.last = snapshot;
+    ch.has_last = true;
+    ch.last_ms = now_ms;
+}
+
+static bool channel_due(const TelemetryChannel& ch, const Reading& snapshot, uint32_t now_ms) {
+    if (!ch.chr || !ch.subscribed.load()) return false;
+    if (!ch.has_last) return true;
+
+    const uint32_t elapsed = now_ms - ch.last_ms;
+    if (elapsed >= g_max_interval_ms.load()) return true;
+    if (elapsed < g_min_interval_ms.load()) return false;
+    return reading_changed(ch.last, snapshot);
+}
+
+static void reset_telemetry_session() {
+    if (!g_notify_mutex) return;
+    xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+    g_new_channel.subscribed = false;
+    g_legacy_channel.subscribed = false;
+    g_new_channel.has_last = false;
+    g_legacy_channel.has_last = false;
+    g_min_interval_ms = TELEMETRY_MIN_INTERVAL_DEFAULT_MS;
+    g_max_interval_ms = TELEMETRY_MAX_INTERVAL_DEFAULT_MS;
+    g_frame_version = BLE_FRAME_LEGACY;
+    telemetry_encoder_reset(g_frame_encoder);
+    g_history_subscribed = false;
+    g_conn_handle = 0xFFFF;
+    // The snapshot is kept so a client can resume after reconnecting.
+    g_hist_cursor.active = false;
+    xSemaphoreGive(g_notify_mutex);
+}
+
+// Caller holds g_notify_mutex.
+static uint16_t history_next_id() {
+    if (++g_hist_last_id == 0) g_hist_last_id = 1;
+    return g_hist_last_id;
+}
+
+// Caller holds g_notify_mutex.
+static void history_take_snapshot() {
+    struct Source { const GraphBuffer* buf; uint8_t scale; };
+    // Same order as the sensor ids: temp, hum, ldr, mic, soil, ds18.
+    const Source sources[HISTORY_SENSOR_COUNT] = {
+        { &g_graph_temp, 10 },
+        { &g_graph_humidity, 10 },
+        { &g_graph_light, 1 },      // up to 20000 lux, does not fit x10
+        { &g_graph_sound, 10 },
+        { &g_graph_soil, 10 },
+        { &g_graph_ds18, 10 },
+    };
+
+    g_hist_snapshot.id = history_next_id();
+
+    for (uint8_t i = 0; i < HISTORY_SENSOR_COUNT; ++i) {
+        portENTER_CRITICAL(&g_graph_mux);
+        const size_t n = graph_buffer_get(*sources[i].buf, g_hist_scratch, GRAPH_BUFFER_SIZE);
+        portEXIT_CRITICAL(&g_graph_mux);
+
+        g_hist_snapshot.count[i] = (uint16_t)n;
+        g_hist_snapshot.scale[i] = sources[i].scale;
+        for (size_t k = 0; k < n; ++k) {
+            g_hist_snapshot.samples[i][k] = history_quantize(g_hist_scratch[k], sources[i].scale);
+        }
+    }
+}
+
+// Caller holds g_notify_mutex. The log is archived in setup() before BLE
+// starts and does not change while awake; reading it back from NVS only
+// happens on a new snapshot.
+static void history_take_log_snapshot() {
+    g_hist_log.id = history_next_id();
+    g_hist_log.count = (uint16_t)sleep_logger_read(g_hist_log_samples,
+                                                   sizeof(g_hist_log_samples) / sizeof(g_hist_log_samples[0]));
+}
+
+// Caller holds g_notify_mutex.
+static void history_pump() {
+    if (!pHistoryChar || !g_history_subscribed.load()) return;
+
+    if (g_hist_request_pending) {
+        g_hist_request_pending = false;
+        const uint16_t id = g_hist_request.snapshot_id;
+        if (g_hist_request.source == HISTORY_SOURCE_SLEEP_LOG) {
+            if (id == 0 || id != g_hist_log.id) history_take_log_snapshot();
+            history_log_cursor_begin(g_hist_cursor, g_hist_log, g_hist_request);
+        } else {
+            if (id == 0 || id != g_hist_snapshot.id) history_take_snapshot();
+            history_cursor_begin(g_hist_cursor, g_hist_snapshot, g_hist_request);
+        }
+    }
+    if (!g_hist_cursor.active) return;
+
+    const size_t cap = peer_payload_limit(HISTORY_FRAME_MAX_LEN);
+
+    for (uint8_t i = 0; i < HISTORY_FRAMES_PER_PASS; ++i) {
+        // Encode from a copy: the cursor only moves once the frame is queued.
+        HistoryCursor next = g_hist_cursor;
+        const size_t len = (next.source == HISTORY_SOURCE_SLEEP_LOG)
+                               ? history_log_encode_next(g_hist_log, next, g_hist_frame, cap)
+                               : history_encode_next(g_hist_snapshot, next, g_hist_frame, cap);
+        if (len == 0) break;
+        pHistoryChar->setValue(g_hist_frame, len);
+        g_hist_notify_ok = false;
+        pHistoryChar->notify();
+        // Out of mbufs or no subscriber: the same frame is encoded again next pass.
+        if (!g_hist_notify_ok) break;
+        g_hist_cursor = next;
+    }
+}
+
 // ======================================================
 // BLE CALLBACKS
 // ======================================================
 // ---------------- BLE callbacks ----------------
 class ServerCB : public NimBLEServerCallbacks {
   void onConnect(NimBLEServer*) override { client_connected = true; }
+  void onConnect(NimBLEServer*, ble_gap_conn_desc* desc) override {
+    g_conn_handle = desc->conn_handle;
+  }
   void onDisconnect(NimBLEServer*) override {
     client_connected = false;
+    reset_telemetry_session();
     NimBLEDevice::startAdvertising();
   }
 };
 
-class NewCharCB : public NimBLECharacteristicCallbacks {
+// Tracks the CCCD of each notify characteristic. A fresh subscription
+// clears the channel history so the client gets a packet right away.
+class TelemetryCharCB : public NimBLECharacteristicCallbacks {
+public:
+  explicit TelemetryCharCB(TelemetryChannel& channel) : channel_(channel) {}
+
+  // Runs on the NimBLE host task while the sensor task may be inside
+  // send_channel(), so has_last is reset under the same mutex. A v3 client
+  // that resubscribes has lost the delta base too: start with a keyframe.
+  void onSubscribe(NimBLECharacteristic*, ble_gap_conn_desc*, uint16_t subValue) override {
+    if (!g_notify_mutex) return;
+    const bool on = (subValue & 0x0001) != 0;
+    xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+    if (on && !channel_.subscribed.load()) {
+      channel_.has_last = false;
+      if (&channel_ == &g_new_channel) g_frame_force_key = true;
+    }
+    channel_.subscribed = on;
+    xSemaphoreGive(g_notify_mutex);
+  }
+
+protected:
+  TelemetryChannel& channel_;
+};
+
+class NewCharCB : public TelemetryCharCB {
+public:
+  NewCharCB() : TelemetryCharCB(g_new_channel) {}
+
   void onWrite(NimBLECharacteristic* c) override {
     std::string v = c->getValue();
-    if (!v.empty() && (uint8_t)v[0] == 0x01) {
-      // Web requests an instant packet
+    if (v.empty()) return;
+
+    const uint8_t cmd = (uint8_t)v[0];
+    if (cmd == BLE_CMD_INSTANT_PACKET) {
+      // Web requests an instant packet (a v3 key frame, to resync a client)
+      if (g_notify_mutex) {
+        xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+        g_frame_force_key = true;
+        xSemaphoreGive(g_notify_mutex);
+      }
       notifyAll();
+    } else if (cmd == BLE_CMD_SET_RATE && v.size() >= 3) {
+      // 0x02 <min_ms u16 LE> [<max_ms u16 LE>]
+      uint16_t min_ms = (uint8_t)v[1] | ((uint16_t)(uint8_t)v[2] << 8);
+      uint16_t max_ms = (v.size() >= 5)
+          ? (uint16_t)((uint8_t)v[3] | ((uint16_t)(uint8_t)v[4] << 8))
+          : g_max_interval_ms.load();
+      min_ms = constrain(min_ms, TELEMETRY_MIN_INTERVAL_FLOOR_MS, TELEMETRY_MAX_INTERVAL_CEIL_MS);
+      max_ms = constrain(max_ms, min_ms, TELEMETRY_MAX_INTERVAL_CEIL_MS);
+      g_min_interval_ms = min_ms;
+      g_max_interval_ms = max_ms;
+      DPRINT("[BLE] Telemetry rate: min=%u ms max=%u ms\n", min_ms, max_ms);
+    } else if (cmd == BLE_CMD_SET_FORMAT && v.size() >= 2 && g_notify_mutex) {
+      // 0x03 <version>: 3 selects the delta frame, anything else the 20-byte packet.
+      // v3 is refused until the MTU exchange leaves room for a full key frame;
+      // the client keeps getting 0x02 packets and can ask again.
+      uint8_t version = ((uint8_t)v[1] == TELEMETRY_FRAME_VERSION) ? TELEMETRY_FRAME_VERSION : BLE_FRAME_LEGACY;
+      if (version == TELEMETRY_FRAME_VERSION &&
+          peer_payload_limit(TELEMETRY_FRAME_MAX_LEN) < TELEMETRY_FRAME_MAX_LEN) {
+        DPRINTLN("[BLE] Frame v3 refused: MTU too small.");
+        version = BLE_FRAME_LEGACY;
+      }
+      xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+      g_frame_version = version;
+      telemetry_encoder_reset(g_frame_encoder);
+      g_new_channel.has_last = false;
+      xSemaphoreGive(g_notify_mutex);
+    }
+  }
+};
+
+// History characteristic: start/resume/abort commands plus its CCCD.
+class HistoryCharCB : public NimBLECharacteristicCallbacks {
+  void onSubscribe(NimBLECharacteristic*, ble_gap_conn_desc*, uint16_t subValue) override {
+    g_history_subscribed = (subValue & 0x0001) != 0;
+  }
+
+  // Called from notify() on the pumping task, which holds g_notify_mutex.
+  void onStatus(NimBLECharacteristic*, Status s, int) override {
+    g_hist_notify_ok = (s == Status::SUCCESS_NOTIFY);
+  }
+
+  void onWrite(NimBLECharacteristic* c) override {
+    std::string v = c->getValue();
+    if (v.empty() || !g_notify_mutex) return;
+
+    HistoryStartRequest req;
+    xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+    if (history_parse_start((const uint8_t*)v.data(), v.size(), req)) {
+      g_hist_request = req;
+      g_hist_request_pending = true;
+    } else if ((uint8_t)v[0] == HISTORY_CMD_ABORT) {
+      g_hist_request_pending = false;
+      g_hist_cursor.active = false;
     }
+    xSemaphoreGive(g_notify_mutex);
   }
 };
 
 
 void notifyAll() {
+    if (!g_notify_mutex) return;
+
     Reading snapshot;
     
     // Snapshot seguro usando el spinlock
@@ -107,25 +427,30 @@ void notifyAll() {
     snapshot = global_readings;
     portEXIT_CRITICAL(&readings_mux);
 
-    std::string pkt = assm_pkt(snapshot);
-    String js = makeJson(snapshot);
+    const uint32_t now_ms = millis();
+    xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+    if (g_new_channel.chr && g_new_channel.subscribed.load()) send_channel(g_new_channel, snapshot, now_ms);
+    if (g_legacy_channel.chr && g_legacy_channel.subscribed.load()) send_channel(g_legacy_channel, snapshot, now_ms);
+    xSemaphoreGive(g_notify_mutex);
+}
 
-    if (pNewChar) {
-        pNewChar->setValue(pkt);
-        pNewChar->notify();
-    }
+void ble_service_telemetry(const Reading& snapshot, uint32_t now_ms) {
+    if (!g_notify_mutex || !client_connected.load()) return;
 
-    if (pLegacyChar) {
-        pLegacyChar->setValue((uint8_t*)js.c_str(), js.length());
-        pLegacyChar->notify();
-    }
+    xSemaphoreTake(g_notify_mutex, portMAX_DELAY);
+    if (channel_due(g_new_channel, snapshot, now_ms)) send_channel(g_new_channel, snapshot, now_ms);
+    if (channel_due(g_legacy_channel, snapshot, now_ms)) send_channel(g_legacy_channel, snapshot, now_ms);
+    history_pump();
+    xSemaphoreGive(g_notify_mutex);
 }
 
 
 void init_ble() {
+    g_notify_mutex = xSemaphoreCreateMutexStatic(&g_notify_mutex_storage);
 
     NimBLEDevice::init(dev_name);
     NimBLEDevice::setPower(ESP_PWR_LVL_P9);
+    NimBLEDevice::setMTU(BLE_PREFERRED_MTU);
 
     NimBLEServer *pServer = NimBLEDevice::createServer();
     pServer->setCallbacks(new ServerCB());
@@ -136,6 +461,13 @@ void init_ble() {
         NIMBLE_PROPERTY::NOTIFY | NIMBLE_PROPERTY::WRITE
     );
     pNewChar->setCallbacks(new NewCharCB());
+    g_new_channel.chr = pNewChar;
+
+    pHistoryChar = newSvc->createCharacteristic(
+        HISTORY_CHAR_UUID,
+        NIMBLE_PROPERTY::NOTIFY | NIMBLE_PROPERTY::WRITE
+    );
+    pHistoryChar->setCallbacks(new HistoryCharCB());
     newSvc->start();
 
     NimBLEService *legSvc = pServer->createService(NimBLEUUID(LEGACY_SERVICE_UUID16));
@@ -143,6 +475,8 @@ void init_ble() {
         NimBLEUUID(LEGACY_CHAR_UUID16),
         NIMBLE_PROPERTY::NOTIFY
     );
+    pLegacyChar->setCallbacks(new TelemetryCharCB(g_legacy_channel));
+    g_legacy_channel.chr = pLegacyChar;
     legSvc->start();
 
     NimBLEAdvertising *adv = NimBLEDevice::getAdvertising();
@@ -152,3 +486,19 @@ void init_ble() {
 
     DPRINTLN("[BLE] Advertising started");
 }
+
+static void ble_init_task(void*) {
+    const int64_t start_us = esp_timer_get_time();
+    init_ble();
+    boot_profile_record_async("ble_init", (uint32_t)(esp_timer_get_time() - start_us));
+    vTaskDelete(NULL);
+}
+
+void init_ble_async() {
+    // NimBLE host bring-up takes a while; keep it off the setup() path.
+    BaseType_t ok = xTaskCreatePinnedToCore(ble_init_task, "BleInit", 4096, NULL, 1, NULL, 0);
+    if (ok != pdPASS) {
+        DPRINTLN("[BLE] Init task failed, initializing inline.");
+        init_ble();
+    }
+}
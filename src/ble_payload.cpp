@@ -0,0 +1,136 @@
+// ble_payload.cpp
+// 20-byte packet and JSON encoders for the legacy BLE characteristics.
+
+#include "ble_payload.h"
+#include <math.h>
+#include <string.h>
+
+size_t assm_pkt(const Reading& rec_pkt, uint8_t* buf) {
+    memset(buf, 0, DATA_PACKET_LEN);
+    buf[0] = 0x02;
+    buf[1] = 0x00;
+
+    auto put_u16 = [&](int idx, uint8_t id, uint16_t val) {
+        int base = 2 + idx * 3;
+        buf[base] = id;
+        buf[base + 1] = val & 0xFF;
+        buf[base + 2] = (val >> 8) & 0xFF;
+    };
+
+    auto put_s16 = [&](int idx, uint8_t id, int16_t val) {
+        int base = 2 + idx * 3;
+        uint16_t raw = (uint16_t)val; // serializar en complemento a dos little-endian
+        buf[base] = id;
+        buf[base + 1] = raw & 0xFF;
+        buf[base + 2] = (raw >> 8) & 0xFF;
+    };
+
+    // IDs 1 (temp) y 6 (ds18) viajan como int16_t x10 para soportar negativos.
+    int16_t  t10   = isnan(rec_pkt.temperature)   ? 0 : (int16_t)lroundf(rec_pkt.temperature * 10.0f);
+    uint16_t h10   = isnan(rec_pkt.humidity)      ? 0 : (uint16_t)lroundf(rec_pkt.humidity * 10.0f);
+    uint16_t lraw  = isnan(rec_pkt.ldr)           ? 0 : (uint16_t)lroundf(rec_pkt.ldr);
+    uint16_t mraw  = isnan(rec_pkt.mic)           ? 0 : (uint16_t)lroundf(rec_pkt.mic);
+    uint16_t soil  = isnan(rec_pkt.soil_humidity) ? 0 : (uint16_t)lroundf(rec_pkt.soil_humidity);
+    int16_t  ds18  = (rec_pkt.temp_ds18b20 < -100.0f) ? 0 : (int16_t)lroundf(rec_pkt.temp_ds18b20 * 10.0f);
+
+    put_s16(0, 1, t10);
+    put_u16(1, 2, h10);
+    put_u16(2, 3, lraw);
+    put_u16(3, 4, mraw);
+    put_u16(4, 5, soil);
+    put_s16(5, 6, ds18);
+
+    return DATA_PACKET_LEN;
+}
+
+namespace {
+
+// Minimal append-only writer for the JSON payload. Integer formatting only,
+// so nothing here can reach newlib's float/dtoa allocator.
+struct JsonWriter {
+    char* p;
+    char* end;
+
+    void put(char c) {
+        if (p < end) *p++ = c;
+    }
+
+    void put(const char* s) {
+        while (*s) put(*s++);
+    }
+
+    void put_uint(uint32_t v) {
+        char digits[10];
+        int n = 0;
+        do {
+            digits[n++] = (char)('0' + (v % 10));
+            v /= 10;
+        } while (v != 0);
+        while (n > 0) put(digits[--n]);
+    }
+
+    void put_int(int32_t v) {
+        if (v < 0) {
+            put('-');
+            put_uint((uint32_t)(-(int64_t)v));
+        } else {
+            put_uint((uint32_t)v);
+        }
+    }
+
+    // Print a value already scaled x10 as "<int>.<dec>".
+    void put_fixed1(int32_t v10) {
+        if (v10 < 0) {
+            put('-');
+            v10 = -v10;
+        }
+        put_uint((uint32_t)(v10 / 10));
+        put('.');
+        put((char)('0' + (v10 % 10)));
+    }
+
+    void field(const char* key, bool& first) {
+        if (!first) put(',');
+        first = false;
+        put('"');
+        put(key);
+        put("\":");
+    }
+};
+
+} // namespace
+
+size_t makeJson(const Reading& rec_pkt, char* out, size_t out_size) {
+    if (out_size == 0) return 0;
+
+    JsonWriter w = { out, out + out_size - 1 };
+    bool first = true;
+    w.put('{');
+    if (!isnan(rec_pkt.temperature)) {
+        w.field("temp", first);
+        w.put_fixed1((int32_t)lroundf(rec_pkt.temperature * 10.0f));
+    }
+    if (!isnan(rec_pkt.humidity)) {
+        w.field("hum", first);
+        w.put_fixed1((int32_t)lroundf(rec_pkt.humidity * 10.0f));
+    }
+    if (!isnan(rec_pkt.ldr)) {
+        w.field("ldr", first);
+        w.put_int((int32_t)rec_pkt.ldr);
+    }
+    if (!isnan(rec_pkt.mic)) {
+        w.field("mic", first);
+        w.put_int((int32_t)rec_pkt.mic);
+    }
+    if (!isnan(rec_pkt.soil_humidity)) {
+        w.field("soil", first);
+        w.put_int((int32_t)rec_pkt.soil_humidity);
+    }
+    if (rec_pkt.temp_ds18b20 >= -100.0f) {
+        w.field("ds18", first);
+        w.put_fixed1((int32_t)lroundf(rec_pkt.temp_ds18b20 * 10.0f));
+    }
+    w.put('}');
+    *w.p = '\0';
+    return (size_t)(w.p - out);
+}
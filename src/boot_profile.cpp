@@ -0,0 +1,98 @@
+// boot_profile.cpp
+// Boot phase timing and first-pixel tracking.
+
+#include "boot_profile.h"
+#include "config.h"
+#include <esp_attr.h>
+#include <esp_timer.h>
+
+namespace {
+
+constexpr size_t MAX_BOOT_PHASES = 12;
+
+struct BootPhaseRecord {
+    const char* name;
+    uint32_t duration_us;
+    bool async;
+};
+
+struct BootKindStats {
+    uint32_t last_ms;
+    uint32_t best_ms;
+    uint32_t samples;
+};
+
+portMUX_TYPE g_boot_mux = portMUX_INITIALIZER_UNLOCKED;
+BootPhaseRecord g_phases[MAX_BOOT_PHASES];
+size_t g_phase_count = 0;
+const char* g_open_phase = nullptr;
+int64_t g_open_phase_start_us = 0;
+BootKind g_kind = BOOT_KIND_COLD;
+bool g_first_pixel_done = false;
+
+// Survives deep sleep; reset on power loss.
+RTC_DATA_ATTR BootKindStats g_rtc_boot_stats[BOOT_KIND_COUNT];
+
+const char* const kKindNames[BOOT_KIND_COUNT] = { "cold", "wake" };
+
+void push_phase(const char* name, uint32_t duration_us, bool async) {
+    portENTER_CRITICAL(&g_boot_mux);
+    if (g_phase_count < MAX_BOOT_PHASES) {
+        g_phases[g_phase_count++] = { name, duration_us, async };
+    }
+    portEXIT_CRITICAL(&g_boot_mux);
+}
+
+} // namespace
+
+void boot_profile_set_kind(BootKind kind) {
+    g_kind = kind;
+}
+
+void boot_phase_begin(const char* name) {
+    boot_phase_end();
+    g_open_phase = name;
+    g_open_phase_start_us = esp_timer_get_time();
+}
+
+void boot_phase_end() {
+    if (!g_open_phase) return;
+    push_phase(g_open_phase, (uint32_t)(esp_timer_get_time() - g_open_phase_start_us), false);
+    g_open_phase = nullptr;
+}
+
+void boot_profile_record_async(const char* name, uint32_t duration_us) {
+    push_phase(name, duration_us, true);
+    DPRINT("[Boot] async %s: %lu ms\n", name, (unsigned long)(duration_us / 1000));
+}
+
+void boot_profile_mark_first_pixel() {
+    if (g_first_pixel_done) return;
+    g_first_pixel_done = true;
+
+    // esp_timer counts from its own init, shortly before app_main(), so this
+    // is app start-up plus setup(). ROM, bootloader and app-image load come
+    // before that and are not included.
+    const uint32_t first_pixel_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+    BootKindStats& stats = g_rtc_boot_stats[g_kind];
+    stats.last_ms = first_pixel_ms;
+    if (stats.samples == 0 || first_pixel_ms < stats.best_ms) stats.best_ms = first_pixel_ms;
+    stats.samples++;
+
+    DPRINT("[Boot] %s boot -> first pixel: %lu ms after app start (best %lu ms over %lu boots)\n",
+           kKindNames[g_kind],
+           (unsigned long)first_pixel_ms,
+           (unsigned long)stats.best_ms,
+           (unsigned long)stats.samples);
+
+    portENTER_CRITICAL(&g_boot_mux);
+    const size_t n = g_phase_count;
+    portEXIT_CRITICAL(&g_boot_mux);
+    for (size_t i = 0; i < n; ++i) {
+        DPRINT("[Boot]   %-10s %6lu us%s\n",
+               g_phases[i].name,
+               (unsigned long)g_phases[i].duration_us,
+               g_phases[i].async ? " (async)" : "");
+    }
+}
@@ -0,0 +1,68 @@
+// dht_decode.cpp
+// Pulse-train decoder for the DHT11 single-wire response.
+
+#include "dht_decode.h"
+
+namespace {
+
+// Generous windows: DHT11 units and the pull-up stretch the nominal values.
+constexpr uint16_t DHT_RESPONSE_MIN_US = 60;
+constexpr uint16_t DHT_RESPONSE_MAX_US = 110;
+constexpr uint16_t DHT_BIT_LOW_MIN_US = 30;
+constexpr uint16_t DHT_BIT_LOW_MAX_US = 80;
+constexpr uint16_t DHT_BIT_HIGH_MIN_US = 10;
+constexpr uint16_t DHT_BIT_HIGH_MAX_US = 95;
+constexpr uint16_t DHT_BIT_ONE_US = 48;     // highs longer than this are 1s
+
+bool in_window(uint16_t us, uint16_t lo, uint16_t hi) { return us >= lo && us <= hi; }
+
+} // namespace
+
+DhtDecodeStatus dht_decode_pulses(const DhtPulse* pulses, size_t count, DhtFrame* out) {
+    size_t i = 0;
+    for (; i + 1 < count; ++i) {
+        if (pulses[i].level == 0 && pulses[i + 1].level == 1
+            && in_window(pulses[i].us, DHT_RESPONSE_MIN_US, DHT_RESPONSE_MAX_US)
+            && in_window(pulses[i + 1].us, DHT_RESPONSE_MIN_US, DHT_RESPONSE_MAX_US)) {
+            break;
+        }
+    }
+    if (i + 1 >= count) return DhtDecodeStatus::NoResponse;
+    i += 2;
+
+    uint8_t bytes[5] = { 0, 0, 0, 0, 0 };
+    for (uint8_t bit = 0; bit < 40; ++bit, i += 2) {
+        if (i + 1 >= count) return DhtDecodeStatus::ShortFrame;
+        const DhtPulse& low = pulses[i];
+        const DhtPulse& high = pulses[i + 1];
+        if (low.level != 0 || high.level != 1
+            || !in_window(low.us, DHT_BIT_LOW_MIN_US, DHT_BIT_LOW_MAX_US)
+            || !in_window(high.us, DHT_BIT_HIGH_MIN_US, DHT_BIT_HIGH_MAX_US)) {
+            return DhtDecodeStatus::BadTiming;
+        }
+        bytes[bit / 8] = (uint8_t)((bytes[bit / 8] << 1) | (high.us > DHT_BIT_ONE_US ? 1 : 0));
+    }
+
+    if ((uint8_t)(bytes[0] + bytes[1] + bytes[2] + bytes[3]) != bytes[4]) return DhtDecodeStatus::Checksum;
+    for (int b = 0; b < 5; ++b) out->bytes[b] = bytes[b];
+    return DhtDecodeStatus::Ok;
+}
+
+void dht11_frame_values(const DhtFrame& frame, float* humidity, float* temp_c) {
+    *humidity = frame.bytes[0] + frame.bytes[1] * 0.1f;
+    float t = frame.bytes[2];
+    if (frame.bytes[3] & 0x80) t = -1.0f - t;
+    t += (frame.bytes[3] & 0x0F) * 0.1f;
+    *temp_c = t;
+}
+
+const char* dht_decode_status_name(DhtDecodeStatus status) {
+    switch (status) {
+        case DhtDecodeStatus::Ok:         return "ok";
+        case DhtDecodeStatus::NoResponse: return "no response";
+        case DhtDecodeStatus::ShortFrame: return "short frame";
+        case DhtDecodeStatus::BadTiming:  return "bad timing";
+        case DhtDecodeStatus::Checksum:   return "checksum";
+    }
+    return "?";
+}
@@ -0,0 +1,126 @@
+// dht_rmt.cpp
+// DHT11 driver: GPIO start pulse, RMT capture of the response, host-side decode.
+
+#include "dht_rmt.h"
+#include "dht_decode.h"
+#include "config.h"
+#include <driver/gpio.h>
+#include <driver/rmt.h>
+#include <freertos/ringbuf.h>
+#include <math.h>
+
+namespace {
+
+constexpr rmt_channel_t DHT_RMT_CHANNEL = RMT_CHANNEL_4;
+constexpr uint8_t DHT_RMT_CLK_DIV = 80;                 // 1 µs ticks from the 80 MHz APB
+constexpr uint16_t DHT_RMT_IDLE_US = 200;               // longest DHT level is ~80 µs
+constexpr uint8_t DHT_RMT_FILTER_TICKS = 100;           // APB ticks: drop glitches < 1.25 µs
+constexpr size_t DHT_RMT_RINGBUF_BYTES = 512;
+constexpr uint32_t DHT_START_LOW_MS = 20;               // DHT11 wants >= 18 ms
+constexpr uint32_t DHT_RX_TIMEOUT_MS = 10;              // a full response takes ~4.5 ms
+constexpr size_t DHT_MAX_PULSES = 96;                   // 2 response + 80 bit levels + slack
+
+gpio_num_t g_pin = GPIO_NUM_NC;
+RingbufHandle_t g_rx_ring = nullptr;
+bool g_have_result = false;
+uint32_t g_last_read_ms = 0;
+bool g_last_ok = false;
+float g_last_humidity = NAN;
+float g_last_temp_c = NAN;
+
+void drain_rx_ring() {
+    size_t size = 0;
+    void* item;
+    while ((item = xRingbufferReceive(g_rx_ring, &size, 0)) != nullptr) {
+        vRingbufferReturnItem(g_rx_ring, item);
+    }
+}
+
+// Start pulse, then capture until the line idles. Returns the pulse count.
+size_t capture_response(DhtPulse* pulses, size_t max_pulses) {
+    gpio_set_level(g_pin, 0);
+    vTaskDelay(pdMS_TO_TICKS(DHT_START_LOW_MS));
+
+    drain_rx_ring();
+    rmt_rx_start(DHT_RMT_CHANNEL, true);
+    gpio_set_level(g_pin, 1);   // release; the pull-up raises the line and the sensor answers
+
+    size_t size = 0;
+    rmt_item32_t* items = (rmt_item32_t*)xRingbufferReceive(g_rx_ring, &size, pdMS_TO_TICKS(DHT_RX_TIMEOUT_MS));
+    rmt_rx_stop(DHT_RMT_CHANNEL);
+    if (!items) return 0;
+
+    size_t count = 0;
+    const size_t item_count = size / sizeof(rmt_item32_t);
+    for (size_t i = 0; i < item_count && count + 2 <= max_pulses; ++i) {
+        if (items[i].duration0 == 0) break;
+        pulses[count++] = { (uint8_t)items[i].level0, (uint16_t)items[i].duration0 };
+        if (items[i].duration1 == 0) break;     // idle reached
+        pulses[count++] = { (uint8_t)items[i].level1, (uint16_t)items[i].duration1 };
+    }
+    vRingbufferReturnItem(g_rx_ring, items);
+    return count;
+}
+
+} // namespace
+
+bool dht_rmt_begin(int pin) {
+    g_have_result = false;
+    if (g_rx_ring) return true;     // already installed; begin() again only resets the cache
+
+    rmt_config_t cfg = {};
+    cfg.rmt_mode = RMT_MODE_RX;
+    cfg.channel = DHT_RMT_CHANNEL;
+    cfg.gpio_num = (gpio_num_t)pin;
+    cfg.clk_div = DHT_RMT_CLK_DIV;
+    cfg.mem_block_num = 1;
+    cfg.rx_config.idle_threshold = DHT_RMT_IDLE_US;
+    cfg.rx_config.filter_ticks_thresh = DHT_RMT_FILTER_TICKS;
+    cfg.rx_config.filter_en = true;
+    if (rmt_config(&cfg) != ESP_OK
+        || rmt_driver_install(DHT_RMT_CHANNEL, DHT_RMT_RINGBUF_BYTES, 0) != ESP_OK
+        || rmt_get_ringbuf_handle(DHT_RMT_CHANNEL, &g_rx_ring) != ESP_OK) {
+        g_rx_ring = nullptr;
+        DPRINTLN("[DHT] RMT receiver unavailable.");
+        return false;
+    }
+
+    // Open drain with input kept on: the GPIO pulls the line low for the
+    // start pulse while the RMT keeps listening to the same pad.
+    g_pin = (gpio_num_t)pin;
+    gpio_set_pull_mode(g_pin, GPIO_PULLUP_ONLY);
+    gpio_set_direction(g_pin, GPIO_MODE_INPUT_OUTPUT_OD);
+    gpio_set_level(g_pin, 1);
+    return true;
+}
+
+bool dht_rmt_read(float* humidity, float* temp_c) {
+    const uint32_t now = millis();
+    if (g_have_result && (uint32_t)(now - g_last_read_ms) < DHT_MIN_INTERVAL_MS) {
+        *humidity = g_last_humidity;
+        *temp_c = g_last_temp_c;
+        return g_last_ok;
+    }
+    g_have_result = true;
+    g_last_read_ms = now;
+    g_last_ok = false;
+    g_last_humidity = NAN;
+    g_last_temp_c = NAN;
+
+    if (g_rx_ring) {
+        DhtPulse pulses[DHT_MAX_PULSES];
+        const size_t count = capture_response(pulses, DHT_MAX_PULSES);
+        DhtFrame frame;
+        const DhtDecodeStatus status = dht_decode_pulses(pulses, count, &frame);
+        if (status == DhtDecodeStatus::Ok) {
+            dht11_frame_values(frame, &g_last_humidity, &g_last_temp_c);
+            g_last_ok = true;
+        } else {
+            DPRINT("[DHT] read failed: %s (%u pulses)\n", dht_decode_status_name(status), (unsigned)count);
+        }
+    }
+
+    *humidity = g_last_humidity;
+    *temp_c = g_last_temp_c;
+    return g_last_ok;
+}
@@ -1,4 +1,5 @@
 #include "graph_buffer.h"
+#include "perf_probe.h"
 
 GraphBuffer  g_graph_temp     = {{}, 0, 0};
 GraphBuffer  g_graph_humidity = {{}, 0, 0};
@@ -6,15 +7,19 @@ GraphBuffer  g_graph_ds18     = {{}, 0, 0};
 GraphBuffer  g_graph_light    = {{}, 0, 0};
 GraphBuffer  g_graph_sound    = {{}, 0, 0};
 GraphBuffer  g_graph_soil     = {{}, 0, 0};
+#ifdef ARDUINO
 portMUX_TYPE g_graph_mux      = portMUX_INITIALIZER_UNLOCKED;
+#endif
 
 void graph_buffer_push(GraphBuffer& buf, float value) {
+    PERF_PROBE_SCOPE(PERF_GRAPH_PUSH);
     buf.data[buf.head] = value;
     buf.head = (buf.head + 1) % GRAPH_BUFFER_SIZE;
     if (buf.count < GRAPH_BUFFER_SIZE) ++buf.count;
 }
 
 size_t graph_buffer_get(const GraphBuffer& buf, float* out, size_t out_size) {
+    PERF_PROBE_SCOPE(PERF_GRAPH_GET);
     const size_t n = (buf.count < out_size) ? buf.count : out_size;
     if (n == 0) return 0;
     // Oldest sample sits at (head - count) wrapped around.
@@ -0,0 +1,225 @@
+// history_stream.cpp
+// Encoder/decoder for the BLE history download frames.
+
+#include "history_stream.h"
+#include <math.h>
+
+namespace {
+
+void put_u16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+}
+
+void put_u32(uint8_t* p, uint32_t v) {
+    put_u16(p, (uint16_t)v);
+    put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+uint16_t get_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+uint32_t get_u32(const uint8_t* p) {
+    return get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+bool sensor_selected(uint8_t mask, uint8_t sensor_id) {
+    return sensor_id >= 1 && sensor_id <= HISTORY_SENSOR_COUNT && (mask & (1u << (sensor_id - 1)));
+}
+
+// Move the cursor to the first selected sensor at or after its current
+// position that still has samples left. Leaves sensor_id = 0 when done.
+void skip_exhausted(const HistorySnapshot& snap, HistoryCursor& cur) {
+    while (cur.sensor_id != 0) {
+        if (sensor_selected(cur.mask, cur.sensor_id) && cur.offset < snap.count[cur.sensor_id - 1]) return;
+        cur.offset = 0;
+        cur.sensor_id = (cur.sensor_id < HISTORY_SENSOR_COUNT) ? cur.sensor_id + 1 : 0;
+    }
+}
+
+void put_end_frame(uint8_t* out, uint16_t snapshot_id, uint32_t total) {
+    out[0] = HISTORY_FRAME_END;
+    put_u16(&out[1], snapshot_id);
+    put_u16(&out[3], (uint16_t)total);
+}
+
+void put_log_record(uint8_t* p, const SleepLogSample& rec) {
+    put_u32(&p[0], rec.t_s);
+    put_u16(&p[4], (uint16_t)rec.temp_x10);
+    put_u16(&p[6], (uint16_t)rec.hum_x10);
+    put_u16(&p[8], (uint16_t)rec.ds18_x10);
+    put_u16(&p[10], rec.ldr);
+    p[12] = rec.soil;
+    p[13] = rec.mic;
+}
+
+} // namespace
+
+int16_t history_quantize(float value, uint8_t scale) {
+    if (isnan(value)) return HISTORY_SAMPLE_INVALID;
+    const float scaled = roundf(value * (float)scale);
+    if (scaled <= (float)INT16_MIN || scaled > (float)INT16_MAX) return HISTORY_SAMPLE_INVALID;
+    return (int16_t)scaled;
+}
+
+// The graph source keeps the original 7-byte command.
+size_t history_encode_start(const HistoryStartRequest& req, uint8_t* out, size_t cap) {
+    const size_t len = (req.source == HISTORY_SOURCE_GRAPH) ? HISTORY_CMD_START_LEN : HISTORY_CMD_START_SOURCE_LEN;
+    if (cap < len) return 0;
+    out[0] = HISTORY_CMD_START;
+    out[1] = req.mask;
+    put_u16(&out[2], req.snapshot_id);
+    out[4] = req.sensor_id;
+    put_u16(&out[5], req.offset);
+    if (len == HISTORY_CMD_START_SOURCE_LEN) out[7] = req.source;
+    return len;
+}
+
+bool history_parse_start(const uint8_t* data, size_t len, HistoryStartRequest& req) {
+    if (len < HISTORY_CMD_START_LEN || data[0] != HISTORY_CMD_START) return false;
+    req.mask = data[1];
+    req.snapshot_id = get_u16(&data[2]);
+    req.sensor_id = data[4];
+    req.offset = get_u16(&data[5]);
+    req.source = (len >= HISTORY_CMD_START_SOURCE_LEN) ? data[7] : HISTORY_SOURCE_GRAPH;
+    return req.source <= HISTORY_SOURCE_SLEEP_LOG;
+}
+
+void history_cursor_begin(HistoryCursor& cur, const HistorySnapshot& snap, const HistoryStartRequest& req) {
+    cur.mask = req.mask;
+    cur.source = HISTORY_SOURCE_GRAPH;
+    cur.active = true;
+    if (req.snapshot_id != 0 && req.snapshot_id == snap.id && sensor_selected(req.mask, req.sensor_id)) {
+        cur.sensor_id = req.sensor_id;
+        cur.offset = req.offset;
+    } else {
+        cur.sensor_id = 1;
+        cur.offset = 0;
+    }
+    skip_exhausted(snap, cur);
+}
+
+size_t history_encode_next(const HistorySnapshot& snap, HistoryCursor& cur, uint8_t* out, size_t cap) {
+    if (!cur.active) return 0;
+
+    skip_exhausted(snap, cur);
+    if (cur.sensor_id == 0) {
+        if (cap < HISTORY_END_FRAME_LEN) return 0;
+        uint32_t total = 0;
+        for (uint8_t id = 1; id <= HISTORY_SENSOR_COUNT; ++id) {
+            if (sensor_selected(cur.mask, id)) total += snap.count[id - 1];
+        }
+        put_end_frame(out, snap.id, total);
+        cur.active = false;
+        return HISTORY_END_FRAME_LEN;
+    }
+
+    if (cap < HISTORY_DATA_HEADER_LEN + 2) return 0;
+    const uint8_t idx = cur.sensor_id - 1;
+    const uint16_t total = snap.count[idx];
+    uint16_t n = (uint16_t)((cap - HISTORY_DATA_HEADER_LEN) / 2);
+    if (n > total - cur.offset) n = total - cur.offset;
+
+    out[0] = HISTORY_FRAME_DATA;
+    out[1] = cur.sensor_id;
+    put_u16(&out[2], snap.id);
+    put_u16(&out[4], cur.offset);
+    put_u16(&out[6], total);
+    out[8] = snap.scale[idx];
+    uint8_t* p = &out[HISTORY_DATA_HEADER_LEN];
+    for (uint16_t i = 0; i < n; ++i) {
+        put_u16(p, (uint16_t)snap.samples[idx][cur.offset + i]);
+        p += 2;
+    }
+    cur.offset += n;
+    return HISTORY_DATA_HEADER_LEN + (size_t)n * 2;
+}
+
+void history_log_cursor_begin(HistoryCursor& cur, const HistoryLogSnapshot& log, const HistoryStartRequest& req) {
+    cur.mask = 0;
+    cur.sensor_id = 0;
+    cur.source = HISTORY_SOURCE_SLEEP_LOG;
+    cur.active = true;
+    const bool resume = req.snapshot_id != 0 && req.snapshot_id == log.id && req.offset <= log.count;
+    cur.offset = resume ? req.offset : 0;
+}
+
+size_t history_log_encode_next(const HistoryLogSnapshot& log, HistoryCursor& cur, uint8_t* out, size_t cap) {
+    if (!cur.active) return 0;
+
+    if (cur.offset >= log.count) {
+        if (cap < HISTORY_END_FRAME_LEN) return 0;
+        put_end_frame(out, log.id, log.count);
+        cur.active = false;
+        return HISTORY_END_FRAME_LEN;
+    }
+
+    if (cap < HISTORY_LOG_HEADER_LEN + HISTORY_LOG_RECORD_LEN) return 0;
+    uint16_t n = (uint16_t)((cap - HISTORY_LOG_HEADER_LEN) / HISTORY_LOG_RECORD_LEN);
+    if (n > log.count - cur.offset) n = log.count - cur.offset;
+
+    out[0] = HISTORY_FRAME_LOG;
+    put_u16(&out[1], log.id);
+    put_u16(&out[3], cur.offset);
+    uint8_t* p = &out[HISTORY_LOG_HEADER_LEN];
+    for (uint16_t i = 0; i < n; ++i) {
+        put_log_record(p, log.samples[cur.offset + i]);
+        p += HISTORY_LOG_RECORD_LEN;
+    }
+    cur.offset += n;
+    return HISTORY_LOG_HEADER_LEN + (size_t)n * HISTORY_LOG_RECORD_LEN;
+}
+
+bool history_decode_frame(const uint8_t* data, size_t len, HistoryFrame& frame) {
+    if (len == 0) return false;
+    frame = {};
+    frame.type = data[0];
+
+    if (frame.type == HISTORY_FRAME_END) {
+        if (len != HISTORY_END_FRAME_LEN) return false;
+        frame.snapshot_id = get_u16(&data[1]);
+        frame.total = get_u16(&data[3]);
+        return true;
+    }
+
+    if (frame.type == HISTORY_FRAME_LOG) {
+        if (len < HISTORY_LOG_HEADER_LEN) return false;
+        if ((len - HISTORY_LOG_HEADER_LEN) % HISTORY_LOG_RECORD_LEN != 0) return false;
+        frame.snapshot_id = get_u16(&data[1]);
+        frame.offset = get_u16(&data[3]);
+        frame.sample_count = (uint16_t)((len - HISTORY_LOG_HEADER_LEN) / HISTORY_LOG_RECORD_LEN);
+        frame.samples = &data[HISTORY_LOG_HEADER_LEN];
+        return (uint32_t)frame.offset + frame.sample_count <= UINT16_MAX;
+    }
+
+    if (frame.type != HISTORY_FRAME_DATA || len < HISTORY_DATA_HEADER_LEN) return false;
+    if ((len - HISTORY_DATA_HEADER_LEN) % 2 != 0) return false;
+    frame.sensor_id = data[1];
+    frame.snapshot_id = get_u16(&data[2]);
+    frame.offset = get_u16(&data[4]);
+    frame.total = get_u16(&data[6]);
+    frame.scale = data[8];
+    frame.sample_count = (uint16_t)((len - HISTORY_DATA_HEADER_LEN) / 2);
+    frame.samples = &data[HISTORY_DATA_HEADER_LEN];
+    if (frame.sensor_id < 1 || frame.sensor_id > HISTORY_SENSOR_COUNT) return false;
+    return (uint32_t)frame.offset + frame.sample_count <= frame.total;
+}
+
+int16_t history_frame_sample(const HistoryFrame& frame, uint16_t index) {
+    if (frame.type != HISTORY_FRAME_DATA || index >= frame.sample_count) return HISTORY_SAMPLE_INVALID;
+    return (int16_t)get_u16(&frame.samples[index * 2]);
+}
+
+bool history_frame_log_record(const HistoryFrame& frame, uint16_t index, SleepLogSample& rec) {
+    if (frame.type != HISTORY_FRAME_LOG || index >= frame.sample_count) return false;
+    const uint8_t* p = &frame.samples[(size_t)index * HISTORY_LOG_RECORD_LEN];
+    rec.t_s = get_u32(&p[0]);
+    rec.temp_x10 = (int16_t)get_u16(&p[4]);
+    rec.hum_x10 = (int16_t)get_u16(&p[6]);
+    rec.ds18_x10 = (int16_t)get_u16(&p[8]);
+    rec.ldr = get_u16(&p[10]);
+    rec.soil = p[12];
+    rec.mic = p[13];
+    return true;
+}
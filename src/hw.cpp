@@ -5,6 +5,8 @@
 #include "hw.h"
 #include "config.h"
 #include "settings_store.h"
+#include "signal_filters.h"
+#include "adc_cal.h"
 
 // --- Global hardware identity and shared state ---
 uint8_t mac[MAC_LEN];
@@ -23,6 +25,16 @@ constexpr int SOIL_THRESH_DEFAULT_OPTIMAL = 55;
 constexpr int SOIL_THRESH_DEFAULT_MOIST = 80;
 constexpr bool SOIL_ALERTS_DEFAULT_ENABLED = true;
 
+// --- Signal conditioning (sensor task only) ---
+namespace {
+// Sound level 0-100: 0.4 new + 0.6 old, responds in about 3-4 reads.
+FilterChain<EmaFilterFixed> g_sound_filter(EmaFilterFixed(102));
+// Soil %: moderate EMA; with a 1504-count span the noise stays under 1% per count.
+FilterChain<EmaFilter> g_soil_filter(EmaFilter(0.20f));
+// Set by calibration changes (UI task); the sensor task restarts the soil EMA.
+volatile bool g_soil_filter_reset = false;
+} // namespace
+
 static int g_soil_cal_dry = SOIL_DEFAULT_DRY;
 static int g_soil_cal_wet = SOIL_DEFAULT_WET;
 static int g_soil_thresh_dry = SOIL_THRESH_DEFAULT_DRY;
@@ -84,15 +96,10 @@ void init_hw() {
     analogSetPinAttenuation(PIN_SENSOR_SONIDO,   ADC_11db);
     analogSetPinAttenuation(PIN_SENSOR_HUMEDAD,  ADC_11db);
     analogSetPinAttenuation(PIN_LDR_SIGNAL,      ADC_11db);
+    adc_cal_prepare(ADC_ATTEN_DB_11);   // eFuse characterization, once
 
-    // 3. Initialize the DS18B20 bus in the right order:
-    //    - set INPUT_PULLUP first so the 1-Wire line is high before scanning,
-    //    - wait briefly for the bus to settle,
-    //    - then call sensors.begin() so the library scans a stable bus.
-    pinMode(PIN_TEMP_DS18B20, INPUT_PULLUP);
-    delay(10);
-    sensors.begin();
-    sensors.setResolution(9);
+    // 3. The DS18B20 bus scan runs later on the sensor task (init_ds18_bus()),
+    //    off the boot critical path.
     load_soil_calibration();
     load_soil_thresholds();
     load_humidity_thresholds();
@@ -101,6 +108,17 @@ void init_hw() {
     load_temp_settings();
     load_light_settings();
     load_system_settings();
+}
+
+void init_ds18_bus() {
+    // Initialize the DS18B20 bus in the right order:
+    //    - set INPUT_PULLUP first so the 1-Wire line is high before scanning,
+    //    - wait briefly for the bus to settle,
+    //    - then call sensors.begin() so the library scans a stable bus.
+    pinMode(PIN_TEMP_DS18B20, INPUT_PULLUP);
+    delay(10);
+    sensors.begin();
+    sensors.setResolution(9);
     DPRINT("[DS18B20] init: %d dispositivo(s) en bus\n", sensors.getDeviceCount());
 }
 
@@ -132,6 +150,7 @@ bool save_soil_calibration(int dry_raw, int wet_raw) {
 
     g_soil_cal_dry = dry_raw;
     g_soil_cal_wet = wet_raw;
+    g_soil_filter_reset = true;
     return true;
 }
 
@@ -178,6 +197,7 @@ void reset_soil_settings() {
 
     g_soil_cal_dry = SOIL_DEFAULT_DRY;
     g_soil_cal_wet = SOIL_DEFAULT_WET;
+    g_soil_filter_reset = true;
     g_soil_thresh_dry = SOIL_THRESH_DEFAULT_DRY;
     g_soil_thresh_optimal = SOIL_THRESH_DEFAULT_OPTIMAL;
     g_soil_thresh_moist = SOIL_THRESH_DEFAULT_MOIST;
@@ -541,6 +561,7 @@ void reset_all_settings() {
 
     g_soil_cal_dry = SOIL_DEFAULT_DRY;
     g_soil_cal_wet = SOIL_DEFAULT_WET;
+    g_soil_filter_reset = true;
     g_soil_thresh_dry = SOIL_THRESH_DEFAULT_DRY;
     g_soil_thresh_optimal = SOIL_THRESH_DEFAULT_OPTIMAL;
     g_soil_thresh_moist = SOIL_THRESH_DEFAULT_MOIST;
@@ -601,17 +622,37 @@ int read_sound_level() {
         }
     }
 
-    // PEAK_MAX: valor pico a pico que equivale al 100%.
-    // With 20x gain, about 45 mV at the mic produces roughly 900 ADC counts of swing.
+    // PEAK_MAX_MV: valor pico a pico que equivale al 100%.
+    // With 20x gain, about 45 mV at the mic produces roughly 725 mV (900 nominal counts) of swing.
     // Raise this if the meter saturates too easily, lower it if it never reaches 100%.
-    const int PEAK_MAX = 900;
-    int raw = constrain(map(hi - lo, 0, PEAK_MAX, 0, 100), 0, 100);
+    const int PEAK_MAX_MV = 725;
+    const int swing_mv = (int)adc_raw_to_mv((uint16_t)hi) - (int)adc_raw_to_mv((uint16_t)lo);
+    int raw = constrain(map(swing_mv, 0, PEAK_MAX_MV, 0, 100), 0, 100);
+
+    return (int)g_sound_filter.update(raw);
+}
+
+float soil_raw_to_percent(int raw_avg) {
+    const int DISCONNECT_LOW_THRESHOLD = 80;
+    const int DISCONNECT_AVG_THRESHOLD = 1400;
+
+    // GPIO35 no tiene pull-up/down interno. Con el sensor desconectado en esta
+    // placa, el ADC ha mostrado valores flotantes muy por debajo del rango real
+    // del sensor. Usamos un umbral conservador basado en mediciones reales.
+    bool likely_disconnected =
+        raw_avg <= DISCONNECT_LOW_THRESHOLD ||
+        raw_avg < DISCONNECT_AVG_THRESHOLD;
 
-    // EMA (Exponential Moving Average) to suppress random spikes.
-    // 0.4 new + 0.6 old: responds in about 3-4 reads (300-400 ms).
-    static float ema = 0.0f;
-    ema = 0.6f * ema + 0.4f * (float)raw;
-    return (int)ema;
+    if (likely_disconnected) {
+        return NAN;
+    }
+
+    // Calibration points stay in raw counts (NVS, ULP); the interpolation runs
+    // on calibrated millivolts so the ADC's non-linearity does not bend it.
+    int percent = map(adc_raw_to_mv((uint16_t)raw_avg),
+                      adc_raw_to_mv((uint16_t)g_soil_cal_dry),
+                      adc_raw_to_mv((uint16_t)g_soil_cal_wet), 0, 100);
+    return (float)constrain(percent, 0, 100);
 }
 
 float read_soil_moisture() {
@@ -626,8 +667,6 @@ float read_soil_moisture() {
     //   Dry   raw ~= 3408  (~2746 mV, correct for a Capacitive V2 at 3.3V)
     //   Wet   raw ~= 1904  (~1534 mV, 1504-count delta, good dynamic range)
     const uint8_t SAMPLE_COUNT = 12;
-    const int DISCONNECT_LOW_THRESHOLD = 80;
-    const int DISCONNECT_AVG_THRESHOLD = 1400;
 
     int raw_min = 4095;
     int raw_max = 0;
@@ -641,25 +680,16 @@ float read_soil_moisture() {
     }
 
     int raw_avg = (int)(raw_sum / SAMPLE_COUNT);
-    // GPIO35 no tiene pull-up/down interno. Con el sensor desconectado en esta
-    // placa, el ADC ha mostrado valores flotantes muy por debajo del rango real
-    // del sensor. Usamos un umbral conservador basado en mediciones reales.
-    bool likely_disconnected =
-        raw_avg <= DISCONNECT_LOW_THRESHOLD ||
-        raw_avg < DISCONNECT_AVG_THRESHOLD;
-
-    if (likely_disconnected) {
+    float percent = soil_raw_to_percent(raw_avg);
+    if (g_soil_filter_reset || isnan(percent)) {
+        // A new calibration or a reconnected probe starts from its first reading.
+        g_soil_filter_reset = false;
+        g_soil_filter.reset();
+    }
+    if (isnan(percent)) {
         return NAN;
     }
-
-    int percent = map(raw_avg, g_soil_cal_dry, g_soil_cal_wet, 0, 100);
-
-    // Moderate EMA (0.80/0.20): with a 1504-count span the noise stays under 1% per count.
-    static float ema = -1.0f;
-    int clamped = constrain(percent, 0, 100);
-    if (ema < 0.0f) ema = (float)clamped;
-    ema = 0.80f * ema + 0.20f * (float)clamped;
-    return ema;
+    return g_soil_filter.update((float)(int)percent);
 }
 
 float read_ds18b20_temp() {
@@ -0,0 +1,127 @@
+// i2c_drivers.cpp
+// SCD41 and BH1750 drivers for the I2C sensor scheduler.
+
+#include "i2c_drivers.h"
+
+namespace {
+
+// --- SCD41 ---
+constexpr uint16_t SCD41_CMD_START_PERIODIC = 0x21B1;
+constexpr uint16_t SCD41_CMD_STOP_PERIODIC = 0x3F86;
+constexpr uint16_t SCD41_CMD_DATA_READY = 0xE4B8;
+constexpr uint16_t SCD41_CMD_READ_MEASUREMENT = 0xEC05;
+constexpr uint32_t SCD41_STOP_SETTLE_MS = 500;
+constexpr uint32_t SCD41_CMD_EXEC_MS = 1;
+constexpr uint32_t SCD41_PERIOD_MS = 5000;
+constexpr uint8_t  SCD41_STATE_RUNNING = 0x01;
+
+bool scd41_command(const I2cBus& bus, uint16_t cmd) {
+    const uint8_t tx[2] = { (uint8_t)(cmd >> 8), (uint8_t)cmd };
+    return bus.write(bus.ctx, SCD41_I2C_ADDR, tx, sizeof(tx)) == I2cStatus::Ok;
+}
+
+// Command, execution gap, then `words` CRC-checked words.
+bool scd41_read_words(const I2cBus& bus, uint16_t cmd, uint16_t* out, uint8_t words) {
+    uint8_t rx[9];
+    if (words > 3 || !scd41_command(bus, cmd)) return false;
+    bus.wait_ms(bus.ctx, SCD41_CMD_EXEC_MS);
+    if (bus.read(bus.ctx, SCD41_I2C_ADDR, rx, (size_t)words * 3) != I2cStatus::Ok) return false;
+    for (uint8_t w = 0; w < words; ++w) {
+        const uint8_t* word = rx + w * 3;
+        if (sensirion_crc8(word, 2) != word[2]) return false;
+        out[w] = (uint16_t)((word[0] << 8) | word[1]);
+    }
+    return true;
+}
+
+bool scd41_probe(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms) {
+    // Accepted in both idle and periodic mode, so it doubles as the ACK check.
+    if (!scd41_command(bus, SCD41_CMD_STOP_PERIODIC)) return false;
+    state = 0;
+    *wait_ms = SCD41_STOP_SETTLE_MS;
+    return true;
+}
+
+bool scd41_start(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms) {
+    // Free running once started: later cycles only poll and read.
+    *wait_ms = 0;
+    if (state & SCD41_STATE_RUNNING) return true;
+    if (!scd41_command(bus, SCD41_CMD_START_PERIODIC)) return false;
+    state |= SCD41_STATE_RUNNING;
+    *wait_ms = SCD41_PERIOD_MS;
+    return true;
+}
+
+I2cPoll scd41_poll(const I2cBus& bus, uint8_t& state) {
+    (void)state;
+    uint16_t status;
+    if (!scd41_read_words(bus, SCD41_CMD_DATA_READY, &status, 1)) return I2cPoll::Error;
+    return (status & 0x07FF) ? I2cPoll::Ready : I2cPoll::NotReady;
+}
+
+bool scd41_read(const I2cBus& bus, uint8_t& state, float* channels) {
+    (void)state;
+    uint16_t w[3];
+    if (!scd41_read_words(bus, SCD41_CMD_READ_MEASUREMENT, w, 3)) return false;
+    channels[I2C_CH_CO2_PPM] = (float)w[0];
+    channels[I2C_CH_CO2_TEMP_C] = -45.0f + 175.0f * (float)w[1] / 65535.0f;
+    channels[I2C_CH_CO2_HUMIDITY] = 100.0f * (float)w[2] / 65535.0f;
+    return true;
+}
+
+// --- BH1750 ---
+constexpr uint8_t  BH1750_CMD_POWER_ON = 0x01;
+constexpr uint8_t  BH1750_CMD_ONE_TIME_H = 0x20;     // 1 lx resolution, powers down afterwards
+constexpr uint32_t BH1750_CONVERSION_MS = 180;       // datasheet maximum
+constexpr uint32_t BH1750_PERIOD_MS = 1000;
+
+bool bh1750_command(const I2cBus& bus, uint8_t cmd) {
+    return bus.write(bus.ctx, BH1750_I2C_ADDR, &cmd, 1) == I2cStatus::Ok;
+}
+
+bool bh1750_probe(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms) {
+    (void)state;
+    *wait_ms = 0;
+    return bh1750_command(bus, BH1750_CMD_POWER_ON);
+}
+
+bool bh1750_start(const I2cBus& bus, uint8_t& state, uint32_t* wait_ms) {
+    (void)state;
+    *wait_ms = BH1750_CONVERSION_MS;
+    return bh1750_command(bus, BH1750_CMD_POWER_ON) && bh1750_command(bus, BH1750_CMD_ONE_TIME_H);
+}
+
+bool bh1750_read(const I2cBus& bus, uint8_t& state, float* channels) {
+    (void)state;
+    uint8_t rx[2];
+    if (bus.read(bus.ctx, BH1750_I2C_ADDR, rx, sizeof(rx)) != I2cStatus::Ok) return false;
+    channels[I2C_CH_LUX] = (float)((rx[0] << 8) | rx[1]) / 1.2f;
+    return true;
+}
+
+} // namespace
+
+const I2cDriver I2C_DRIVER_SCD41 = {
+    "SCD41", SCD41_I2C_ADDR,
+    (1u << I2C_CH_CO2_PPM) | (1u << I2C_CH_CO2_TEMP_C) | (1u << I2C_CH_CO2_HUMIDITY),
+    SCD41_PERIOD_MS, 250,
+    scd41_probe, scd41_start, scd41_poll, scd41_read,
+};
+
+const I2cDriver I2C_DRIVER_BH1750 = {
+    "BH1750", BH1750_I2C_ADDR,
+    (1u << I2C_CH_LUX),
+    BH1750_PERIOD_MS, 0,
+    bh1750_probe, bh1750_start, nullptr, bh1750_read,
+};
+
+uint8_t sensirion_crc8(const uint8_t* data, size_t len) {
+    uint8_t crc = 0xFF;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,136 @@
+// i2c_sched.cpp
+// One-operation-per-step scheduler for the external I2C sensors.
+
+#include "i2c_sched.h"
+#include <math.h>
+
+namespace {
+
+bool is_due(uint32_t due_ms, uint32_t now_ms) { return (int32_t)(due_ms - now_ms) <= 0; }
+
+void clear_channels(I2cScheduler& s, uint8_t mask) {
+    for (uint8_t ch = 0; ch < I2C_CH_COUNT; ++ch) {
+        if (mask & (1u << ch)) s.channels[ch] = NAN;
+    }
+}
+
+void fail(I2cScheduler& s, I2cDevice& d, uint32_t now_ms) {
+    if (++d.errors < I2C_SCHED_MAX_ERRORS) {
+        d.state = I2cDeviceState::Idle;
+        d.due_ms = now_ms + I2C_SCHED_ERROR_RETRY_MS;
+        return;
+    }
+    // Unplugged or wedged: drop its values and go back to probing.
+    clear_channels(s, d.driver->channel_mask);
+    d.state = I2cDeviceState::Absent;
+    d.errors = 0;
+    d.due_ms = now_ms + I2C_SCHED_REPROBE_MS;
+}
+
+void run(I2cScheduler& s, I2cDevice& d, uint32_t now_ms) {
+    const I2cDriver& drv = *d.driver;
+    uint32_t wait_ms = 0;
+
+    switch (d.state) {
+        case I2cDeviceState::Absent:
+            d.driver_state = 0;
+            if (drv.probe(s.bus, d.driver_state, &wait_ms)) {
+                d.state = I2cDeviceState::Idle;
+                d.errors = 0;
+                d.due_ms = now_ms + wait_ms;
+            } else {
+                d.due_ms = now_ms + I2C_SCHED_REPROBE_MS;
+            }
+            return;
+
+        case I2cDeviceState::Idle:
+            if (!drv.start(s.bus, d.driver_state, &wait_ms)) {
+                fail(s, d, now_ms);
+                return;
+            }
+            d.state = I2cDeviceState::Converting;
+            d.started_ms = now_ms;
+            d.due_ms = now_ms + wait_ms;
+            return;
+
+        case I2cDeviceState::Converting: {
+            const I2cPoll poll = drv.poll ? drv.poll(s.bus, d.driver_state) : I2cPoll::Ready;
+            if (poll == I2cPoll::NotReady) {
+                // A conversion that never completes is a failure too.
+                if (now_ms - d.started_ms > 2 * drv.period_ms) {
+                    fail(s, d, now_ms);
+                } else {
+                    d.due_ms = now_ms + drv.poll_retry_ms;
+                }
+                return;
+            }
+            if (poll == I2cPoll::Error) {
+                fail(s, d, now_ms);
+                return;
+            }
+            // The read is its own bus turn, so other devices can go in between.
+            d.state = I2cDeviceState::Reading;
+            return;
+        }
+
+        case I2cDeviceState::Reading: {
+            if (!drv.read(s.bus, d.driver_state, s.channels)) {
+                fail(s, d, now_ms);
+                return;
+            }
+            d.errors = 0;
+            d.samples++;
+            d.state = I2cDeviceState::Idle;
+            // One-shot sensors keep a start-to-start cadence. A sensor that
+            // paces itself (has poll) is due one retry short of period_ms
+            // after this read, so the first poll lands just ahead of its next
+            // sample instead of drifting against its clock.
+            if (drv.poll) {
+                const uint32_t retry_ms = drv.poll_retry_ms < drv.period_ms ? drv.poll_retry_ms : 0;
+                d.due_ms = now_ms + drv.period_ms - retry_ms;
+            } else {
+                d.due_ms = d.started_ms + drv.period_ms;
+            }
+            return;
+        }
+    }
+}
+
+} // namespace
+
+void i2c_sched_init(I2cScheduler& s, const I2cBus& bus, const I2cDriver* const* drivers, uint8_t count,
+                    uint32_t now_ms) {
+    s.bus = bus;
+    s.count = count < I2C_SCHED_MAX_DEVICES ? count : I2C_SCHED_MAX_DEVICES;
+    for (uint8_t i = 0; i < s.count; ++i) {
+        s.devices[i] = { drivers[i], I2cDeviceState::Absent, 0, 0, now_ms, now_ms, 0 };
+    }
+    clear_channels(s, 0xFF);
+}
+
+uint32_t i2c_sched_step(I2cScheduler& s, uint32_t now_ms) {
+    // Earliest due first; ties go to the lower index.
+    I2cDevice* next = nullptr;
+    for (uint8_t i = 0; i < s.count; ++i) {
+        I2cDevice& d = s.devices[i];
+        if (!next || (int32_t)(d.due_ms - next->due_ms) < 0) next = &d;
+    }
+    if (!next) return I2C_SCHED_IDLE_MS;
+    if (is_due(next->due_ms, now_ms)) run(s, *next, now_ms);
+
+    uint32_t wait_ms = I2C_SCHED_IDLE_MS;
+    for (uint8_t i = 0; i < s.count; ++i) {
+        const int32_t left = (int32_t)(s.devices[i].due_ms - now_ms);
+        if (left <= 0) return 0;
+        if ((uint32_t)left < wait_ms) wait_ms = (uint32_t)left;
+    }
+    return wait_ms;
+}
+
+uint8_t i2c_sched_present_mask(const I2cScheduler& s) {
+    uint8_t mask = 0;
+    for (uint8_t i = 0; i < s.count; ++i) {
+        if (s.devices[i].state != I2cDeviceState::Absent) mask |= (uint8_t)(1u << i);
+    }
+    return mask;
+}
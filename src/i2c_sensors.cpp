@@ -0,0 +1,96 @@
+// i2c_sensors.cpp
+// Wire-backed bus, scheduler task and published values for the external I2C sensors.
+
+#include "i2c_sensors.h"
+#include "i2c_sched.h"
+#include "i2c_drivers.h"
+#include "config.h"
+#include "hw.h"
+#include "perf_probe.h"
+#include <Wire.h>
+#include <math.h>
+
+namespace {
+
+constexpr uint32_t I2C_BUS_HZ = 100000;
+constexpr uint16_t I2C_BUS_TIMEOUT_MS = 20;
+constexpr uint32_t I2C_TASK_STACK_BYTES = 3072;
+
+const I2cDriver* const kI2cDrivers[] = { &I2C_DRIVER_SCD41, &I2C_DRIVER_BH1750 };
+
+I2cScheduler g_sched;
+float g_published[I2C_CH_COUNT] = { NAN, NAN, NAN, NAN };
+portMUX_TYPE g_published_mux = portMUX_INITIALIZER_UNLOCKED;
+
+I2cStatus wire_write(void*, uint8_t addr, const uint8_t* data, size_t len) {
+    Wire.beginTransmission(addr);
+    Wire.write(data, len);
+    // 2/3: address/data NACK, 4/5: bus error/timeout.
+    const uint8_t err = Wire.endTransmission();
+    if (err == 0) return I2cStatus::Ok;
+    return (err == 2 || err == 3) ? I2cStatus::Nack : I2cStatus::Error;
+}
+
+I2cStatus wire_read(void*, uint8_t addr, uint8_t* data, size_t len) {
+    if (Wire.requestFrom((uint16_t)addr, len, true) != len) return I2cStatus::Nack;
+    for (size_t i = 0; i < len; ++i) data[i] = (uint8_t)Wire.read();
+    return I2cStatus::Ok;
+}
+
+// One extra tick so a 1 ms command gap is never cut short by a tick boundary.
+void task_wait_ms(void*, uint32_t ms) { vTaskDelay(pdMS_TO_TICKS(ms) + 1); }
+
+void log_presence_changes(uint8_t before, uint8_t after) {
+    for (uint8_t i = 0; i < g_sched.count; ++i) {
+        const uint8_t bit = (uint8_t)(1u << i);
+        if ((before ^ after) & bit) {
+            DPRINT("[I2C] %s at 0x%02X %s\n", g_sched.devices[i].driver->name,
+                   (unsigned)g_sched.devices[i].driver->address, (after & bit) ? "detected" : "lost");
+        }
+    }
+}
+
+void i2c_task(void*) {
+    perf_probe_register_task("I2cTask");
+    const I2cBus bus = { wire_write, wire_read, task_wait_ms, nullptr };
+    i2c_sched_init(g_sched, bus, kI2cDrivers, sizeof(kI2cDrivers) / sizeof(kI2cDrivers[0]), millis());
+
+    uint8_t present = 0;
+    while (1) {
+        const uint32_t wait_ms = i2c_sched_step(g_sched, millis());
+
+        portENTER_CRITICAL(&g_published_mux);
+        for (uint8_t ch = 0; ch < I2C_CH_COUNT; ++ch) g_published[ch] = g_sched.channels[ch];
+        portEXIT_CRITICAL(&g_published_mux);
+
+        const uint8_t now_present = i2c_sched_present_mask(g_sched);
+        if (now_present != present) {
+            log_presence_changes(present, now_present);
+            present = now_present;
+        }
+        vTaskDelay(wait_ms ? pdMS_TO_TICKS(wait_ms) : 1);
+    }
+}
+
+} // namespace
+
+void i2c_sensors_start() {
+    if (!Wire.begin(PIN_I2C_SDA, PIN_I2C_SCL, I2C_BUS_HZ)) {
+        DPRINTLN("[I2C] Bus init failed.");
+        return;
+    }
+    Wire.setTimeOut(I2C_BUS_TIMEOUT_MS);
+    // Priority 1 on core 0 next to the sensor task; it sleeps between bus turns.
+    if (xTaskCreatePinnedToCore(i2c_task, "I2cTask", I2C_TASK_STACK_BYTES, NULL, 1, NULL, 0) != pdPASS) {
+        DPRINTLN("[I2C] Task creation failed.");
+    }
+}
+
+void i2c_sensors_fill(Reading& r) {
+    portENTER_CRITICAL(&g_published_mux);
+    r.co2_ppm = g_published[I2C_CH_CO2_PPM];
+    r.co2_temperature = g_published[I2C_CH_CO2_TEMP_C];
+    r.co2_humidity = g_published[I2C_CH_CO2_HUMIDITY];
+    r.lux_i2c = g_published[I2C_CH_LUX];
+    portEXIT_CRITICAL(&g_published_mux);
+}
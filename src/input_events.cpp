@@ -0,0 +1,145 @@
+// input_events.cpp
+// PCNT quadrature decoding, button edge ISR and the SPSC input event ring.
+
+#include "input_events.h"
+#include <driver/pcnt.h>
+#include <esp_timer.h>
+#include "config.h"
+#include "rotary.h"
+
+namespace {
+
+constexpr pcnt_unit_t ENCODER_PCNT_UNIT = PCNT_UNIT_0;
+constexpr uint16_t ENCODER_PCNT_FILTER = 1023;   // APB cycles, ~12.8 us at 80 MHz
+constexpr uint8_t RING_SIZE = 32;                // power of two
+static_assert((RING_SIZE & (RING_SIZE - 1)) == 0, "RING_SIZE must be a power of two");
+
+InputEvent g_ring[RING_SIZE];
+volatile uint8_t g_head = 0;      // written by the ISRs only
+volatile uint8_t g_tail = 0;      // written by the consumer only
+volatile int32_t g_overflow_detents = 0;
+volatile bool g_button_overflow = false;
+TaskHandle_t volatile g_consumer = nullptr;
+bool g_started = false;
+
+IRAM_ATTR bool push_event(InputEventType type, int8_t value) {
+    const uint8_t head = g_head;
+    const uint8_t tail = __atomic_load_n(&g_tail, __ATOMIC_ACQUIRE);
+    if ((uint8_t)(head - tail) >= RING_SIZE) return false;
+    InputEvent& ev = g_ring[head & (RING_SIZE - 1)];
+    ev.t_us = (uint32_t)esp_timer_get_time();
+    ev.type = type;
+    ev.value = value;
+    __atomic_store_n(&g_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+IRAM_ATTR void notify_consumer() {
+    TaskHandle_t consumer = g_consumer;
+    if (consumer == nullptr) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(consumer, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+void on_pcnt_event(void*) {
+    uint32_t status = 0;
+    pcnt_get_event_status(ENCODER_PCNT_UNIT, &status);
+    int8_t dir = 0;
+    if (status & PCNT_EVT_H_LIM) dir = 1;
+    else if (status & PCNT_EVT_L_LIM) dir = -1;
+    if (dir == 0) return;
+    if (!push_event(InputEventType::Turn, dir)) {
+        __atomic_fetch_add(&g_overflow_detents, dir, __ATOMIC_RELAXED);
+    }
+    notify_consumer();
+}
+
+IRAM_ATTR void on_button_edge() {
+    const int8_t pressed = digitalRead((uint8_t)DI_ENCODER_SW) == LOW ? 1 : 0;
+    if (!push_event(InputEventType::Button, pressed)) g_button_overflow = true;
+    notify_consumer();
+}
+
+// A leads B is +1, the same direction the previous polled decoder used.
+void configure_pcnt() {
+    pcnt_config_t cfg = {};
+    cfg.unit = ENCODER_PCNT_UNIT;
+    cfg.counter_h_lim = ENCODER_STEPS_PER_DETENT;
+    cfg.counter_l_lim = -ENCODER_STEPS_PER_DETENT;
+    cfg.lctrl_mode = PCNT_MODE_KEEP;
+    cfg.hctrl_mode = PCNT_MODE_REVERSE;
+
+    cfg.channel = PCNT_CHANNEL_0;
+    cfg.pulse_gpio_num = DI_ENCODER_A;
+    cfg.ctrl_gpio_num = DI_ENCODER_B;
+    cfg.pos_mode = PCNT_COUNT_INC;
+    cfg.neg_mode = PCNT_COUNT_DEC;
+    pcnt_unit_config(&cfg);
+
+    cfg.channel = PCNT_CHANNEL_1;
+    cfg.pulse_gpio_num = DI_ENCODER_B;
+    cfg.ctrl_gpio_num = DI_ENCODER_A;
+    cfg.pos_mode = PCNT_COUNT_DEC;
+    cfg.neg_mode = PCNT_COUNT_INC;
+    pcnt_unit_config(&cfg);
+
+    // The encoder has external pull-ups; pcnt_unit_config() enables the
+    // internal ones, which the old FLOATING mode left off.
+    gpio_set_pull_mode((gpio_num_t)DI_ENCODER_A, GPIO_FLOATING);
+    gpio_set_pull_mode((gpio_num_t)DI_ENCODER_B, GPIO_FLOATING);
+
+    pcnt_set_filter_value(ENCODER_PCNT_UNIT, ENCODER_PCNT_FILTER);
+    pcnt_filter_enable(ENCODER_PCNT_UNIT);
+    pcnt_event_enable(ENCODER_PCNT_UNIT, PCNT_EVT_H_LIM);
+    pcnt_event_enable(ENCODER_PCNT_UNIT, PCNT_EVT_L_LIM);
+    pcnt_counter_pause(ENCODER_PCNT_UNIT);
+    pcnt_counter_clear(ENCODER_PCNT_UNIT);
+    pcnt_isr_service_install(0);
+    pcnt_isr_handler_add(ENCODER_PCNT_UNIT, on_pcnt_event, nullptr);
+    pcnt_intr_enable(ENCODER_PCNT_UNIT);
+    pcnt_counter_resume(ENCODER_PCNT_UNIT);
+}
+
+} // namespace
+
+void input_events_begin() {
+    if (g_started) return;
+    g_started = true;
+
+    configure_pcnt();
+    pinMode((uint8_t)DI_ENCODER_SW, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt((uint8_t)DI_ENCODER_SW), on_button_edge, CHANGE);
+    DPRINTLN("[Input] PCNT encoder + button ISR ready.");
+}
+
+void input_events_set_consumer(TaskHandle_t task) {
+    g_consumer = task;
+}
+
+void input_events_wait(TickType_t timeout) {
+    ulTaskNotifyTake(pdTRUE, timeout);
+}
+
+bool input_events_pop(InputEvent& ev) {
+    const uint8_t tail = g_tail;
+    const uint8_t head = __atomic_load_n(&g_head, __ATOMIC_ACQUIRE);
+    if (tail == head) return false;
+    ev = g_ring[tail & (RING_SIZE - 1)];
+    __atomic_store_n(&g_tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+int32_t input_events_take_overflow_detents() {
+    return __atomic_exchange_n(&g_overflow_detents, 0, __ATOMIC_RELAXED);
+}
+
+bool input_events_take_button_overflow() {
+    if (!g_button_overflow) return false;
+    g_button_overflow = false;
+    return true;
+}
+
+bool input_button_pressed_now() {
+    return digitalRead((uint8_t)DI_ENCODER_SW) == LOW;
+}
@@ -1,16 +1,21 @@
 #include <Arduino.h>
 #include "config.h"
-#include <DHT.h>
 #include "io.h"
 #include "hw.h"  // Reuse the hardware layer for DS18B20 and shared sensor helpers.
 #include "ble.h"
 #include "alert_engine.h"
 #include "runtime_events.h"
 #include "graph_buffer.h"
+#include "perf_probe.h"
+#include "boot_profile.h"
+#include "power_manager.h"
+#include "signal_filters.h"
+#include "adc_cal.h"
+#include "dht_rmt.h"
+#include "i2c_sensors.h"
+#include <esp_timer.h>
 #include <math.h>
 
-#define DHT_TYPE DHT11
-
 // LDR calibration constants.
 #define VCC_SUPPLY_VOLTAGE    3300.0 
 #define REF_RESISTANCE      10000.0 
@@ -23,17 +28,29 @@ volatile bool g_sensor_data_ready = false;
 portMUX_TYPE readings_mux = portMUX_INITIALIZER_UNLOCKED;
 extern bool g_sound_enabled;
 
-DHT dht(PIN_DHT, DHT_TYPE);
-
 // Internal helpers for the sensor task.
 static void read_fast_sensors(Reading &r);
 static void read_slow_sensors(Reading &r);
-static uint8_t dht_temp_fail_count = 0;
-static uint8_t dht_hum_fail_count = 0;
+
+// --- Signal conditioning, one chain per channel (sensor task only) ---
+namespace {
+// LDR: EMA on top of the ADC's own filtering, smooths without lagging much.
+FilterChain<EmaFilter> g_ldr_filter(EmaFilter(0.3f));
+// DHT11: one failed read keeps the last value, the second reports NaN.
+FilterChain<DropoutHold> g_dht_hum_filter(DropoutHold(1));
+FilterChain<DropoutHold> g_dht_temp_filter(DropoutHold(1));
+} // namespace
 
 void sensor_reading_task(void *param) {
     DPRINTLN("[IO] Sensor task started.");
-   dht.begin();
+   perf_probe_register_task("SensorTask");
+
+   // Deferred from setup(): the 1-Wire scan overlaps the first UI frames.
+   const int64_t ds18_scan_start_us = esp_timer_get_time();
+   init_ds18_bus();
+   boot_profile_record_async("ds18_scan", (uint32_t)(esp_timer_get_time() - ds18_scan_start_us));
+
+   dht_rmt_begin(PIN_DHT);
 
    Reading local_r;
     // Start with sentinel values so the UI can show "---" or "No sensor"
@@ -44,6 +61,7 @@ void sensor_reading_task(void *param) {
    local_r.soil_humidity = NAN;
    local_r.ldr = 0.0f;
    local_r.mic = 0.0f;
+   i2c_sensors_fill(local_r);
 
    portENTER_CRITICAL(&readings_mux);
    global_readings = local_r;
@@ -57,6 +75,8 @@ void sensor_reading_task(void *param) {
       if (!isnan(local_r.mic) && local_r.mic > mic_peak_accum) {
          mic_peak_accum = local_r.mic;
       }
+      // Max clock only for the ADC/1-Wire/DHT burst; the rest of the tick runs at the DFS minimum.
+      power_boost_acquire(POWER_LOCK_SENSORS);
       if (current_ms - last_slow_read_ms >= SENSOR_READ_INTERVAL_MS) {
          last_slow_read_ms = current_ms;
          read_slow_sensors(local_r);
@@ -73,6 +93,9 @@ void sensor_reading_task(void *param) {
          mic_peak_accum = 0.0f;
       }
       read_fast_sensors(local_r);
+      power_boost_release(POWER_LOCK_SENSORS);
+      // Latest values from I2cTask; never waits on the bus.
+      i2c_sensors_fill(local_r);
 
        // Copy the local snapshot to the shared struct inside a critical section.
        portENTER_CRITICAL(&readings_mux);
@@ -80,14 +103,13 @@ void sensor_reading_task(void *param) {
        portEXIT_CRITICAL(&readings_mux);
 
        // Refresh the shared alert state as soon as the new snapshot is ready.
-       alert_engine_refresh_from_reading(local_r, g_sound_enabled);
+       // Silent until setup() is done: the boot tones and the language menu own the buzzer.
+       alert_engine_refresh_from_reading(local_r, g_sound_enabled && runtime_app_ready());
 
        runtime_mark_sensor_data_ready();
 
-      // Skip BLE packet assembly entirely when nobody is connected.
-      if (client_connected.load()) {
-          notifyAll();
-      }
+      // Change-driven BLE telemetry; returns early when nobody is connected.
+      ble_service_telemetry(local_r, current_ms);
 
 #if PBIT_ENABLE_SERIAL_PLOTTER
        // --- STEAM / Serial Plotter mode ---
@@ -111,28 +133,45 @@ void sensor_reading_task(void *param) {
    }
 }
 
-static void read_fast_sensors(Reading &r) {
-    // LDR front-end: 10k pull-up to 3.3V, LDR to GND, with a hardware RC filter.
-    // Logic is inverted: bright light -> lower ADC, darkness -> higher ADC.
-    float ldr_raw = analogRead(PIN_LDR_SIGNAL);
-    float ldr_new;
+void read_sensors_once(Reading &r) {
+   r.temp_ds18b20 = -999.0f;
+   r.temperature  = NAN;
+   r.humidity     = NAN;
+   r.soil_humidity = NAN;
+   r.ldr = 0.0f;
+   r.ldr_raw = 0.0f;
+   r.mic = 0.0f;
+   i2c_sensors_fill(r);   // NaN: I2cTask does not run on these wakes
+
+   dht_rmt_begin(PIN_DHT);
+   init_ds18_bus();
+   read_slow_sensors(r);
+   read_fast_sensors(r);
+}
+
+// LDR front-end: 10k pull-up to 3.3V, LDR to GND, with a hardware RC filter.
+// Logic is inverted: bright light -> lower ADC, darkness -> higher ADC.
+float ldr_raw_to_lux(float ldr_raw) {
+    PERF_PROBE_SCOPE(PERF_LDR_LUX);
+    float lux;
     if (ldr_raw >= ADC_SATURATION_THRESHOLD) {
-        ldr_new = 20000.0f;
+        lux = 20000.0f;
     } else {
-        float v   = (ldr_raw / 4095.0f) * VCC_SUPPLY_VOLTAGE;
+        float v   = (float)adc_raw_to_mv((uint16_t)ldr_raw);   // calibrated, not raw / 4095 * VCC
         float res = (v > 0 && (VCC_SUPPLY_VOLTAGE - v) > 0) ?
                     (REF_RESISTANCE * (VCC_SUPPLY_VOLTAGE - v)) / v : 999999.0f;
         float log_r = log10(res);
-        ldr_new = pow(10.0f, (log_r - LUX_CALIBRATION_LOG) / LUX_CALIBRATION_GAMMA);
+        lux = pow(10.0f, (log_r - LUX_CALIBRATION_LOG) / LUX_CALIBRATION_GAMMA);
     }
-    ldr_new = constrain(ldr_new, 0.0f, 20000.0f);
+    return constrain(lux, 0.0f, 20000.0f);
+}
+
+static void read_fast_sensors(Reading &r) {
+    float ldr_raw = analogRead(PIN_LDR_SIGNAL);
+    float ldr_new = ldr_raw_to_lux(ldr_raw);
     r.ldr_raw = ldr_raw;
 
-    // Software EMA on top of the hardware filter: smooths the reading without lagging too much.
-    static float ldr_ema = -1.0f;
-    if (ldr_ema < 0.0f) ldr_ema = ldr_new; // Initialize on the first sample.
-    ldr_ema = 0.7f * ldr_ema + 0.3f * ldr_new;
-    r.ldr = ldr_ema;
+    r.ldr = g_ldr_filter.update(ldr_new);
 
     // Delegate the remaining sensor reads to the hardware layer.
     r.mic = read_sound_level();
@@ -141,22 +180,11 @@ static void read_fast_sensors(Reading &r) {
 
 static void read_slow_sensors(Reading &r) {
     // Local DHT11 read.
-   float h = dht.readHumidity();
-   float t = dht.readTemperature(); 
-   if (!isnan(h) && h >= 0 && h <= 100) {
-      r.humidity = h;
-      dht_hum_fail_count = 0;
-   } else {
-      if (dht_hum_fail_count < 2) dht_hum_fail_count++;
-      if (dht_hum_fail_count >= 2) r.humidity = NAN;
-   }
-   if (!isnan(t) && t >= -20 && t <= 80) {
-      r.temperature = t;
-      dht_temp_fail_count = 0;
-   } else {
-      if (dht_temp_fail_count < 2) dht_temp_fail_count++;
-      if (dht_temp_fail_count >= 2) r.temperature = NAN;
-   }
+   float h, t;
+   dht_rmt_read(&h, &t);
+   // Out-of-range reads count as failed ones.
+   r.humidity = g_dht_hum_filter.update((h >= 0 && h <= 100) ? h : NAN);
+   r.temperature = g_dht_temp_filter.update((t >= -20 && t <= 80) ? t : NAN);
 
     // Always refresh DS18B20; the UI maps -999 to "No sensor".
    r.temp_ds18b20 = read_ds18b20_temp();
@@ -6,7 +6,7 @@
 #include "ui_widgets.h"  // Para tft
 #include "fonts.h"       // para FONT_MENU, FONT_HEADER
 #include "rotary.h"      // Para DI_ENCODER_A/B/SW y rotaryEncoder
-#include <ESP32RotaryEncoder.h>
+#include "input_events.h"
 #include <Preferences.h>
 #include <Arduino.h>
 
@@ -358,12 +358,13 @@ void showLanguageMenu() {
     }
     prefs.end();
 
-    // Configurar encoder para el menú (límites 0-2, circular, sin callbacks)
-    rotaryEncoder.setEncoderType(EncoderType::FLOATING);
+    // Configurar encoder para el menú (límites 0-2, circular, sin callbacks).
+    // Menú modal de arranque: consume los giros de la cola de eventos y
+    // lee el botón directamente.
+    input_events_begin();
     rotaryEncoder.setBoundaries(0, 2, true);
-    rotaryEncoder.begin(false);
+    rotaryEncoder.setStepValue(1);
     rotaryEncoder.setEncoderValue(initial_sel);
-    pinMode((uint8_t)DI_ENCODER_SW, INPUT_PULLUP);
 
     int sel      = initial_sel;
     int last_val = initial_sel;
@@ -372,7 +373,11 @@ void showLanguageMenu() {
     bool lastSW = (bool)digitalRead((uint8_t)DI_ENCODER_SW);
 
     while (true) {
-        rotaryEncoder.loop();
+        InputEvent ev;
+        while (input_events_pop(ev)) {
+            if (ev.type == InputEventType::Turn) rotaryEncoder.applyDetents(ev.value);
+        }
+        rotaryEncoder.applyDetents(input_events_take_overflow_detents());
 
         int val = (int)rotaryEncoder.getEncoderValue();
         if (val != last_val) {
@@ -3,6 +3,7 @@
 #include "led_control.h"
 #include "hw.h"
 #include "config.h"
+#include <esp_timer.h>
 
 // --- Pin mapping ---
 constexpr int RGB_R_PIN = 5;
@@ -20,30 +21,268 @@ constexpr int PWM_FREQ = 5000;
 constexpr int BUZZER_RESOLUTION = 8;
 // ---------------------------------
 
-unsigned long buzzer_stop_time = 0;
-constexpr size_t MAX_TONE_SEQUENCE_STEPS = 8;
-ToneStep g_tone_sequence[MAX_TONE_SEQUENCE_STEPS];
-size_t g_tone_sequence_count = 0;
-size_t g_tone_sequence_index = 0;
+// --- Tone sequencer ---
+// All buzzer output happens in the esp_timer callback; callers only edit the
+// queue under g_buzzer_mux and kick the timer.
+namespace {
+
+constexpr size_t TONE_QUEUE_DEPTH = 4;
+constexpr int64_t TONE_RESYNC_US = 2000;    // later than this re-bases the step
+
+struct ToneJob {
+    const ToneStep* steps;      // nullptr: play `single`
+    size_t count;
+    ToneStep single;
+    ToneSource source;
+};
+
 portMUX_TYPE g_buzzer_mux = portMUX_INITIALIZER_UNLOCKED;
+esp_timer_handle_t g_tone_timer = nullptr;
+
+ToneJob g_current = { nullptr, 0, { 0, 0 }, ToneSource::Ui };
+bool g_playing = false;
+bool g_restart = false;         // g_current changed: start it from step 0
+size_t g_step = 0;
+int64_t g_step_end_us = 0;
+ToneJob g_queue[TONE_QUEUE_DEPTH];
+size_t g_queue_len = 0;
+int g_output_hz = -1;           // timer callback only
+
+const ToneStep& job_step(const ToneJob& job, size_t index) {
+    return job.steps ? job.steps[index] : job.single;
+}
+
+// Highest priority first, FIFO within a priority.
+bool pop_next_job_locked(ToneJob* out) {
+    if (g_queue_len == 0) return false;
+    size_t best = 0;
+    for (size_t i = 1; i < g_queue_len; ++i) {
+        if ((uint8_t)g_queue[i].source > (uint8_t)g_queue[best].source) best = i;
+    }
+    *out = g_queue[best];
+    for (size_t i = best + 1; i < g_queue_len; ++i) g_queue[i - 1] = g_queue[i];
+    --g_queue_len;
+    return true;
+}
 
-static void start_tone_step_locked(const ToneStep& step) {
-    if (step.freq_hz <= 0) {
+void set_buzzer_output(int freq_hz) {
+    if (freq_hz == g_output_hz) return;
+    if (freq_hz <= 0) {
         ledcWrite(BUZZER_CHANNEL, 0);
     } else {
-        ledcChangeFrequency(BUZZER_CHANNEL, step.freq_hz, BUZZER_RESOLUTION);
-        ledcWrite(BUZZER_CHANNEL, 128);
+        ledcChangeFrequency(BUZZER_CHANNEL, freq_hz, BUZZER_RESOLUTION);
+        ledcWrite(BUZZER_CHANNEL, 128); // 50% duty cycle
+    }
+    g_output_hz = freq_hz;
+}
+
+void tone_timer_cb(void*) {
+    const int64_t now = esp_timer_get_time();
+    int64_t base = now;
+    int freq_hz = 0;
+    int64_t wait_us = -1;
+    bool change_output = true;
+
+    portENTER_CRITICAL(&g_buzzer_mux);
+    if (g_restart) {
+        g_restart = false;
+        g_step = 0;
+    } else if (g_playing && now < g_step_end_us) {
+        // Woken early by a kick that raced with this deadline.
+        change_output = false;
+        wait_us = g_step_end_us - now;
+    } else if (g_playing) {
+        ++g_step;
+        // Chain from the planned end so steps do not drift.
+        if (now - g_step_end_us < TONE_RESYNC_US) base = g_step_end_us;
+    }
+
+    while (change_output && g_playing) {
+        if (g_step >= g_current.count) {
+            if (!pop_next_job_locked(&g_current)) {
+                g_playing = false;
+                break;
+            }
+            g_step = 0;
+        }
+        const ToneStep& step = job_step(g_current, g_step);
+        if (step.duration_ms <= 0) {
+            ++g_step;
+            continue;
+        }
+        freq_hz = step.freq_hz;
+        g_step_end_us = base + (int64_t)step.duration_ms * 1000;
+        wait_us = g_step_end_us - now;
+        break;
+    }
+    portEXIT_CRITICAL(&g_buzzer_mux);
+
+    if (change_output) set_buzzer_output(freq_hz);
+    if (wait_us >= 0) {
+        // Fails only if a kick re-armed the timer meanwhile; that run follows.
+        esp_timer_start_once(g_tone_timer, (uint64_t)wait_us);
+    }
+}
+
+// Run the callback as soon as possible to pick up the new g_current.
+void kick_tone_timer() {
+    esp_timer_stop(g_tone_timer);
+    esp_timer_start_once(g_tone_timer, 0);
+}
+
+void submit_tone_job(const ToneJob& job) {
+    if (!g_tone_timer || job.count == 0) return;
+
+    bool start_now = false;
+    portENTER_CRITICAL(&g_buzzer_mux);
+    const bool idle = !g_playing;
+    const bool outranks = (uint8_t)job.source > (uint8_t)g_current.source;
+    const bool click_over_click = job.source == ToneSource::Ui && g_current.source == ToneSource::Ui;
+    if (idle || outranks || click_over_click) {
+        // The interrupted melody is dropped; queued ones still follow.
+        g_current = job;
+        g_playing = true;
+        g_restart = true;
+        start_now = true;
+    } else if (job.source != ToneSource::Ui && g_queue_len < TONE_QUEUE_DEPTH) {
+        g_queue[g_queue_len++] = job;
     }
-    buzzer_stop_time = millis() + (unsigned long)step.duration_ms;
+    portEXIT_CRITICAL(&g_buzzer_mux);
+
+    if (start_now) kick_tone_timer();
+}
+
+} // namespace
+// ---------------------------------
+
+// --- LED effects ---
+// Both set_rgb() and the effect timer go through write_rgb(), which only
+// touches the LEDC channels whose duty actually changes. g_led_mux guards the
+// colour and effect state and is never held across ledcWrite(); writers pick
+// the colour and write it under g_led_write_mutex so an older frame cannot
+// land after a newer one.
+namespace {
+
+constexpr uint64_t LED_EFFECT_FRAME_US = 20000;     // 50 Hz
+
+struct LedEffectState {
+    bool active;
+    LedEffect effect;
+    uint8_t rgb[3];
+    uint16_t period_ms;
+    uint8_t repeats;
+    int64_t start_us;
+};
+
+portMUX_TYPE g_led_mux = portMUX_INITIALIZER_UNLOCKED;
+StaticSemaphore_t g_led_write_mutex_storage;
+SemaphoreHandle_t g_led_write_mutex = nullptr;      // created in init_leds_and_buzzer()
+esp_timer_handle_t g_led_timer = nullptr;
+uint8_t g_base_rgb[3] = { 0, 0, 0 };
+int16_t g_led_duty[3] = { -1, -1, -1 };             // -1: not written yet; g_led_write_mutex
+LedEffectState g_effect = { false, LedEffect::None, { 0, 0, 0 }, 0, 0, 0 };
+
+constexpr int kRgbChannels[3] = { RGB_R_CHANNEL, RGB_G_CHANNEL, RGB_B_CHANNEL };
+
+// Returns false before init, when there is nothing to write to yet.
+bool take_led_writer() {
+    if (!g_led_write_mutex) return false;
+    xSemaphoreTake(g_led_write_mutex, portMAX_DELAY);
+    return true;
+}
+
+// Caller holds g_led_write_mutex.
+void write_rgb(const uint8_t value[3]) {
+    for (int i = 0; i < 3; ++i) {
+        const int16_t duty = (int16_t)(255 - value[i]);     // Common-cathode assumption.
+        if (duty == g_led_duty[i]) continue;
+        ledcWrite(kRgbChannels[i], duty);
+        g_led_duty[i] = duty;
+    }
+}
+
+uint8_t scale8(uint8_t value, uint8_t level) {
+    return (uint8_t)(((uint16_t)value * (level + 1)) >> 8);
+}
+
+// Brightness 0..255 at `phase` of 0..255 through one period.
+uint8_t effect_level(LedEffect effect, uint8_t phase) {
+    switch (effect) {
+        case LedEffect::Breathe: {
+            // Triangle squared: a rough perceptual curve without floats.
+            const uint16_t tri = phase < 128 ? phase * 2 : (255 - phase) * 2;
+            return (uint8_t)((tri * tri) >> 8);
+        }
+        case LedEffect::Pulse: {
+            const uint16_t fall = 255 - phase;
+            return (uint8_t)((fall * fall) >> 8);
+        }
+        case LedEffect::Blink:
+            return phase < 128 ? 255 : 0;
+        default:
+            return 255;
+    }
+}
+
+void hue_to_rgb(uint8_t phase, uint8_t* rgb) {
+    const uint16_t h = (uint16_t)phase * 6;     // six 256-step segments
+    const uint8_t up = (uint8_t)(h & 0xFF);
+    const uint8_t down = (uint8_t)(255 - up);
+    switch (h >> 8) {
+        case 0:  rgb[0] = 255;  rgb[1] = up;   rgb[2] = 0;    break;
+        case 1:  rgb[0] = down; rgb[1] = 255;  rgb[2] = 0;    break;
+        case 2:  rgb[0] = 0;    rgb[1] = 255;  rgb[2] = up;   break;
+        case 3:  rgb[0] = 0;    rgb[1] = down; rgb[2] = 255;  break;
+        case 4:  rgb[0] = up;   rgb[1] = 0;    rgb[2] = 255;  break;
+        default: rgb[0] = 255;  rgb[1] = 0;    rgb[2] = down; break;
+    }
+}
+
+// Stop the frame timer, unless an effect was started meanwhile.
+void stop_led_timer() {
+    esp_timer_stop(g_led_timer);
+    portENTER_CRITICAL(&g_led_mux);
+    const bool restarted = g_effect.active;
+    portEXIT_CRITICAL(&g_led_mux);
+    if (restarted) esp_timer_start_periodic(g_led_timer, LED_EFFECT_FRAME_US);
 }
 
-static void stop_beep_locked() {
-    ledcWrite(BUZZER_CHANNEL, 0); // Apagado (0% duty cycle)
-    buzzer_stop_time = 0;
-    g_tone_sequence_count = 0;
-    g_tone_sequence_index = 0;
+void led_effect_cb(void*) {
+    if (!take_led_writer()) return;
+    const int64_t now = esp_timer_get_time();
+    bool write = false;
+    bool finished = false;
+    uint8_t rgb[3];
+
+    portENTER_CRITICAL(&g_led_mux);
+    if (g_effect.active) {
+        write = true;
+        const uint32_t elapsed_ms = (uint32_t)((now - g_effect.start_us) / 1000);
+        if (g_effect.repeats > 0 && elapsed_ms / g_effect.period_ms >= g_effect.repeats) {
+            g_effect.active = false;
+            for (int i = 0; i < 3; ++i) rgb[i] = g_base_rgb[i];
+            finished = true;
+        } else {
+            const uint8_t phase = (uint8_t)(((elapsed_ms % g_effect.period_ms) * 256) / g_effect.period_ms);
+            if (g_effect.effect == LedEffect::Rainbow) {
+                hue_to_rgb(phase, rgb);
+            } else {
+                const uint8_t level = effect_level(g_effect.effect, phase);
+                for (int i = 0; i < 3; ++i) rgb[i] = scale8(g_effect.rgb[i], level);
+            }
+        }
+    }
+    portEXIT_CRITICAL(&g_led_mux);
+
+    if (write) write_rgb(rgb);
+    xSemaphoreGive(g_led_write_mutex);
+
+    if (finished) stop_led_timer();
 }
 
+} // namespace
+// ---------------------------------
+
 
 /**
  * Initialize the RGB LED and buzzer PWM channels.
@@ -59,10 +298,39 @@ void init_leds_and_buzzer() {
     ledcAttachPin(RGB_G_PIN, RGB_G_CHANNEL);
     ledcAttachPin(RGB_B_PIN, RGB_B_CHANNEL);
 
+    if (!g_led_write_mutex) g_led_write_mutex = xSemaphoreCreateMutexStatic(&g_led_write_mutex_storage);
+
     // 3. Configure the passive buzzer channel.
     ledcSetup(BUZZER_CHANNEL, 1000, BUZZER_RESOLUTION);
     ledcAttachPin(BUZZER_PIN, BUZZER_CHANNEL);
     ledcWrite(BUZZER_CHANNEL, 0); // Apagado
+    g_output_hz = 0;
+
+    if (!g_tone_timer) {
+        const esp_timer_create_args_t args = {
+            tone_timer_cb,
+            nullptr,
+            ESP_TIMER_TASK,
+            "tones"
+        };
+        if (esp_timer_create(&args, &g_tone_timer) != ESP_OK) {
+            g_tone_timer = nullptr;
+            DPRINTLN("[Hardware] Tone timer unavailable; buzzer stays silent.");
+        }
+    }
+
+    if (!g_led_timer) {
+        const esp_timer_create_args_t args = {
+            led_effect_cb,
+            nullptr,
+            ESP_TIMER_TASK,
+            "led_fx"
+        };
+        if (esp_timer_create(&args, &g_led_timer) != ESP_OK) {
+            g_led_timer = nullptr;
+            DPRINTLN("[Hardware] LED effect timer unavailable; effects disabled.");
+        }
+    }
 
     // 4. Start with the RGB LED off.
     set_rgb(0, 0, 0);
@@ -74,88 +342,102 @@ void init_leds_and_buzzer() {
  * Set the RGB LED color.
  */
 void set_rgb(uint8_t r, uint8_t g, uint8_t b) {
-    ledcWrite(RGB_R_CHANNEL, 255 - r); // Common-cathode assumption.
-    ledcWrite(RGB_G_CHANNEL, 255 - g);
-    ledcWrite(RGB_B_CHANNEL, 255 - b);
-}
-
+    const bool writer = take_led_writer();
+    portENTER_CRITICAL(&g_led_mux);
+    g_base_rgb[0] = r;
+    g_base_rgb[1] = g;
+    g_base_rgb[2] = b;
+    const bool steady = !g_effect.active;
+    portEXIT_CRITICAL(&g_led_mux);
+    if (!writer) return;
 
-// --- Passive buzzer helpers ---
+    const uint8_t rgb[3] = { r, g, b };
+    if (steady) write_rgb(rgb);
+    xSemaphoreGive(g_led_write_mutex);
+}
 
 /**
- * Schedule a buzzer tone and let loop_buzzer() stop it later.
+ * Start an LED effect on top of the steady colour.
  */
-void beep(int freq_hz, int duration_ms) {
-    portENTER_CRITICAL(&g_buzzer_mux);
-    g_tone_sequence_count = 0;
-    g_tone_sequence_index = 0;
-    ledcChangeFrequency(BUZZER_CHANNEL, freq_hz, BUZZER_RESOLUTION);
-    ledcWrite(BUZZER_CHANNEL, 128); // 50% duty cycle
-    buzzer_stop_time = millis() + duration_ms;
-    portEXIT_CRITICAL(&g_buzzer_mux);
-}
-
-void play_tone_sequence(const ToneStep* steps, size_t count) {
-    if (!steps || count == 0) {
-        stop_beep();
+void led_effect_start(LedEffect effect, uint8_t r, uint8_t g, uint8_t b,
+                      uint16_t period_ms, uint8_t repeats) {
+    if (effect == LedEffect::None || period_ms == 0) {
+        led_effect_stop();
         return;
     }
+    if (!g_led_timer) return;
 
-    portENTER_CRITICAL(&g_buzzer_mux);
-    g_tone_sequence_count = (count > MAX_TONE_SEQUENCE_STEPS) ? MAX_TONE_SEQUENCE_STEPS : count;
-    g_tone_sequence_index = 0;
-
-    for (size_t i = 0; i < g_tone_sequence_count; ++i) {
-        g_tone_sequence[i] = steps[i];
+    portENTER_CRITICAL(&g_led_mux);
+    const bool same = g_effect.active && g_effect.effect == effect && g_effect.period_ms == period_ms
+        && g_effect.repeats == repeats && g_effect.rgb[0] == r && g_effect.rgb[1] == g && g_effect.rgb[2] == b;
+    if (!same) {
+        g_effect.effect = effect;
+        g_effect.rgb[0] = r;
+        g_effect.rgb[1] = g;
+        g_effect.rgb[2] = b;
+        g_effect.period_ms = period_ms;
+        g_effect.repeats = repeats;
+        g_effect.start_us = esp_timer_get_time();
+        g_effect.active = true;
     }
+    portEXIT_CRITICAL(&g_led_mux);
+    if (same) return;
 
-    start_tone_step_locked(g_tone_sequence[0]);
-    portEXIT_CRITICAL(&g_buzzer_mux);
+    led_effect_cb(nullptr);     // first frame now, not one tick later
+    esp_timer_start_periodic(g_led_timer, LED_EFFECT_FRAME_US);  // no-op if already running
 }
 
 /**
- * Stop the buzzer and clear the pending timeout.
+ * Stop an LED effect and restore the steady colour.
  */
-void stop_beep() {
-    portENTER_CRITICAL(&g_buzzer_mux);
-    stop_beep_locked();
-    portEXIT_CRITICAL(&g_buzzer_mux);
+void led_effect_stop(LedEffect only) {
+    if (!take_led_writer()) return;
+    bool stopped = false;
+    uint8_t rgb[3];
+    portENTER_CRITICAL(&g_led_mux);
+    if (g_effect.active && (only == LedEffect::None || only == g_effect.effect)) {
+        g_effect.active = false;
+        for (int i = 0; i < 3; ++i) rgb[i] = g_base_rgb[i];
+        stopped = true;
+    }
+    portEXIT_CRITICAL(&g_led_mux);
+    if (stopped) write_rgb(rgb);
+    xSemaphoreGive(g_led_write_mutex);
+    if (stopped && g_led_timer) stop_led_timer();
+}
+
+
+// --- Passive buzzer helpers ---
+
+/**
+ * Play a single tone.
+ */
+void beep(int freq_hz, int duration_ms, ToneSource source) {
+    const ToneJob job = { nullptr, 1, { freq_hz, duration_ms }, source };
+    submit_tone_job(job);
 }
 
 /**
- * Poll the buzzer timeout from the main loop.
+ * Play a melody by reference; steps must stay valid until it ends.
  */
-void loop_buzzer() {
-    portENTER_CRITICAL(&g_buzzer_mux);
-    if (buzzer_stop_time == 0) {
-        portEXIT_CRITICAL(&g_buzzer_mux);
+void play_tone_sequence(const ToneStep* steps, size_t count, ToneSource source) {
+    if (!steps || count == 0) {
+        stop_beep();
         return;
     }
-    if (millis() >= buzzer_stop_time) {
-        if (g_tone_sequence_count > 0 && (g_tone_sequence_index + 1) < g_tone_sequence_count) {
-            ++g_tone_sequence_index;
-            start_tone_step_locked(g_tone_sequence[g_tone_sequence_index]);
-        } else {
-            stop_beep_locked();
-        }
-    }
-    portEXIT_CRITICAL(&g_buzzer_mux);
+    const ToneJob job = { steps, count, { 0, 0 }, source };
+    submit_tone_job(job);
 }
 
 /**
- * Blocking tone helper used by the boot sequence and short melodies.
+ * Stop the buzzer and clear every queued melody.
  */
-void play_tone_blocking(int freq_hz, int duration_ms) {
-    portENTER_CRITICAL(&g_buzzer_mux);
-    if (freq_hz == 0) { // Silencio
-        ledcWrite(BUZZER_CHANNEL, 0);
-    } else {
-        ledcChangeFrequency(BUZZER_CHANNEL, freq_hz, BUZZER_RESOLUTION);
-        ledcWrite(BUZZER_CHANNEL, 128); // Tono ON
-    }
-    portEXIT_CRITICAL(&g_buzzer_mux);
-    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+void stop_beep() {
+    if (!g_tone_timer) return;
     portENTER_CRITICAL(&g_buzzer_mux);
-    ledcWrite(BUZZER_CHANNEL, 0); // Tono OFF
+    g_playing = false;
+    g_queue_len = 0;
+    g_restart = true;
     portEXIT_CRITICAL(&g_buzzer_mux);
+    kick_tone_timer();
 }
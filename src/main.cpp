@@ -18,19 +18,18 @@
 #include "ui_widgets.h" // Owns the global TFT instance
 #include "ui_boot.h"    // Boot animation and splash flow
 #include "timer.h"
-#include "ui_soil.h"
-#include "ui_temp.h"
-#include "ui_humidity.h"
-#include "ui_ds18.h"
-#include "ui_sound.h"
-#include "ui_light.h"
-#include "ui_system.h"
 #include "lang_select.h" // Cold-boot language selector
 #include "config.h"
 #include "settings_store.h"
 #include "layout.h"
 #include "runtime_events.h"
 #include "alert_engine.h"
+#include "perf_probe.h"
+#include "boot_profile.h"
+#include "sleep_logger.h"
+#include "power_manager.h"
+#include "screen_registry.h"
+#include "i2c_sensors.h"
 #if PBIT_ENABLE_GRAPH_LAB
 #include "sensor_zone.h"
 #endif
@@ -45,6 +44,7 @@ bool g_sound_enabled; // Loaded from NVS during hardware init
 // Power-management state used by the UI router and the rotary driver.
 volatile unsigned long g_last_activity_ms = 0;
 volatile PowerMode g_power_mode = POWER_ACTIVE;
+static unsigned long g_idle_since_ms = 0;
 
 RTC_DATA_ATTR uint8_t g_rtc_last_active_screen = FIRST_APP_SCREEN;
 RTC_DATA_ATTR uint8_t g_rtc_last_power_mode = POWER_ACTIVE;
@@ -57,57 +57,18 @@ enum SleepIntent : uint8_t {
     SLEEP_INTENT_DEEP_SLEEP = 2
 };
 
-#if PBIT_ENABLE_GRAPH_LAB
-static bool isHiddenRestoreScreen(Screen screen) {
-    switch (screen) {
-        case LAB_DASH_OVERVIEW_SCREEN:
-        case LAB_ICON_SET_A_SCREEN:
-        case LAB_ICON_SET_B_SCREEN:
-        case LAB_ICON_SET_C_SCREEN:
-        case LAB_ICON_SIZES_ENV_SCREEN:
-        case LAB_ICON_SIZES_EXT_SCREEN:
-        case LAB_ICON_TEST_SCREEN:
-            return true;
-        default:
-            return false;
-    }
-}
-#endif
-
-static bool isRestorableScreen(Screen screen) {
-    if (screen < TEMP_SCREEN || screen > LAST_APP_SCREEN) {
-        return false;
-    }
-#if PBIT_ENABLE_GRAPH_LAB
-    if (isHiddenRestoreScreen(screen)) {
-        return false;
-    }
-#endif
-    return true;
-}
-
 static Screen getPersistedSleepScreen() {
-    Screen persisted = static_cast<Screen>(g_rtc_last_active_screen);
-    return isRestorableScreen(persisted) ? persisted : FIRST_APP_SCREEN;
+    return screen_is_restorable(g_rtc_last_active_screen)
+        ? static_cast<Screen>(g_rtc_last_active_screen)
+        : FIRST_APP_SCREEN;
 }
 
 static unsigned long now_ms() {
     return (unsigned long)(esp_timer_get_time() / 1000ULL);
 }
 
-static bool settings_ui_active() {
-    return soilCalibrationIsActive()
-        || temp_menu_is_active()
-        || humidity_menu_is_active()
-        || ds18_menu_is_active()
-        || sound_menu_is_active()
-        || light_menu_is_active()
-        || system_menu_is_active()
-        || timer_menu_is_active();
-}
-
 static void saveCurrentScreenForSleep() {
-    if (isRestorableScreen(active_screen)) {
+    if (screen_is_restorable(active_screen)) {
         runtime_set_last_active_screen_before_sleep(active_screen);
         g_rtc_last_active_screen = static_cast<uint8_t>(active_screen);
     }
@@ -123,14 +84,16 @@ static void restorePersistedScreen() {
     runtime_set_last_active_screen_before_sleep(active_screen);
 }
 
-static void playSleepSignal(uint8_t flashes, uint8_t r, uint8_t g, uint8_t b, int tone_hz) {
-    for (uint8_t i = 0; i < flashes; i++) {
-        set_rgb(r, g, b);
-        if (g_sound_enabled) play_tone_blocking(tone_hz, 80);
-        else                 vTaskDelay(pdMS_TO_TICKS(80));
-        set_rgb(0, 0, 0);
-        if (i + 1 < flashes) vTaskDelay(pdMS_TO_TICKS(120));
-    }
+// Two flashes with beeps before IDLE, one before deep sleep. Both run on
+// timers; only deep sleep waits for the signal to finish.
+constexpr uint16_t SLEEP_SIGNAL_PERIOD_MS = 200;
+constexpr ToneStep IDLE_SIGNAL_TONES[] = { { IDLE_BEEP_HZ, 80 }, { 0, 120 }, { IDLE_BEEP_HZ, 80 } };
+constexpr ToneStep DEEP_SLEEP_SIGNAL_TONES[] = { { DEEP_SLEEP_BEEP_HZ, 80 } };
+
+template <size_t N>
+static void playSleepSignal(uint8_t r, uint8_t g, uint8_t b, const ToneStep (&tones)[N]) {
+    led_effect_start(LedEffect::Pulse, r, g, b, SLEEP_SIGNAL_PERIOD_MS, (uint8_t)((N + 1) / 2));
+    if (g_sound_enabled) play_tone_sequence(tones, N, ToneSource::System);
 }
 
 static void enterIdleMode() {
@@ -138,14 +101,33 @@ static void enterIdleMode() {
 
     DPRINTLN("[Power] Entering IDLE mode.");
     saveCurrentScreenForSleep();
-    playSleepSignal(2, 255, 80, 0, IDLE_BEEP_HZ);
+    settings_store_flush();
+    playSleepSignal(255, 80, 0, IDLE_SIGNAL_TONES);
     set_rgb(0, 0, 0);
 
     g_power_mode = POWER_IDLE;
+    power_manager_wake_service();
+    g_idle_since_ms = now_ms();
     persistPowerState(POWER_IDLE, SLEEP_INTENT_IDLE);
     runtime_set_ui_overlay(UI_OVERLAY_SLEEP_WARNING);
 }
 
+#if PBIT_ENABLE_LOG_SLEEP
+// Long unattended IDLE: real deep sleep with periodic logging wakes.
+// The encoder button wakes through EXT0 and restores the saved screen.
+static void enterLogSleep() {
+    DPRINTLN("[Power] Entering logging deep sleep.");
+    saveCurrentScreenForSleep();
+    persistPowerState(POWER_IDLE, SLEEP_INTENT_DEEP_SLEEP);
+    settings_store_flush();
+    playSleepSignal(0, 80, 255, DEEP_SLEEP_SIGNAL_TONES);
+    set_rgb(0, 0, 0);
+    vTaskDelay(pdMS_TO_TICKS(SLEEP_SIGNAL_PERIOD_MS));
+    led_effect_stop();
+    sleep_logger_enter();
+}
+#endif
+
 static void logBootDiagnostics(esp_sleep_wakeup_cause_t wakeup_reason, esp_reset_reason_t reset_reason) {
     DPRINT("[Boot] Reset reason: %d\n", (int)reset_reason);
     DPRINT("[Boot] Wakeup cause: %d\n", (int)wakeup_reason);
@@ -157,12 +139,20 @@ static void logBootDiagnostics(esp_sleep_wakeup_cause_t wakeup_reason, esp_reset
 
 static void failFastOnTaskCreateError(const char* task_name) {
     DPRINT("[RTOS] ERROR: No se pudo crear la tarea %s\n", task_name);
+    settings_store_flush();
     delay(200);
     esp_restart();
 }
 
 void setup() {
     Serial.begin(SERIAL_BAUD_RATE);
+    const esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
+    boot_profile_set_kind(wakeup_reason == ESP_SLEEP_WAKEUP_EXT0 ? BOOT_KIND_WAKE_EXT0 : BOOT_KIND_COLD);
+
+    // Staged boot: only what the first screen needs runs here. BLE bring-up
+    // and the 1-Wire scan run on worker tasks; every stage is timed and the
+    // UI router reports time-to-first-pixel.
+    boot_phase_begin("nvs");
     {
         esp_err_t nvs_ret = nvs_flash_init();
         if (nvs_ret == ESP_ERR_NVS_NO_FREE_PAGES || nvs_ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
@@ -171,18 +161,58 @@ void setup() {
         }
     }
     g_rtc_boot_counter++;
+
+    // Logging wake from deep sleep: read, store in RTC memory, sleep again.
+    if (sleep_logger_is_log_wake()) {
+        sleep_logger_run_log_wake();
+    }
     
     // Module initialization.
+    boot_phase_begin("display");
     set_devicename();
     init_tft_display();
+    init_leds_and_buzzer();
 
-    // BLE is factory-disabled. The build-hash reset above clears ble_en on every
+    // Cold boot: the logo animation runs on its own task from here on, while
+    // the rest of setup() loads settings, brings up the hardware and starts
+    // the sensor task. Only the TFT and the buzzer are off limits until
+    // boot_animation_wait().
+    const bool cold_boot = (wakeup_reason != ESP_SLEEP_WAKEUP_EXT0);
+    if (cold_boot) {
+        boot_animation_start();
+    }
+
+    // One NVS read for every setting; migrates older layouts in place.
+    boot_phase_begin("settings");
+    settings_store_begin();
+
+    // New binary detection. Settings and calibration are kept across upgrades
+    // (the record migrates itself); only the BLE gate is reset and the
+    // language prompt shown again.
+    // Uses FNV-1a hash of the compile timestamp — unique per build, no manual versioning needed.
+    auto fw_build_hash = []() -> uint32_t {
+        const char* s = __DATE__ " " __TIME__;
+        uint32_t h = 2166136261u;
+        for (; *s; ++s) h = (h ^ (uint8_t)*s) * 16777619u;
+        return h;
+    };
+    const uint32_t kBuildHash = fw_build_hash();
+    const uint32_t stored_stamp = load_fw_build_stamp_store();
+    const bool new_firmware = (stored_stamp != kBuildHash);
+    if (new_firmware) {
+        DPRINT("[Boot] New firmware detected (stamp %08X->%08X) -- resetting BLE gate.\n",
+               stored_stamp, kBuildHash);
+        save_ble_enabled_store(false);
+        save_fw_build_stamp_store(kBuildHash);
+    }
+
+    // BLE is factory-disabled. The build-stamp check above clears ble_en on every
     // new flash, so the device always ships with BLE off until unlocked via the
     // secret 60 s hold gesture on SYSTEM_SCREEN.
     if (load_ble_enabled_store()) {
-        init_ble();
+        init_ble_async();
     }
-    init_leds_and_buzzer();
+    boot_phase_begin("hw");
     alert_engine_reset();
     init_hw();
 
@@ -192,8 +222,6 @@ void setup() {
     // restore the right state without replaying the full startup flow.
     // -----------------------------------------------------------------
 
-    esp_sleep_wakeup_cause_t wakeup_reason;
-    wakeup_reason = esp_sleep_get_wakeup_cause();
     esp_reset_reason_t reset_reason = esp_reset_reason();
     logBootDiagnostics(wakeup_reason, reset_reason);
     if (reset_reason == ESP_RST_PANIC ||
@@ -202,72 +230,84 @@ void setup() {
         DPRINTLN("[Boot] WARNING: Previous boot ended abnormally (panic/WDT).");
     }
 
-    // Factory reset guard: wipe NVS every time a new binary is flashed.
-    // Uses FNV-1a hash of the compile timestamp — unique per build, no manual versioning needed.
-    auto fw_build_hash = []() -> uint32_t {
-        const char* s = __DATE__ " " __TIME__;
-        uint32_t h = 2166136261u;
-        for (; *s; ++s) h = (h ^ (uint8_t)*s) * 16777619u;
-        return h;
-    };
-    const uint32_t kBuildHash = fw_build_hash();
-    const uint32_t stored_stamp = load_fw_build_stamp_store();
-    const bool settings_wiped = (stored_stamp != kBuildHash);
-    if (settings_wiped) {
-        DPRINT("[Boot] New firmware detected (stamp %08X->%08X) -- wiping NVS.\n",
-               stored_stamp, kBuildHash);
-        clear_all_settings_store();
-        save_fw_build_stamp_store(kBuildHash);
-    }
-
     switch(wakeup_reason)
     {
         case ESP_SLEEP_WAKEUP_EXT0 : // Woke up from the encoder button (GPIO 13)
             DPRINTLN("[Power] Waking up from Deep Sleep (Button).");
+            boot_phase_begin("restore");
             loadLanguage();           // Restore the last language without showing the selector
             restorePersistedScreen();
+            sleep_logger_archive();   // Samples logged while asleep go to the NVS log
             g_is_fahrenheit = false;
             g_power_mode = POWER_ACTIVE;
             persistPowerState(POWER_ACTIVE, SLEEP_INTENT_NONE);
             break;
 
         default : // Cold boot / power-on
-            DPRINTLN("[Power] Cold Boot detected. Running boot sequence.");
-            run_boot_sequence();
+            DPRINTLN("[Power] Cold Boot detected. Boot animation running.");
             active_screen = FIRST_APP_SCREEN;
             runtime_set_last_active_screen_before_sleep(active_screen);
             g_is_fahrenheit = false;
             g_power_mode = POWER_ACTIVE;
             persistPowerState(POWER_ACTIVE, SLEEP_INTENT_NONE);
-            if (settings_wiped) {
-                // First boot with this firmware version — force language selection.
-                showLanguageMenu();
-            } else {
+            if (!new_firmware) {
                 // Returning cold boot — language already confirmed, load silently.
                 loadLanguage();
             }
-            tft.fillScreen(TFT_BLACK); // Force a clean slate before the first app screen redraw.
-            delay(25);                // Give the display driver time to settle.
-            tft.fillScreen(TFT_BLACK);
-            g_is_fahrenheit = false;
             break;
     }
     // -----------------------------------------------------------------
 
     // Load sensor-zone NVS state (sensor selection + per-sensor viz modes).
+    boot_phase_begin("app");
 #if PBIT_ENABLE_GRAPH_LAB
     sz_init();
 #endif
 
+    // --- FreeRTOS tasks ---
+    boot_phase_begin("tasks");
+    power_manager_begin();
+
+    // Sensor acquisition task on core 0. On cold boot the 1-Wire scan, DHT
+    // warm-up and first readings overlap the animation.
+    BaseType_t sensor_task_ok = xTaskCreatePinnedToCore(
+        sensor_reading_task, 
+        "SensorTask",        
+        4096,                
+        NULL,                
+        1,                   // Priority 1.
+        NULL,                
+        0                    // Pin to core 0.
+    );
+    if (sensor_task_ok != pdPASS) failFastOnTaskCreateError("SensorTask");
+
+    // External I2C sensors: detection and slow conversions run on their own
+    // task so they never hold up the 100 ms sensor loop.
+    i2c_sensors_start();
+
+    if (cold_boot) {
+        // Time left on the animation once everything above is done.
+        boot_phase_begin("animation");
+        boot_animation_wait();
+        if (new_firmware) {
+            // First boot with this firmware version — force language selection.
+            boot_phase_begin("language");
+            showLanguageMenu();
+            tft.fillScreen(TFT_BLACK); // Force a clean slate before the first app screen redraw.
+            delay(25);                // Give the display driver time to settle.
+            tft.fillScreen(TFT_BLACK);
+        }
+    }
+
     // Reconfigure the encoder for the main app after boot/restore flow.
+    boot_phase_begin("ui");
     init_rotary();
     g_is_fahrenheit = false;
 
     // Start the inactivity timer only once the app is fully ready.
     // This avoids carrying boot/menu time into the sleep scheduler.
     g_last_activity_ms = now_ms();
-
-    // --- FreeRTOS tasks ---
+    runtime_mark_app_ready();
 
     // UI task on core 1.
     BaseType_t ui_task_ok = xTaskCreatePinnedToCore(
@@ -280,25 +320,16 @@ void setup() {
         1                
     );
     if (ui_task_ok != pdPASS) failFastOnTaskCreateError("SwitchScreen");
-    
-    // Sensor acquisition task on core 0.
-    BaseType_t sensor_task_ok = xTaskCreatePinnedToCore(
-        sensor_reading_task, 
-        "SensorTask",        
-        4096,                
-        NULL,                
-        1,                   // Priority 1.
-        NULL,                
-        0                    // Pin to core 0.
-    );
-    if (sensor_task_ok != pdPASS) failFastOnTaskCreateError("SensorTask");
+    boot_phase_end();
 }
 
 void loop() {
-    // The main loop only services fast control tasks, debug, and power policy.
-    rotaryEncoder.loop();
-    poll_rotary_aux();
-    loop_buzzer(); 
+    // The main loop only services timeouts, deferred settings writes, debug
+    // and power policy. Encoder and button input is interrupt driven and
+    // handled by the UI task.
+    power_manager_service((uint32_t)now_ms());
+    settings_store_service((uint32_t)now_ms());
+    perf_probe_report_if_due((uint32_t)now_ms());
     
     unsigned long inactivity_time = now_ms() - g_last_activity_ms;
 
@@ -310,7 +341,7 @@ void loop() {
             ? (sleep_timeout_ms - SLEEP_WARNING_MS)
             : sleep_timeout_ms;
     }
-    bool block_sleep = settings_ui_active() || userTimerRunning || !auto_sleep_enabled;
+    bool block_sleep = screen_settings_ui_active() || userTimerRunning || !auto_sleep_enabled;
 
     if (g_power_mode == POWER_ACTIVE && inactivity_time >= idle_timeout_ms && !block_sleep) {
         enterIdleMode();
@@ -325,6 +356,17 @@ void loop() {
         // Product-wise we keep a visible idle state with ZZZ until the user wakes it.
         enterIdleMode();
     }
-    
-    vTaskDelay(pdMS_TO_TICKS(10)); 
+
+#if PBIT_ENABLE_LOG_SLEEP
+    if (g_power_mode == POWER_IDLE &&
+        now_ms() - g_idle_since_ms >= LOG_SLEEP_AFTER_IDLE_MS &&
+        !client_connected.load() &&
+        !block_sleep) {
+        enterLogSleep();
+    }
+#endif
+
+    // Nothing here needs better than POWER_LOOP_PERIOD_MS; mode changes wake
+    // the loop early. The long block leaves the CPU free for DFS/light sleep.
+    power_manager_wait(POWER_LOOP_PERIOD_MS);
 }
@@ -0,0 +1,148 @@
+// perf_probe.cpp
+// Cycle-count profiler for the hot kernels. Compiled only in perf builds.
+
+#include "perf_probe.h"
+
+#if PBIT_ENABLE_PERF_PROBE
+
+#include <stdlib.h>
+
+namespace {
+
+constexpr uint32_t PERF_REPORT_INTERVAL_MS = 10000;
+constexpr size_t PERF_MAX_TASKS = 4;
+
+// Times are kept in ns, converted per sample: the cycle counter runs at
+// whatever frequency DFS or the power manager picked for that call.
+struct PerfProbeStats {
+    uint32_t calls;
+    uint64_t ns;
+    uint32_t max_ns;
+    uint32_t allocs;
+    uint16_t mhz_min;
+    uint16_t mhz_max;
+};
+
+struct PerfTaskEntry {
+    TaskHandle_t handle;
+    const char* name;
+};
+
+const char* const kProbeNames[PERF_PROBE_COUNT] = {
+    "graph_push",
+    "graph_get",
+    "ldr_lux",
+    "ble_pkt",
+    "ble_json",
+    "alert_refresh",
+    "render_graph",
+    "color_blend",
+    "glyph_draw",
+};
+
+portMUX_TYPE g_perf_mux = portMUX_INITIALIZER_UNLOCKED;
+PerfProbeStats g_perf_stats[PERF_PROBE_COUNT] = {};
+PerfTaskEntry g_perf_tasks[PERF_MAX_TASKS] = {};
+size_t g_perf_task_count = 0;
+uint32_t g_perf_last_report_ms = 0;
+
+// Per-task allocation counter, bumped by the malloc wrappers below.
+__thread uint32_t t_alloc_count = 0;
+
+} // namespace
+
+#if PBIT_PERF_PROBE_WRAP_MALLOC
+// Linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc (esp32dev-perf).
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    ++t_alloc_count;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    ++t_alloc_count;
+    return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    ++t_alloc_count;
+    return __real_realloc(ptr, size);
+}
+}
+#endif
+
+PerfProbeScope::PerfProbeScope(PerfProbeId id)
+    : id_(id),
+      start_cycles_(ESP.getCycleCount()),
+      start_allocs_(t_alloc_count) {}
+
+PerfProbeScope::~PerfProbeScope() {
+    const uint32_t cycles = ESP.getCycleCount() - start_cycles_;
+    const uint32_t allocs = t_alloc_count - start_allocs_;
+    // A scope that spans a frequency switch is converted at the closing one.
+    const uint16_t mhz = (uint16_t)getCpuFrequencyMhz();
+    const uint32_t ns = (uint32_t)(((uint64_t)cycles * 1000ULL) / mhz);
+
+    portENTER_CRITICAL(&g_perf_mux);
+    PerfProbeStats& stats = g_perf_stats[id_];
+    ++stats.calls;
+    stats.ns += ns;
+    if (ns > stats.max_ns) stats.max_ns = ns;
+    stats.allocs += allocs;
+    if (stats.mhz_min == 0 || mhz < stats.mhz_min) stats.mhz_min = mhz;
+    if (mhz > stats.mhz_max) stats.mhz_max = mhz;
+    portEXIT_CRITICAL(&g_perf_mux);
+}
+
+void perf_probe_register_task(const char* name) {
+    portENTER_CRITICAL(&g_perf_mux);
+    if (g_perf_task_count < PERF_MAX_TASKS) {
+        g_perf_tasks[g_perf_task_count++] = { xTaskGetCurrentTaskHandle(), name };
+    }
+    portEXIT_CRITICAL(&g_perf_mux);
+}
+
+void perf_probe_report_if_due(uint32_t now_ms) {
+    if ((uint32_t)(now_ms - g_perf_last_report_ms) < PERF_REPORT_INTERVAL_MS) return;
+    g_perf_last_report_ms = now_ms;
+
+    PerfProbeStats snapshot[PERF_PROBE_COUNT];
+    portENTER_CRITICAL(&g_perf_mux);
+    memcpy(snapshot, g_perf_stats, sizeof(snapshot));
+    memset(g_perf_stats, 0, sizeof(g_perf_stats));
+    portEXIT_CRITICAL(&g_perf_mux);
+
+    Serial.print("{\"perf\":{\"probes\":[");
+    bool first = true;
+    for (size_t i = 0; i < PERF_PROBE_COUNT; ++i) {
+        const PerfProbeStats& s = snapshot[i];
+        if (s.calls == 0) continue;
+        Serial.printf("%s{\"id\":\"%s\",\"n\":%lu,\"ns_op\":%lu,\"max_ns\":%lu,\"allocs_op\":%.2f,"
+                      "\"mhz_min\":%u,\"mhz_max\":%u}",
+                      first ? "" : ",",
+                      kProbeNames[i],
+                      (unsigned long)s.calls,
+                      (unsigned long)(s.ns / s.calls),
+                      (unsigned long)s.max_ns,
+                      (double)s.allocs / (double)s.calls,
+                      (unsigned)s.mhz_min,
+                      (unsigned)s.mhz_max);
+        first = false;
+    }
+    Serial.print("],\"stack_free\":{");
+    for (size_t i = 0; i < g_perf_task_count; ++i) {
+        Serial.printf("%s\"%s\":%u",
+                      i == 0 ? "" : ",",
+                      g_perf_tasks[i].name,
+                      (unsigned)uxTaskGetStackHighWaterMark(g_perf_tasks[i].handle));
+    }
+    Serial.printf("},\"heap_free\":%u,\"heap_min\":%u}}\n",
+                  (unsigned)ESP.getFreeHeap(),
+                  (unsigned)ESP.getMinFreeHeap());
+}
+
+#endif // PBIT_ENABLE_PERF_PROBE
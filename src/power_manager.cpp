@@ -0,0 +1,190 @@
+// power_manager.cpp
+// DFS/light-sleep policy and time-in-state accounting.
+
+#include "power_manager.h"
+#include <esp_timer.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+namespace {
+
+portMUX_TYPE g_pm_mux = portMUX_INITIALIZER_UNLOCKED;
+PowerStats g_stats = {};
+uint8_t g_boost_depth[POWER_LOCK_COUNT] = {};
+uint16_t g_boost_total = 0;
+int64_t g_lock_since_us[POWER_LOCK_COUNT] = {};
+PowerLevel g_level = POWER_LEVEL_MAX;
+int64_t g_level_since_us = 0;
+PowerMode g_applied_mode = POWER_ACTIVE;
+bool g_pm_ready = false;
+TaskHandle_t g_service_task = nullptr;          // loopTask, which runs setup()
+
+#if CONFIG_PM_ENABLE
+const char* const kLockNames[POWER_LOCK_COUNT] = { "render", "sensors" };
+esp_pm_lock_handle_t g_boost_locks[POWER_LOCK_COUNT] = {};
+esp_pm_lock_handle_t g_awake_lock = nullptr;   // NO_LIGHT_SLEEP, held in POWER_ACTIVE
+#endif
+
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+constexpr bool kLightSleep = true;
+#else
+constexpr bool kLightSleep = false;
+#endif
+
+// Caller holds g_pm_mux.
+PowerLevel current_level() {
+    if (g_pm_ready) {
+        if (g_boost_total > 0) return POWER_LEVEL_MAX;
+        return (kLightSleep && g_applied_mode == POWER_IDLE) ? POWER_LEVEL_LIGHT_SLEEP : POWER_LEVEL_MIN;
+    }
+    return g_applied_mode == POWER_IDLE ? POWER_LEVEL_MIN : POWER_LEVEL_MAX;
+}
+
+// Caller holds g_pm_mux.
+void update_level(int64_t now_us) {
+    const PowerLevel next = current_level();
+    if (next == g_level) return;
+    g_stats.level_us[g_level] += (uint64_t)(now_us - g_level_since_us);
+    g_level = next;
+    g_level_since_us = now_us;
+}
+
+void apply_mode(PowerMode mode) {
+#if CONFIG_PM_ENABLE
+    if (g_pm_ready) {
+        // No GPIO wake source is armed: gpio_wakeup_enable() would turn the
+        // button's edge interrupt into a level one. Light-sleep windows are
+        // bounded by the IDLE task periods and the UI task re-reads the
+        // button level once per pass in IDLE.
+        if (mode == POWER_IDLE) esp_pm_lock_release(g_awake_lock);
+        else                    esp_pm_lock_acquire(g_awake_lock);
+    }
+#endif
+    if (!g_pm_ready) {
+        setCpuFrequencyMhz(mode == POWER_IDLE ? POWER_CPU_MIN_MHZ : POWER_CPU_MAX_MHZ);
+    }
+
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_pm_mux);
+    g_applied_mode = mode;
+    update_level(now);
+    portEXIT_CRITICAL(&g_pm_mux);
+}
+
+#ifdef FIRMWARE_DEBUG
+uint32_t g_last_report_ms = 0;
+PowerStats g_last_report = {};
+
+uint32_t pct(uint64_t part_us, uint64_t total_us) {
+    return total_us ? (uint32_t)((part_us * 100ULL + total_us / 2) / total_us) : 0;
+}
+
+void report_if_due(uint32_t now_ms) {
+    if (now_ms - g_last_report_ms < POWER_STATS_REPORT_MS) return;
+    g_last_report_ms = now_ms;
+
+    const PowerStats s = power_manager_get_stats();
+    uint64_t level_delta[POWER_LEVEL_COUNT];
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < POWER_LEVEL_COUNT; ++i) {
+        level_delta[i] = s.level_us[i] - g_last_report.level_us[i];
+        total += level_delta[i];
+    }
+    DPRINT("[Power] %s max %u%% min %u%% ls %u%% | render %lu ms/%lu | sensors %lu ms/%lu\n",
+           g_pm_ready ? "dfs" : "fixed",
+           (unsigned)pct(level_delta[POWER_LEVEL_MAX], total),
+           (unsigned)pct(level_delta[POWER_LEVEL_MIN], total),
+           (unsigned)pct(level_delta[POWER_LEVEL_LIGHT_SLEEP], total),
+           (unsigned long)((s.lock_us[POWER_LOCK_RENDER] - g_last_report.lock_us[POWER_LOCK_RENDER]) / 1000ULL),
+           (unsigned long)(s.lock_count[POWER_LOCK_RENDER] - g_last_report.lock_count[POWER_LOCK_RENDER]),
+           (unsigned long)((s.lock_us[POWER_LOCK_SENSORS] - g_last_report.lock_us[POWER_LOCK_SENSORS]) / 1000ULL),
+           (unsigned long)(s.lock_count[POWER_LOCK_SENSORS] - g_last_report.lock_count[POWER_LOCK_SENSORS]));
+    g_last_report = s;
+}
+#else
+void report_if_due(uint32_t) {}
+#endif
+
+} // namespace
+
+void power_manager_begin() {
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t cfg = {};
+    cfg.max_freq_mhz = POWER_CPU_MAX_MHZ;
+    cfg.min_freq_mhz = POWER_CPU_MIN_MHZ;
+    cfg.light_sleep_enable = kLightSleep;
+    bool ok = esp_pm_configure(&cfg) == ESP_OK;
+    for (uint8_t i = 0; ok && i < POWER_LOCK_COUNT; ++i) {
+        ok = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, kLockNames[i], &g_boost_locks[i]) == ESP_OK;
+    }
+    if (ok) ok = esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "awake", &g_awake_lock) == ESP_OK;
+    if (ok) esp_pm_lock_acquire(g_awake_lock);
+    g_pm_ready = ok;
+    DPRINT("[Power] DFS %s (%u-%u MHz, light sleep %s)\n", ok ? "on" : "unavailable",
+           (unsigned)POWER_CPU_MIN_MHZ, (unsigned)POWER_CPU_MAX_MHZ, kLightSleep ? "on" : "off");
+#endif
+    if (!g_pm_ready) setCpuFrequencyMhz(POWER_CPU_MAX_MHZ);
+    g_service_task = xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL(&g_pm_mux);
+    g_applied_mode = POWER_ACTIVE;
+    g_level = current_level();
+    g_level_since_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&g_pm_mux);
+}
+
+void power_manager_service(uint32_t now_ms) {
+    const PowerMode mode = g_power_mode;
+    if (mode != g_applied_mode) apply_mode(mode);
+    report_if_due(now_ms);
+}
+
+void power_manager_wait(uint32_t timeout_ms) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+}
+
+void power_manager_wake_service() {
+    if (g_service_task) xTaskNotifyGive(g_service_task);
+}
+
+void power_boost_acquire(PowerLockId id) {
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_pm_mux);
+    if (g_boost_depth[id]++ == 0) {
+        g_lock_since_us[id] = now;
+        g_stats.lock_count[id]++;
+    }
+    g_boost_total++;
+    update_level(now);
+    portEXIT_CRITICAL(&g_pm_mux);
+#if CONFIG_PM_ENABLE
+    if (g_pm_ready) esp_pm_lock_acquire(g_boost_locks[id]);
+#endif
+}
+
+void power_boost_release(PowerLockId id) {
+#if CONFIG_PM_ENABLE
+    if (g_pm_ready) esp_pm_lock_release(g_boost_locks[id]);
+#endif
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_pm_mux);
+    if (g_boost_depth[id] > 0) {
+        if (--g_boost_depth[id] == 0) g_stats.lock_us[id] += (uint64_t)(now - g_lock_since_us[id]);
+        g_boost_total--;
+    }
+    update_level(now);
+    portEXIT_CRITICAL(&g_pm_mux);
+}
+
+PowerStats power_manager_get_stats() {
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&g_pm_mux);
+    PowerStats s = g_stats;
+    s.level_us[g_level] += (uint64_t)(now - g_level_since_us);
+    for (uint8_t i = 0; i < POWER_LOCK_COUNT; ++i) {
+        if (g_boost_depth[i] > 0) s.lock_us[i] += (uint64_t)(now - g_lock_since_us[i]);
+    }
+    portEXIT_CRITICAL(&g_pm_mux);
+    return s;
+}
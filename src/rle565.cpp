@@ -0,0 +1,43 @@
+// rle565.cpp
+// Streaming decoder for palette + RLE RGB565 images.
+
+#include "rle565.h"
+
+size_t Rle565Reader::read(uint16_t* out, size_t count) {
+    const uint8_t* data = image_.data;
+    const uint16_t* palette = image_.palette;
+    size_t written = 0;
+
+    while (written < count) {
+        if (left_ == 0) {
+            if (pos_ >= image_.data_len) break;
+            const uint8_t token = data[pos_++];
+            literal_ = (token & 0x80) != 0;
+            left_ = (uint8_t)((token & 0x7F) + 1);
+            if (!literal_) {
+                if (pos_ >= image_.data_len) {
+                    left_ = 0;
+                    break;
+                }
+                color_ = palette[data[pos_++]];
+            }
+        }
+
+        size_t take = count - written;
+        if (take > left_) take = left_;
+        if (literal_) {
+            if (take > image_.data_len - pos_) take = image_.data_len - pos_;
+            if (take == 0) {
+                left_ = 0;
+                break;
+            }
+            for (size_t i = 0; i < take; ++i) out[written + i] = palette[data[pos_ + i]];
+            pos_ += take;
+        } else {
+            for (size_t i = 0; i < take; ++i) out[written + i] = color_;
+        }
+        written += take;
+        left_ = (uint8_t)(left_ - take);
+    }
+    return written;
+}
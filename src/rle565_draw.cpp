@@ -0,0 +1,27 @@
+// rle565_draw.cpp
+// Strip-wise upload of an RLE565 image to the panel.
+
+#include "rle565.h"
+#include <TFT_eSPI.h>
+
+namespace {
+// Four 160 px rows per strip: 1.25 KB of stack, one SPI burst per strip.
+constexpr size_t RLE565_STRIP_PIXELS = 160 * 4;
+} // namespace
+
+void rle565_draw(TFT_eSPI& tft, int32_t x, int32_t y, const Rle565Image& image) {
+    uint16_t strip[RLE565_STRIP_PIXELS];
+    Rle565Reader reader(image);
+    uint32_t remaining = (uint32_t)image.width * image.height;
+
+    tft.startWrite();
+    tft.setAddrWindow(x, y, image.width, image.height);
+    while (remaining > 0) {
+        const size_t want = remaining < RLE565_STRIP_PIXELS ? remaining : RLE565_STRIP_PIXELS;
+        const size_t got = reader.read(strip, want);
+        if (got == 0) break;
+        tft.pushPixels(strip, got);
+        remaining -= got;
+    }
+    tft.endWrite();
+}
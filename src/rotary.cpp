@@ -1,10 +1,10 @@
 // rotary.cpp
 // Rotary encoder navigation, button state machine, and context switching.
 #include <Arduino.h>
-#include <ESP32RotaryEncoder.h>
 #include <esp_system.h>
 #include <esp_timer.h>
 #include "rotary.h"
+#include "input_events.h"
 #include "config.h"
 #include "tft_display.h"
 #include "timer.h"
@@ -12,36 +12,25 @@
 #include "hw.h"
 #include "io.h"
 #include "ui_soil.h"
-#include "ui_temp.h"
-#include "ui_humidity.h"
-#include "ui_ds18.h"
-#include "ui_sound.h"
-#include "ui_light.h"
 #include "ui_system.h"
-#include "ui_graph.h"
 #if PBIT_ENABLE_GRAPH_LAB
 #include "sensor_zone.h"
-#include "ui_lab_focus.h"
-#include "ui_lab_sensor_cards.h"
-#include "ui_lab_widget_showcase.h"
 #endif
 #include "runtime_events.h"
-#include "ui_ble_toggle.h"
+#include "screen_registry.h"
 #include "settings_store.h"
+#include "power_manager.h"
 
 // External state shared with the rest of the firmware.
 extern volatile unsigned long g_last_activity_ms;
 extern bool g_is_fahrenheit;
 extern bool g_sound_enabled;
 
-constexpr uint8_t ENCODER_STEPS_PER_DETENT = 2;
 constexpr unsigned long BUTTON_DEBOUNCE_MS = 30;
 constexpr unsigned long MENU_LONG_PRESS_MS = 1200;
 constexpr unsigned long TIMER_RESET_LONG_PRESS_MS = 1000;
 constexpr unsigned long BLE_SECRET_PRESS_MS = 60000UL; // 60 s hold on SYSTEM_SCREEN
 
-extern RotaryEncoder rotaryEncoder;
-
 namespace {
 
 bool g_button_raw_pressed = false;
@@ -54,10 +43,9 @@ bool g_button_long_press_handled = false;
 bool g_ble_secret_eligible = false;
 bool g_ble_secret_fired = false;
 
-bool g_deferred_beep_active = false;
-unsigned long g_deferred_beep_due_ms = 0;
-int g_deferred_beep_freq_hz = 0;
-int g_deferred_beep_duration_ms = 0;
+// Two rising notes, the second 80 ms after the first starts.
+constexpr ToneStep MENU_OPEN_BEEP[] = { { 1200, 45 }, { 0, 35 }, { 1600, 55 } };
+constexpr ToneStep SAVED_BEEP[] = { { 1300, 45 }, { 0, 35 }, { 1700, 55 } };
 
 #if PBIT_ENABLE_GRAPH_LAB
 // Flat carousel — every screen is permanently visible; no level-2 mode.
@@ -114,47 +102,8 @@ static Screen carouselIndexToAppScreen(int index) {
 }
 #endif
 
-static bool is_button_pressed_raw() {
-    return digitalRead((uint8_t)DI_ENCODER_SW) == LOW;
-}
-
-static void schedule_deferred_beep(unsigned long due_ms, int freq_hz, int duration_ms) {
-    g_deferred_beep_active = true;
-    g_deferred_beep_due_ms = due_ms;
-    g_deferred_beep_freq_hz = freq_hz;
-    g_deferred_beep_duration_ms = duration_ms;
-}
-
-static void service_deferred_beep(unsigned long now_ms_value) {
-    if (!g_deferred_beep_active) return;
-    if (now_ms_value < g_deferred_beep_due_ms) return;
-
-    g_deferred_beep_active = false;
-    if (g_sound_enabled) {
-        beep(g_deferred_beep_freq_hz, g_deferred_beep_duration_ms);
-    }
-}
-
 } // namespace
 
-#if PBIT_ENABLE_GRAPH_LAB
-static bool isHiddenRestoreScreen(Screen screen) {
-    switch (screen) {
-        case BLE_TOGGLE_SCREEN:   // never restore into the secret BLE screen
-        case LAB_DASH_OVERVIEW_SCREEN:
-        case LAB_ICON_SET_A_SCREEN:
-        case LAB_ICON_SET_B_SCREEN:
-        case LAB_ICON_SET_C_SCREEN:
-        case LAB_ICON_SIZES_ENV_SCREEN:
-        case LAB_ICON_SIZES_EXT_SCREEN:
-        case LAB_ICON_TEST_SCREEN:
-            return true;
-        default:
-            return false;
-    }
-}
-#endif
-
 static void configure_app_rotary_bounds() {
 #if PBIT_ENABLE_GRAPH_LAB
     rotaryEncoder.setBoundaries(0, kCarouselCount - 1, true);
@@ -174,95 +123,15 @@ static void configure_app_rotary_bounds() {
     rotaryEncoder.setStepValue(1);
 }
 
-static void configure_soil_ui_rotary_bounds() {
-    SoilCalibrationState state = getSoilCalibrationState();
-    bool circular = (state == SOIL_CAL_MENU || state == SOIL_CAL_EDIT_ALERTS || state == SOIL_CAL_RESET_CONFIRM);
-    rotaryEncoder.setBoundaries(getSoilCalibrationEncoderMin(), getSoilCalibrationEncoderMax(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(getSoilCalibrationEncoderValue());
-}
-
-static void configure_humidity_ui_rotary_bounds() {
-    HumidityMenuState state = get_humidity_menu_state();
-    bool circular = (state == HUM_MODE_MENU
-                  || state == HUM_MODE_EDIT_ALERTS
-                  || state == HUM_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_humidity_encoder_min(), get_humidity_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_humidity_encoder_value());
-}
-
-static void configure_temp_ui_rotary_bounds() {
-    TempMenuState state = get_temp_menu_state();
-    bool circular = (state == TEMP_MODE_MENU
-                  || state == TEMP_MODE_EDIT_UNIT
-                  || state == TEMP_MODE_EDIT_ALERTS
-                  || state == TEMP_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_temp_encoder_min(), get_temp_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_temp_encoder_value());
-}
-
-static void configure_ds18_ui_rotary_bounds() {
-    Ds18MenuState state = get_ds18_menu_state();
-    bool circular = (state == DS18_MODE_MENU
-                  || state == DS18_MODE_EDIT_UNIT
-                  || state == DS18_MODE_EDIT_ALERTS
-                  || state == DS18_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_ds18_encoder_min(), get_ds18_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_ds18_encoder_value());
-}
-
-static void configure_sound_ui_rotary_bounds() {
-    SoundMenuState state = get_sound_menu_state();
-    bool circular = (state == SOUND_MODE_MENU
-                  || state == SOUND_MODE_EDIT_ALERTS
-                  || state == SOUND_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_sound_encoder_min(), get_sound_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_sound_encoder_value());
-}
-
-static void configure_light_ui_rotary_bounds() {
-    LightMenuState state = get_light_menu_state();
-    bool circular = (state == LIGHT_MODE_MENU
-                  || state == LIGHT_MODE_EDIT_DISPLAY
-                  || state == LIGHT_MODE_EDIT_ALERTS
-                  || state == LIGHT_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_light_encoder_min(), get_light_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_light_encoder_value());
-}
-
-static void configure_system_ui_rotary_bounds() {
-    SysMenuState state = get_system_menu_state();
-    bool circular = (state == SYS_MODE_MENU
-                  || state == SYS_MODE_EDIT_SOUND
-                  || state == SYS_MODE_EDIT_SLEEP
-                  || state == SYS_MODE_EDIT_LANG
-                  || state == SYS_MODE_CONFIRM_RESET);
-    rotaryEncoder.setBoundaries(get_system_encoder_min(), get_system_encoder_max(), circular);
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_system_encoder_value());
-}
-
-static void configure_timer_ui_rotary_bounds() {
-    rotaryEncoder.setBoundaries(getTimerMenuEncoderMin(), getTimerMenuEncoderMax(), !timer_menu_is_editing());
-    rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(getTimerMenuEncoderValue());
-}
-
-static void configure_ble_toggle_rotary_bounds() {
-    rotaryEncoder.setBoundaries(get_ble_toggle_encoder_min(), get_ble_toggle_encoder_max(), false);
+static void configure_menu_rotary_bounds(const ScreenMenu& menu) {
+    rotaryEncoder.setBoundaries(menu.encoder_min(), menu.encoder_max(), menu.circular());
     rotaryEncoder.setStepValue(1);
-    rotaryEncoder.setEncoderValue(get_ble_toggle_encoder_value());
+    rotaryEncoder.setEncoderValue(menu.encoder_value());
 }
 
-static void play_double_beep(int first_hz, int second_hz) {
+static void play_double_beep(const ToneStep (&melody)[3]) {
     if (!g_sound_enabled) return;
-    beep(first_hz, 45);
-    schedule_deferred_beep(millis() + 80UL, second_hz, 55);
+    play_tone_sequence(melody, 3);
 }
 
 static void play_soil_nav_beep() {
@@ -275,25 +144,33 @@ static void play_soil_confirm_beep() {
     beep(1250, 28);
 }
 
-static bool isRestorableScreen(Screen screen) {
-    if (screen == BLE_TOGGLE_SCREEN) return false;
-    if (screen < TEMP_SCREEN || screen > LAST_APP_SCREEN) {
-        return false;
-    }
-#if PBIT_ENABLE_GRAPH_LAB
-    if (isHiddenRestoreScreen(screen)) {
-        return false;
-    }
-#endif
-    return true;
-}
-
 static unsigned long now_ms() {
     return (unsigned long)(esp_timer_get_time() / 1000ULL);
 }
 
 
-RotaryEncoder rotaryEncoder(DI_ENCODER_A, DI_ENCODER_B, -1, DO_ENCODER_VCC, ENCODER_STEPS_PER_DETENT);
+EncoderKnob rotaryEncoder;
+
+void EncoderKnob::setBoundaries(long min_value, long max_value, bool circular) {
+    min_ = min_value;
+    max_ = max_value;
+    circular_ = circular;
+    value_ = constrain(value_, min_, max_);
+}
+
+void EncoderKnob::setEncoderValue(long value) {
+    value_ = constrain(value, min_, max_);
+}
+
+long EncoderKnob::applyDetents(int32_t detents) {
+    const long dir = detents > 0 ? 1 : -1;
+    for (int32_t n = detents > 0 ? detents : -detents; n > 0; --n) {
+        value_ += dir * step_;
+        if (value_ > max_) value_ = circular_ ? min_ : max_;
+        if (value_ < min_) value_ = circular_ ? max_ : min_;
+    }
+    return value_;
+}
 
 /**
  * Restore the visible app context when the user wakes the device from IDLE.
@@ -303,10 +180,11 @@ static void exitIdleModeIfNeeded() {
         DPRINTLN("[Power] Leaving IDLE mode.");
 
         g_power_mode = POWER_ACTIVE;
+        power_manager_wake_service();
         runtime_set_ui_overlay(UI_OVERLAY_NONE);
 
         Screen restored_screen = runtime_get_last_active_screen_before_sleep();
-        if (isRestorableScreen(restored_screen)) {
+        if (screen_is_restorable(restored_screen)) {
             active_screen = restored_screen;
         } else {
             active_screen = FIRST_APP_SCREEN;
@@ -327,83 +205,13 @@ void knobCallback(long value) {
     g_last_activity_ms = now_ms(); 
     exitIdleModeIfNeeded();
 
-    if (active_screen == SOIL_SCREEN && soilCalibrationIsActive()) {
-        int previous = getSoilCalibrationEncoderValue();
-        setSoilCalibrationInputValue((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == TEMP_SCREEN && temp_menu_is_active()) {
-        int previous = get_temp_encoder_value();
-        set_temp_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-    
-    if (active_screen == HUMIDITY_SCREEN && humidity_menu_is_active()) {
-        int previous = get_humidity_encoder_value();
-        set_humidity_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep(); // Reuse the lightweight navigation tick.
-        }
-        return;
-    }
-    
-    if (active_screen == DS18B20_SCREEN && ds18_menu_is_active()) {
-        int previous = get_ds18_encoder_value();
-        set_ds18_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == SOUND_SCREEN && sound_menu_is_active()) {
-        int previous = get_sound_encoder_value();
-        set_sound_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == LIGHT_SCREEN && light_menu_is_active()) {
-        int previous = get_light_encoder_value();
-        set_light_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == SYSTEM_SCREEN && system_menu_is_active()) {
-        int previous = get_system_encoder_value();
-        set_system_input_value((int)value);
-        if ((int)value != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == BLE_TOGGLE_SCREEN) {
-        const int previous = get_ble_toggle_encoder_value();
-        set_ble_toggle_input_value((int)value);
-        if (get_ble_toggle_encoder_value() != previous) {
-            play_soil_nav_beep();
-        }
-        return;
-    }
-
-    if (active_screen == TIMER_SCREEN && timer_menu_is_active()) {
-        int previous = getTimerMenuEncoderValue();
-        setTimerMenuEncoderValue((int)value);
-        if (getTimerMenuEncoderValue() != previous) {
-            runtime_request_ui_full_redraw();
+    const ScreenDesc& desc = screen_desc(active_screen);
+    if (screen_menu_is_active(desc)) {
+        const ScreenMenu& menu = *desc.menu;
+        const int previous = menu.encoder_value();
+        menu.set_input((int)value);
+        if (menu.encoder_value() != previous) {
+            if (menu.full_redraw) runtime_request_ui_full_redraw();
             play_soil_nav_beep();
         }
         return;
@@ -426,196 +234,137 @@ void knobCallback(long value) {
     active_screen = requested_screen;
     DPRINT("[Rotary] Switched to screen %d\n", (int)active_screen);
 
+    // The router applies the new screen's LED colour later in this same pass.
     if (g_sound_enabled) beep(800, 15);
+}
+
+static void open_screen_menu(const ScreenMenu& menu) {
+    menu.start();
+    configure_menu_rotary_bounds(menu);
+    if (menu.full_redraw) runtime_request_ui_full_redraw();
+    play_double_beep(MENU_OPEN_BEEP);
+}
 
-    // Screen-level RGB feedback. Light keeps the LED off to avoid polluting the LDR.
-    switch (active_screen) {
-        case TEMP_SCREEN:
-            set_rgb(255, 69, 0); 
-            break;
-        case HUMIDITY_SCREEN:
-            set_rgb(0, 0, 255); 
-            break;
-        case LIGHT_SCREEN:
-            set_rgb(0, 0, 0); // LED apagado: evita incidencia en el LDR
-            break;
-        case SOUND_SCREEN:
-            set_rgb(255, 0, 255); 
-            break;
-        case SOIL_SCREEN:
-            set_rgb(180, 80, 0); 
-            break;
-        case DS18B20_SCREEN:
-            set_rgb(255, 255, 255); 
-            break;
-        case SYSTEM_SCREEN:
-            set_rgb(0, 255, 0);
-            break;
-        case BLE_TOGGLE_SCREEN:
-            set_rgb(0, 80, 255);
-            break;
-        case TIMER_SCREEN:
-            if (userTimerRunning) {
-                set_rgb(0, 255, 0);
-            } else if (userTimerElapsed > 0) {
-                set_rgb(255, 200, 0);
-            } else {
-                set_rgb(0, 0, 255);
-            }
-            break;
-        case GRAPH_SCREEN:
-            set_rgb(0, 80, 80); // Teal neutro para la pantalla de gráfica
-            break;
 #if PBIT_ENABLE_GRAPH_LAB
-        case LAB_HOME_CARDS_SCREEN:
-            set_rgb(0, 150, 210);
-            break;
-        case LAB_LINEAR_DASH_SCREEN:
-            set_rgb(0, 170, 100);
-            break;
-        case LAB_DASH_OVERVIEW_SCREEN:
-            set_rgb(90, 90, 140);
-            break;
-        case LAB_SENSOR_FOCUS_SCREEN:
-            set_rgb(0, 110, 130);
-            break;
-        case LAB_DUAL_TH_SCREEN:
-            set_rgb(0, 140, 180);
-            break;
-        case LAB_ICON_SET_A_SCREEN:
-            set_rgb(180, 80, 255);
-            break;
-        case LAB_ICON_SET_B_SCREEN:
-            set_rgb(80, 180, 255);
-            break;
-        case LAB_ICON_SET_C_SCREEN:
-            set_rgb(255, 120, 80);
-            break;
-        case LAB_GAUGE_TEMP_SCREEN:
-            set_rgb(255, 140, 0);
-            break;
-        case LAB_VALUE_MODERN_SCREEN:
-            set_rgb(255, 0, 180);
-            break;
-        case LAB_SENSOR_CARD_SCREEN:
-            set_rgb(255, 130, 0);
-            break;
-        case LAB_TEMP_CARD_SCREEN:
-            set_rgb(255, 110, 0);
-            break;
-        case LAB_DS18_CARD_SCREEN:
-            set_rgb(255, 255, 255);
-            break;
-        case LAB_WIDGET_MIX_SCREEN:
-            set_rgb(255, 140, 60);
-            break;
-        case LAB_SOUND_VU_STACK_SCREEN:
-            set_rgb(0, 220, 120);
-            break;
-        case LAB_SOUND_VU_WAVE_SCREEN:
-            set_rgb(0, 160, 255);
-            break;
+// Classic screen holding the settings menu of each sensor-zone slot.
+constexpr Screen kSensorMenuScreen[SZ_SENSOR_COUNT] = {
+    TEMP_SCREEN, HUMIDITY_SCREEN, LIGHT_SCREEN, SOUND_SCREEN, SOIL_SCREEN, DS18B20_SCREEN
+};
 #endif
+
+static void handle_timer_long_press() {
+    if (timer_menu_is_active()) {
+        if (!timer_menu_is_editing()) {
+            confirmTimerMenu();
+            runtime_request_ui_full_redraw();
+            if (g_sound_enabled) {
+                play_double_beep(SAVED_BEEP);
+            }
+            configure_app_rotary_bounds();
+        }
+    } else if (userTimerRunning || userTimerElapsed > 0) {
+        if (g_sound_enabled) {
+            beep(2000, 100);
+        }
+        resetUserTimer();
+        set_rgb(0, 0, 255);
+    } else {
+        open_screen_menu(*screen_desc(TIMER_SCREEN).menu);
+    }
+}
+
+// Hold time that triggers the long-press action, 0 for none.
+static unsigned long long_press_threshold_ms(const ScreenDesc& desc) {
+    switch (desc.hold) {
+        case ScreenHold::OpenMenu:
+            return screen_menu_is_active(desc) ? 0 : MENU_LONG_PRESS_MS;
+        case ScreenHold::Timer:
+            if (timer_menu_is_active()) return timer_menu_is_editing() ? 0 : MENU_LONG_PRESS_MS;
+            return TIMER_RESET_LONG_PRESS_MS;
+        case ScreenHold::SensorMenu:
+            return MENU_LONG_PRESS_MS;
         default:
-            set_rgb(0, 0, 0);
-            break;
+            return 0;
     }
 }
 
 static bool handle_button_long_press() {
+    const ScreenDesc& desc = screen_desc(active_screen);
+    switch (desc.hold) {
+        case ScreenHold::OpenMenu:
+            if (screen_menu_is_active(desc)) return false;
+            open_screen_menu(*desc.menu);
+            return true;
+
+        case ScreenHold::Timer:
+            handle_timer_long_press();
+            return true;
+
 #if PBIT_ENABLE_GRAPH_LAB
-    if (active_screen == SENSOR_ZONE_SCREEN) {
-        // Long press: open config menu for the active sensor.
-        // On menu exit, configure_app_rotary_bounds() snaps back to this sensor's slot.
-        switch (sz_get_sensor()) {
-            case SZ_TEMP:  active_screen = TEMP_SCREEN;     start_temp_menu();      configure_temp_ui_rotary_bounds();     break;
-            case SZ_HUM:   active_screen = HUMIDITY_SCREEN; start_humidity_menu();  configure_humidity_ui_rotary_bounds(); break;
-            case SZ_LIGHT: active_screen = LIGHT_SCREEN;    start_light_menu();     configure_light_ui_rotary_bounds();    break;
-            case SZ_SOUND: active_screen = SOUND_SCREEN;    start_sound_menu();     configure_sound_ui_rotary_bounds();    break;
-            case SZ_SOIL:  active_screen = SOIL_SCREEN;     startSoilCalibration(); configure_soil_ui_rotary_bounds();     break;
-            case SZ_DS18:  active_screen = DS18B20_SCREEN;  start_ds18_menu();      configure_ds18_ui_rotary_bounds();     break;
-            default: configure_app_rotary_bounds(); break;
+        case ScreenHold::SensorMenu: {
+            // Long press: open config menu for the active sensor.
+            // On menu exit, configure_app_rotary_bounds() snaps back to this sensor's slot.
+            const uint8_t sensor = sz_get_sensor();
+            if (sensor < SZ_SENSOR_COUNT) {
+                active_screen = kSensorMenuScreen[sensor];
+                open_screen_menu(*screen_desc(active_screen).menu);
+            } else {
+                configure_app_rotary_bounds();
+                play_double_beep(MENU_OPEN_BEEP);
+            }
+            return true;
         }
-        play_double_beep(1200, 1600);
-        return true;
-    }
 #endif
 
-    if (active_screen == SYSTEM_SCREEN && !system_menu_is_active()) {
-        start_system_menu();
-        configure_system_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+        default:
+            return false;
     }
+}
 
-    if (active_screen == TEMP_SCREEN && !temp_menu_is_active()) {
-        start_temp_menu();
-        configure_temp_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+static void soil_wizard_feedback(uint8_t previous_state, uint8_t next_state) {
+    if ((next_state == SOIL_CAL_WAIT_DRY || next_state == SOIL_CAL_THRESH_DRY) && g_sound_enabled) {
+        play_soil_confirm_beep();
     }
-
-    if (active_screen == SOIL_SCREEN && !soilCalibrationIsActive()) {
-        startSoilCalibration();
-        configure_soil_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+    if (next_state == SOIL_CAL_WAIT_WET && g_sound_enabled) {
+        beep(1350, 45);
     }
-
-    if (active_screen == HUMIDITY_SCREEN && !humidity_menu_is_active()) {
-        start_humidity_menu();
-        configure_humidity_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+    if ((next_state == SOIL_CAL_THRESH_OPTIMAL || next_state == SOIL_CAL_THRESH_MOIST || next_state == SOIL_CAL_EDIT_ALERTS) && g_sound_enabled) {
+        beep(1450, 35);
     }
-
-    if (active_screen == DS18B20_SCREEN && !ds18_menu_is_active()) {
-        start_ds18_menu();
-        configure_ds18_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+    if (next_state == SOIL_CAL_DONE || next_state == SOIL_CAL_THRESH_DONE || next_state == SOIL_CAL_ALERTS_DONE || next_state == SOIL_CAL_ERROR) {
+        play_double_beep(SAVED_BEEP);
     }
-
-    if (active_screen == SOUND_SCREEN && !sound_menu_is_active()) {
-        start_sound_menu();
-        configure_sound_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+    if (next_state == SOIL_CAL_IDLE && previous_state == SOIL_CAL_MENU && g_sound_enabled) {
+        beep(900, 22);
     }
+}
 
-    if (active_screen == LIGHT_SCREEN && !light_menu_is_active()) {
-        start_light_menu();
-        configure_light_ui_rotary_bounds();
-        play_double_beep(1200, 1600);
-        return true;
+static void range_feedback(const ScreenMenu& menu, uint8_t next_state) {
+    if (next_state >= menu.confirm_first && next_state <= menu.confirm_last) {
+        if (g_sound_enabled) play_soil_confirm_beep();
     }
-
-    if (active_screen == TIMER_SCREEN) {
-        if (timer_menu_is_active()) {
-            if (!timer_menu_is_editing()) {
-                confirmTimerMenu();
-                runtime_request_ui_full_redraw();
-                if (g_sound_enabled) {
-                    play_double_beep(1300, 1700);
-                }
-                configure_app_rotary_bounds();
-            }
-        } else if (userTimerRunning || userTimerElapsed > 0) {
-            if (g_sound_enabled) {
-                beep(2000, 100);
-            }
-            resetUserTimer();
-            set_rgb(0, 0, 255);
-        } else {
-            startTimerMenu();
-            configure_timer_ui_rotary_bounds();
-            runtime_request_ui_full_redraw();
-            play_double_beep(1200, 1600);
-        }
-        return true;
+    if (menu.saved_state != 0 && next_state == menu.saved_state) {
+        play_double_beep(SAVED_BEEP);
     }
+    if (next_state == 0 && g_sound_enabled) {
+        beep(900, 22);
+    }
+}
 
-    return false;
+// Button release while the screen menu is open.
+static void handle_menu_button(const ScreenMenu& menu) {
+    const uint8_t previous_state = menu.state ? menu.state() : 0;
+    const uint8_t next_state = menu.handle_button();
+    if (menu.full_redraw) runtime_request_ui_full_redraw();
+
+    if (menu.feedback == MenuFeedback::SoilWizard) soil_wizard_feedback(previous_state, next_state);
+    else                                           range_feedback(menu, next_state);
+
+    if (next_state == 0) {
+        configure_app_rotary_bounds();
+    } else {
+        configure_menu_rotary_bounds(menu);
+    }
 }
 
 /**
@@ -626,158 +375,21 @@ void buttonCallback(unsigned long duration) {
     g_last_activity_ms = now_ms(); 
     exitIdleModeIfNeeded();
 
-    if (active_screen == SOIL_SCREEN && soilCalibrationIsActive()) {
-        SoilCalibrationState previous_state = getSoilCalibrationState();
-        uint8_t next_state = handleSoilCalibrationButton();
-        if ((next_state == SOIL_CAL_WAIT_DRY || next_state == SOIL_CAL_THRESH_DRY) && g_sound_enabled) {
-            play_soil_confirm_beep();
-        }
-        if (next_state == SOIL_CAL_WAIT_WET && g_sound_enabled) {
-            beep(1350, 45);
-        }
-        if ((next_state == SOIL_CAL_THRESH_OPTIMAL || next_state == SOIL_CAL_THRESH_MOIST || next_state == SOIL_CAL_EDIT_ALERTS) && g_sound_enabled) {
-            beep(1450, 35);
-        }
-        if (next_state == SOIL_CAL_DONE || next_state == SOIL_CAL_THRESH_DONE || next_state == SOIL_CAL_ALERTS_DONE || next_state == SOIL_CAL_ERROR) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == SOIL_CAL_IDLE && previous_state == SOIL_CAL_MENU && g_sound_enabled) {
-            beep(900, 22);
-        }
-        if (next_state == SOIL_CAL_IDLE) {
-            configure_app_rotary_bounds();
-        } else {
-            configure_soil_ui_rotary_bounds();
-        }
-        return;
-    }
-
-    if (active_screen == TEMP_SCREEN && temp_menu_is_active()) {
-        uint8_t next_state = handle_temp_button();
-        if (next_state >= TEMP_MODE_EDIT_LOW && next_state <= TEMP_MODE_EDIT_ALERTS) {
-            if (g_sound_enabled) play_soil_confirm_beep();
-        }
-        if (next_state == TEMP_MODE_SAVED) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == TEMP_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_temp_ui_rotary_bounds();
-        }
-        return;
-    }
-    
-    if (active_screen == HUMIDITY_SCREEN && humidity_menu_is_active()) {
-        uint8_t next_state = handle_humidity_button();
-        if (next_state == HUM_MODE_EDIT_DRY || next_state == HUM_MODE_EDIT_COMFORT) {
-            if (g_sound_enabled) play_soil_confirm_beep();
-        }
-        if (next_state == HUM_MODE_SAVED) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == HUM_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_humidity_ui_rotary_bounds();
-        }
-        return;
-    }
-    
-    if (active_screen == DS18B20_SCREEN && ds18_menu_is_active()) {
-        uint8_t next_state = handle_ds18_button();
-        if (next_state >= DS18_MODE_EDIT_OFFSET && next_state <= DS18_MODE_EDIT_ALERTS) {
-            if (g_sound_enabled) play_soil_confirm_beep();
-        }
-        if (next_state == DS18_MODE_SAVED) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == DS18_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_ds18_ui_rotary_bounds();
-        }
-        return;
-    }
-
-    if (active_screen == SOUND_SCREEN && sound_menu_is_active()) {
-        uint8_t next_state = handle_sound_button();
-        if (next_state >= SOUND_MODE_EDIT_QUIET && next_state <= SOUND_MODE_EDIT_ALERTS) {
-            if (g_sound_enabled) play_soil_confirm_beep();
-        }
-        if (next_state == SOUND_MODE_SAVED) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == SOUND_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_sound_ui_rotary_bounds();
-        }
-        return;
-    }
-
-    if (active_screen == LIGHT_SCREEN && light_menu_is_active()) {
-        uint8_t next_state = handle_light_button();
-        if (next_state >= LIGHT_MODE_EDIT_DIM && next_state <= LIGHT_MODE_EDIT_ALERTS) {
-            if (g_sound_enabled) play_soil_confirm_beep();
-        }
-        if (next_state == LIGHT_MODE_SAVED) {
-            play_double_beep(1300, 1700);
-        }
-        if (next_state == LIGHT_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_light_ui_rotary_bounds();
-        }
-        return;
-    }
-
-    if (active_screen == SYSTEM_SCREEN && system_menu_is_active()) {
-        uint8_t next_state = handle_system_button();
-        if (next_state != SYS_MODE_NORMAL && g_sound_enabled) {
-            play_soil_confirm_beep();
-        }
-        if (next_state == SYS_MODE_NORMAL) {
-            if (g_sound_enabled) beep(900, 22);
-            configure_app_rotary_bounds();
-        } else {
-            configure_system_ui_rotary_bounds();
-        }
-        return;
-    }
-
-    if (active_screen == TIMER_SCREEN && timer_menu_is_active()) {
-        handleTimerMenuButton();
-        runtime_request_ui_full_redraw();
-        if (g_sound_enabled) {
-            play_soil_confirm_beep();
-        }
-        configure_timer_ui_rotary_bounds();
+    const ScreenDesc& desc = screen_desc(active_screen);
+    if (screen_menu_is_active(desc)) {
+        handle_menu_button(*desc.menu);
         return;
     }
 
-    // -----------------------------------------------------------------
-    // BLE toggle screen: confirm selection → save to NVS → restart.
-    // -----------------------------------------------------------------
-    if (active_screen == BLE_TOGGLE_SCREEN) {
-        handle_ble_toggle_button(); // calls esp_restart() — does not return
+    // Normally consumed while held; kept for releases that skipped it.
+    if (desc.hold == ScreenHold::OpenMenu && duration >= MENU_LONG_PRESS_MS) {
+        open_screen_menu(*desc.menu);
         return;
     }
 
-    // -----------------------------------------------------------------
-    // Short-press behavior on the System screen: toggle the global sound flag.
-    // -----------------------------------------------------------------
-    if (active_screen == SYSTEM_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_system_menu();
-            configure_system_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        } else {
+    switch (desc.press) {
+        case ScreenPress::ToggleSound:
+            // Short-press behavior on the System screen: toggle the global sound flag.
             g_sound_enabled = !g_sound_enabled;
             save_sound_enabled(g_sound_enabled);
             runtime_mark_sensor_data_ready();
@@ -786,190 +398,117 @@ void buttonCallback(unsigned long duration) {
             } else {
                 beep(800, 70);
             }
-        }
-        return;
-    }
+            break;
 
-    if (active_screen == TEMP_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_temp_menu();
-            configure_temp_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        } else {
+        case ScreenPress::ToggleUnit:
             g_is_fahrenheit = !g_is_fahrenheit;
             runtime_mark_sensor_data_ready();
-        }
-        return;
-    }
-
-    if (active_screen == SOIL_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            startSoilCalibration();
-            configure_soil_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        }
-        return;
-    }
-    
-    if (active_screen == HUMIDITY_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_humidity_menu();
-            configure_humidity_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        }
-        return;
-    }
-    
-    if (active_screen == DS18B20_SCREEN && !ds18_menu_is_active()) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_ds18_menu();
-            configure_ds18_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        } else {
-            g_is_fahrenheit = !g_is_fahrenheit;
-            runtime_mark_sensor_data_ready();
-        }
-        return;
-    }
-
-    if (active_screen == SOUND_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_sound_menu();
-            configure_sound_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        }
-        return;
-    }
-
-    if (active_screen == LIGHT_SCREEN) {
-        if (duration >= MENU_LONG_PRESS_MS) {
-            start_light_menu();
-            configure_light_ui_rotary_bounds();
-            play_double_beep(1200, 1600);
-        }
-        return;
-    }
-
-    // -----------------------------------------------------------------
-    // Timer screen behavior: short press toggles run/pause. Long press is handled
-    // while the button is held so idle opens the minute selector and active time resets.
-    // -----------------------------------------------------------------
-
-    if (active_screen == TIMER_SCREEN) {
-        if (g_sound_enabled) {
-            beep(2000, 100); // Timer action tone.
-        }
-
-        if (!userTimerRunning) {
-            startUserTimer();
-            set_rgb(0, 255, 0); 
-        } else {
-            stopUserTimer();
-            set_rgb(255, 200, 0); 
-        }
-        return;
-    }
+            break;
 
-    // -----------------------------------------------------------------
-    // Graph screen behavior: short press cycles between sensors.
-    // -----------------------------------------------------------------
+        case ScreenPress::TimerRunPause:
+            // Short press toggles run/pause. Long press is handled while the
+            // button is held so idle opens the minute selector and active time resets.
+            if (g_sound_enabled) {
+                beep(2000, 100); // Timer action tone.
+            }
+            if (!userTimerRunning) {
+                startUserTimer();
+                set_rgb(0, 255, 0); 
+            } else {
+                stopUserTimer();
+                set_rgb(255, 200, 0); 
+            }
+            break;
 
-    if (active_screen == GRAPH_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            graph_cycle_sensor();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
-    }
+        case ScreenPress::Cycle:
+            // Graph, lab and sensor-zone screens: short press cycles the sensor or view.
+            if (duration < MENU_LONG_PRESS_MS) {
+                desc.cycle();
+                if (g_sound_enabled) beep(800, 15);
+            }
+            break;
 
 #if PBIT_ENABLE_GRAPH_LAB
-    if (active_screen == SENSOR_ZONE_SCREEN) {
-        // Short press: cycle viz mode for the current sensor.
-        if (duration < MENU_LONG_PRESS_MS) {
-            sz_next_viz();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
-    }
-
-    if (active_screen == LAB_SOUND_VU_STACK_SCREEN || active_screen == LAB_SOUND_VU_WAVE_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            active_screen = (active_screen == LAB_SOUND_VU_STACK_SCREEN)
-                ? LAB_SOUND_VU_WAVE_SCREEN
-                : LAB_SOUND_VU_STACK_SCREEN;
-            runtime_request_ui_full_redraw();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
-    }
-
-    if (active_screen == LAB_SENSOR_FOCUS_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            lab_focus_cycle_sensor();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
-    }
+        case ScreenPress::SwapSoundVu:
+            if (duration < MENU_LONG_PRESS_MS) {
+                active_screen = (active_screen == LAB_SOUND_VU_STACK_SCREEN)
+                    ? LAB_SOUND_VU_WAVE_SCREEN
+                    : LAB_SOUND_VU_STACK_SCREEN;
+                runtime_request_ui_full_redraw();
+                if (g_sound_enabled) beep(800, 15);
+            }
+            break;
+#endif
 
-    if (active_screen == LAB_SENSOR_CARD_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            lab_sensor_card_cycle();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
+        default:
+            break;
     }
+}
 
-    if (active_screen == LAB_GAUGE_TEMP_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            lab_gauge_cycle_sensor();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
-    }
+// Turns are batched and reported once per pass, as the library's loop() did.
+static void flush_turns(int32_t detents) {
+    if (detents == 0) return;
+    knobCallback(rotaryEncoder.applyDetents(detents));
+    screen_refresh_settings_ui_flag();
+}
 
-    if (active_screen == LAB_VALUE_MODERN_SCREEN) {
-        if (duration < MENU_LONG_PRESS_MS) {
-            lab_value_cycle_sensor();
-            if (g_sound_enabled) beep(800, 15);
-        }
-        return;
+static void record_button_level(bool pressed, unsigned long at_ms) {
+    if (pressed != g_button_raw_pressed) {
+        g_button_raw_pressed = pressed;
+        g_button_last_change_ms = at_ms;
     }
-#endif
 }
 
 void init_rotary() {
-    // The encoder switch uses an external pull-up, so we keep the library in
-    // floating mode and manage the switch state ourselves in polling.
-    rotaryEncoder.setEncoderType(EncoderType::FLOATING);
-    pinMode((uint8_t)DI_ENCODER_SW, INPUT_PULLUP);
-    
+    input_events_begin();
+
+    // Events queued by the boot menus belong to them, not to the app.
+    InputEvent stale;
+    while (input_events_pop(stale)) {}
+    input_events_take_overflow_detents();
+    input_events_take_button_overflow();
+
     // Screen boundaries cover the visible carousel and exclude BOOT_SCREEN.
     configure_app_rotary_bounds();
-    
-    rotaryEncoder.onTurned(&knobCallback);
-    
-    // Manual polling avoids racing the library's internal timer and reduces
-    // missed or double-consumed button events.
-    rotaryEncoder.begin(false);
+
     const unsigned long now = now_ms();
-    g_button_raw_pressed = is_button_pressed_raw();
+    g_button_raw_pressed = input_button_pressed_now();
     g_button_debounced_pressed = g_button_raw_pressed;
     g_button_last_change_ms = now;
     g_button_press_start_ms = g_button_raw_pressed ? now : 0;
     g_button_long_press_handled = false;
-    g_deferred_beep_active = false;
     DPRINTLN("[Rotary] Initialized.");
 }
 
-void poll_rotary_aux() {
+bool rotary_input_settling() {
+    return g_button_raw_pressed != g_button_debounced_pressed;
+}
+
+void rotary_process_input() {
     const unsigned long now = now_ms();
-    service_deferred_beep(now);
+    const uint32_t now_us = (uint32_t)esp_timer_get_time();
     serviceUserTimer();
 
-    const bool raw_pressed = is_button_pressed_raw();
-    if (raw_pressed != g_button_raw_pressed) {
-        g_button_raw_pressed = raw_pressed;
-        g_button_last_change_ms = now;
+    // Button edges carry their ISR timestamp; pending turns are flushed before
+    // each edge so a turn-then-press keeps its order.
+    int32_t detents = 0;
+    InputEvent ev;
+    while (input_events_pop(ev)) {
+        if (ev.type == InputEventType::Turn) {
+            detents += ev.value;
+            continue;
+        }
+        flush_turns(detents);
+        detents = 0;
+        const int32_t age_us = (int32_t)(now_us - ev.t_us);   // < 0 if queued after now_us
+        record_button_level(ev.value != 0, now - (unsigned long)(age_us > 0 ? age_us / 1000 : 0));
+    }
+    flush_turns(detents + input_events_take_overflow_detents());
+
+    // Edges can be dropped on a full ring, or missed inside a light-sleep
+    // window in IDLE: fall back to the pin level in those cases.
+    if (input_events_take_button_overflow() || g_power_mode == POWER_IDLE) {
+        record_button_level(input_button_pressed_now(), now);
     }
 
     if ((now - g_button_last_change_ms) >= BUTTON_DEBOUNCE_MS
@@ -977,7 +516,7 @@ void poll_rotary_aux() {
         g_button_debounced_pressed = g_button_raw_pressed;
 
         if (g_button_debounced_pressed) {
-            g_button_press_start_ms = now;
+            g_button_press_start_ms = g_button_last_change_ms;
             g_button_long_press_handled = false;
             g_ble_secret_eligible = (active_screen == SYSTEM_SCREEN && !system_menu_is_active());
             g_ble_secret_fired = false;
@@ -989,6 +528,7 @@ void poll_rotary_aux() {
             g_last_activity_ms = now;
             if (!g_button_long_press_handled) {
                 buttonCallback(now - g_button_press_start_ms);
+                screen_refresh_settings_ui_flag();
             }
         }
     }
@@ -1006,10 +546,12 @@ void poll_rotary_aux() {
             && (now - g_button_press_start_ms) >= BLE_SECRET_PRESS_MS) {
         g_ble_secret_fired = true;
         g_button_long_press_handled = true; // suppress buttonCallback on release
-        init_ble_toggle_screen();
         active_screen = BLE_TOGGLE_SCREEN;
-        configure_ble_toggle_rotary_bounds();
+        const ScreenMenu& ble_menu = *screen_desc(BLE_TOGGLE_SCREEN).menu;
+        ble_menu.start();
+        configure_menu_rotary_bounds(ble_menu);
         runtime_request_ui_full_redraw();
+        screen_refresh_settings_ui_flag();
         beep(1800, 150);
         return;
     }
@@ -1018,32 +560,13 @@ void poll_rotary_aux() {
         return;
     }
 
-    unsigned long threshold_ms = 0;
-    if (active_screen == TIMER_SCREEN) {
-        if (timer_menu_is_active()) {
-            threshold_ms = timer_menu_is_editing() ? 0 : MENU_LONG_PRESS_MS;
-        } else {
-            threshold_ms = TIMER_RESET_LONG_PRESS_MS;
-        }
-    } else if ((active_screen == TEMP_SCREEN && !temp_menu_is_active())
-            || (active_screen == HUMIDITY_SCREEN && !humidity_menu_is_active())
-            || (active_screen == LIGHT_SCREEN && !light_menu_is_active())
-            || (active_screen == SOUND_SCREEN && !sound_menu_is_active())
-            || (active_screen == SOIL_SCREEN && !soilCalibrationIsActive())
-            || (active_screen == DS18B20_SCREEN && !ds18_menu_is_active())
-            || (active_screen == SYSTEM_SCREEN && !system_menu_is_active())
-#if PBIT_ENABLE_GRAPH_LAB
-            || active_screen == SENSOR_ZONE_SCREEN
-#endif
-            ) {
-        threshold_ms = MENU_LONG_PRESS_MS;
-    }
-
+    const unsigned long threshold_ms = long_press_threshold_ms(screen_desc(active_screen));
     if (threshold_ms == 0 || (now - g_button_press_start_ms) < threshold_ms) {
         return;
     }
 
     if (handle_button_long_press()) {
         g_button_long_press_handled = true;
+        screen_refresh_settings_ui_flag();
     }
 }
@@ -4,6 +4,7 @@
 namespace {
 
 portMUX_TYPE g_runtime_events_mux = portMUX_INITIALIZER_UNLOCKED;
+volatile bool g_app_ready = false;
 
 } // namespace
 
@@ -69,3 +70,11 @@ Screen runtime_get_last_active_screen_before_sleep() {
     portEXIT_CRITICAL(&g_runtime_events_mux);
     return screen;
 }
+
+void runtime_mark_app_ready() {
+    g_app_ready = true;
+}
+
+bool runtime_app_ready() {
+    return g_app_ready;
+}
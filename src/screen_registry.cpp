@@ -0,0 +1,252 @@
+// screen_registry.cpp
+// One constexpr descriptor per Screen: draw, LED colour, menu and input actions.
+
+#include "screen_registry.h"
+#include "led_control.h"
+#include "hw.h"
+#include "timer.h"
+#include "ui_widgets.h"
+#include "ui_ble_toggle.h"
+#include "ui_temp.h"
+#include "ui_humidity.h"
+#include "ui_light.h"
+#include "ui_sound.h"
+#include "ui_soil.h"
+#include "ui_ds18.h"
+#include "ui_system.h"
+#include "ui_timer.h"
+#include "ui_graph.h"
+#if PBIT_ENABLE_GRAPH_LAB
+#include "sensor_zone.h"
+#include "ui_lab_dash.h"
+#include "ui_lab_focus.h"
+#include "ui_lab_dual.h"
+#include "ui_lab_icon_gallery.h"
+#include "ui_lab_sensor_cards.h"
+#include "ui_lab_sound_vu.h"
+#include "ui_lab_widget_showcase.h"
+#include "ui_lab_icon_sizes.h"
+#include "ui_lab_home_cards.h"
+#include "ui_lab_linear_dash.h"
+#include "ui_lab_icon_test.h"
+#endif
+
+namespace {
+
+volatile bool g_settings_ui_active = false;
+
+// Most screens ignore the periodic tick.
+template <void (*Draw)(bool, bool)>
+void draw_plain(bool screen_changed, bool data_changed, bool) {
+    Draw(screen_changed, data_changed);
+}
+
+// --- Periodic refresh ---
+
+uint16_t timer_refresh_ms()  { return timer_display_uses_centiseconds() ? 20 : 100; }
+uint16_t system_refresh_ms() { return 100; }
+uint16_t soil_refresh_ms()   { return soilCalibrationIsActive() ? 180 : 0; }
+
+// --- Dynamic LED colours ---
+
+void soil_rgb() {
+    const float soil = g_ui_readings_snapshot.soil_humidity;
+    if (isnan(soil)) {
+        set_rgb(120, 0, 0);
+    } else if (soil < (float)get_soil_threshold_dry()) {
+        set_rgb(255, 0, 0);
+    } else if (soil < (float)get_soil_threshold_optimal()) {
+        set_rgb(0, 255, 0);
+    } else {
+        set_rgb(0, 0, 200);
+    }
+}
+
+void timer_rgb() {
+    if (userTimerRunning) {
+        set_rgb(0, 255, 0);
+    } else if (userTimerElapsed > 0) {
+        set_rgb(255, 200, 0);
+    } else {
+        set_rgb(0, 0, 255);
+    }
+}
+
+// --- Menu adapters ---
+
+bool temp_circular() {
+    const TempMenuState s = get_temp_menu_state();
+    return s == TEMP_MODE_MENU || s == TEMP_MODE_EDIT_UNIT
+        || s == TEMP_MODE_EDIT_ALERTS || s == TEMP_MODE_CONFIRM_RESET;
+}
+
+bool humidity_circular() {
+    const HumidityMenuState s = get_humidity_menu_state();
+    return s == HUM_MODE_MENU || s == HUM_MODE_EDIT_ALERTS || s == HUM_MODE_CONFIRM_RESET;
+}
+
+bool ds18_circular() {
+    const Ds18MenuState s = get_ds18_menu_state();
+    return s == DS18_MODE_MENU || s == DS18_MODE_EDIT_UNIT
+        || s == DS18_MODE_EDIT_ALERTS || s == DS18_MODE_CONFIRM_RESET;
+}
+
+bool sound_circular() {
+    const SoundMenuState s = get_sound_menu_state();
+    return s == SOUND_MODE_MENU || s == SOUND_MODE_EDIT_ALERTS || s == SOUND_MODE_CONFIRM_RESET;
+}
+
+bool light_circular() {
+    const LightMenuState s = get_light_menu_state();
+    return s == LIGHT_MODE_MENU || s == LIGHT_MODE_EDIT_DISPLAY
+        || s == LIGHT_MODE_EDIT_ALERTS || s == LIGHT_MODE_CONFIRM_RESET;
+}
+
+bool system_circular() {
+    const SysMenuState s = get_system_menu_state();
+    return s == SYS_MODE_MENU || s == SYS_MODE_EDIT_SOUND || s == SYS_MODE_EDIT_SLEEP
+        || s == SYS_MODE_EDIT_LANG || s == SYS_MODE_CONFIRM_RESET;
+}
+
+bool soil_circular() {
+    const SoilCalibrationState s = getSoilCalibrationState();
+    return s == SOIL_CAL_MENU || s == SOIL_CAL_EDIT_ALERTS || s == SOIL_CAL_RESET_CONFIRM;
+}
+
+uint8_t soil_state() { return getSoilCalibrationState(); }
+
+bool timer_circular() { return !timer_menu_is_editing(); }
+
+// The timer menu only closes from a long press (confirmTimerMenu).
+uint8_t timer_menu_button() {
+    handleTimerMenuButton();
+    return 1;
+}
+
+// The BLE screen is a menu for its whole life; its button restarts the board.
+bool ble_always_active() { return true; }
+bool never_circular() { return false; }
+
+//                          is_active                 start                  encoder_min                   encoder_max                   encoder_value                   set_input                     circular           state       handle_button                feedback                  confirm_first          confirm_last           saved_state        full_redraw
+constexpr ScreenMenu kTempMenu   = { temp_menu_is_active,      start_temp_menu,       get_temp_encoder_min,         get_temp_encoder_max,         get_temp_encoder_value,         set_temp_input_value,         temp_circular,     nullptr,    handle_temp_button,          MenuFeedback::Range,      TEMP_MODE_EDIT_LOW,    TEMP_MODE_EDIT_ALERTS,  TEMP_MODE_SAVED,   false };
+constexpr ScreenMenu kHumMenu    = { humidity_menu_is_active,  start_humidity_menu,   get_humidity_encoder_min,     get_humidity_encoder_max,     get_humidity_encoder_value,     set_humidity_input_value,     humidity_circular, nullptr,    handle_humidity_button,      MenuFeedback::Range,      HUM_MODE_EDIT_DRY,     HUM_MODE_EDIT_COMFORT,  HUM_MODE_SAVED,    false };
+constexpr ScreenMenu kLightMenu  = { light_menu_is_active,     start_light_menu,      get_light_encoder_min,        get_light_encoder_max,        get_light_encoder_value,        set_light_input_value,        light_circular,    nullptr,    handle_light_button,         MenuFeedback::Range,      LIGHT_MODE_EDIT_DIM,   LIGHT_MODE_EDIT_ALERTS, LIGHT_MODE_SAVED,  false };
+constexpr ScreenMenu kSoundMenu  = { sound_menu_is_active,     start_sound_menu,      get_sound_encoder_min,        get_sound_encoder_max,        get_sound_encoder_value,        set_sound_input_value,        sound_circular,    nullptr,    handle_sound_button,         MenuFeedback::Range,      SOUND_MODE_EDIT_QUIET, SOUND_MODE_EDIT_ALERTS, SOUND_MODE_SAVED,  false };
+constexpr ScreenMenu kSoilMenu   = { soilCalibrationIsActive,  startSoilCalibration,  getSoilCalibrationEncoderMin, getSoilCalibrationEncoderMax, getSoilCalibrationEncoderValue, setSoilCalibrationInputValue, soil_circular,     soil_state, handleSoilCalibrationButton, MenuFeedback::SoilWizard, 0,                     0,                      0,                 false };
+constexpr ScreenMenu kDs18Menu   = { ds18_menu_is_active,      start_ds18_menu,       get_ds18_encoder_min,         get_ds18_encoder_max,         get_ds18_encoder_value,         set_ds18_input_value,         ds18_circular,     nullptr,    handle_ds18_button,          MenuFeedback::Range,      DS18_MODE_EDIT_OFFSET, DS18_MODE_EDIT_ALERTS,  DS18_MODE_SAVED,   false };
+constexpr ScreenMenu kSystemMenu = { system_menu_is_active,    start_system_menu,     get_system_encoder_min,       get_system_encoder_max,       get_system_encoder_value,       set_system_input_value,       system_circular,   nullptr,    handle_system_button,        MenuFeedback::Range,      SYS_MODE_MENU,         SYS_MODE_SAVED,         0,                 false };
+constexpr ScreenMenu kTimerMenu  = { timer_menu_is_active,     startTimerMenu,        getTimerMenuEncoderMin,       getTimerMenuEncoderMax,       getTimerMenuEncoderValue,       setTimerMenuEncoderValue,     timer_circular,    nullptr,    timer_menu_button,           MenuFeedback::Range,      1,                     1,                      0,                 true  };
+constexpr ScreenMenu kBleMenu    = { ble_always_active,        init_ble_toggle_screen, get_ble_toggle_encoder_min,  get_ble_toggle_encoder_max,   get_ble_toggle_encoder_value,   set_ble_toggle_input_value,   never_circular,    nullptr,    handle_ble_toggle_button,    MenuFeedback::Range,      1,                     0,                      0,                 false };
+
+#if PBIT_ENABLE_GRAPH_LAB
+void sensor_zone_rgb() {
+    uint8_t r, g, b;
+    sz_sensor_rgb(sz_get_sensor(), r, g, b);
+    set_rgb(r, g, b);
+}
+
+// The sensor zone reuses the lab renderers for the active sensor and view.
+void draw_sensor_zone(bool screen_changed, bool data_changed, bool) {
+    sz_set_active(true);
+    sz_sync_renderer(screen_changed);
+    switch (sz_get_viz()) {
+        case SZ_VIZ_CARD:  draw_lab_sensor_card_screen(screen_changed, data_changed);  break;
+        case SZ_VIZ_VALOR: draw_lab_value_modern_screen(screen_changed, data_changed); break;
+        case SZ_VIZ_FOCUS: draw_lab_focus_screen(screen_changed, data_changed);        break;
+        case SZ_VIZ_GRAPH: draw_graph_screen(screen_changed, data_changed);            break;
+        case SZ_VIZ_GAUGE: draw_lab_gauge_temp_screen(screen_changed, data_changed);   break;
+        default: break;
+    }
+    if (screen_changed) drawHeader(sz_header_name());
+    sz_set_active(false);
+}
+#endif
+
+constexpr uint8_t R = SCREEN_RESTORABLE;
+
+#if PBIT_ENABLE_GRAPH_LAB
+// Gallery rows keep their slot but drop their draw code when the gallery is off.
+#if PBIT_ENABLE_LAB_GALLERY
+#define GALLERY_DRAW(fn) draw_plain<fn>
+constexpr uint8_t G = SCREEN_RESTORABLE;
+#else
+#define GALLERY_DRAW(fn) nullptr
+constexpr uint8_t G = 0;
+#endif
+#endif
+
+// Rows must follow the Screen enum order (checked below).
+//  id                         draw                                            refresh_ms         rgb              rgb_fn           flags               menu          press                      cycle                   hold
+constexpr ScreenDesc kScreens[] = {
+    { BOOT_SCREEN,               nullptr,                                        nullptr,           SCREEN_RGB_KEEP, nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { TEMP_SCREEN,               draw_plain<draw_temp_screen>,                   nullptr,           0xFF4500,        nullptr,         R,                  &kTempMenu,   ScreenPress::ToggleUnit,    nullptr,                ScreenHold::OpenMenu },
+    { HUMIDITY_SCREEN,           draw_plain<draw_humidity_screen>,               nullptr,           0x0000FF,        nullptr,         R,                  &kHumMenu,    ScreenPress::None,          nullptr,                ScreenHold::OpenMenu },
+    { LIGHT_SCREEN,              draw_plain<draw_light_screen>,                  nullptr,           0x000000,        nullptr,         R | SCREEN_LED_DARK, &kLightMenu, ScreenPress::None,          nullptr,                ScreenHold::OpenMenu },
+    { SOUND_SCREEN,              draw_plain<draw_sound_screen>,                  nullptr,           0xFF00FF,        nullptr,         R,                  &kSoundMenu,  ScreenPress::None,          nullptr,                ScreenHold::OpenMenu },
+    { SOIL_SCREEN,               draw_plain<draw_soil_screen>,                   soil_refresh_ms,   0,               soil_rgb,        R,                  &kSoilMenu,   ScreenPress::None,          nullptr,                ScreenHold::OpenMenu },
+    { DS18B20_SCREEN,            draw_plain<draw_ds18_screen>,                   nullptr,           0xFFFFFF,        nullptr,         R,                  &kDs18Menu,   ScreenPress::ToggleUnit,    nullptr,                ScreenHold::OpenMenu },
+    { SYSTEM_SCREEN,             draw_plain<draw_system_screen>,                 system_refresh_ms, 0x00FF00,        nullptr,         R,                  &kSystemMenu, ScreenPress::ToggleSound,   nullptr,                ScreenHold::OpenMenu },
+    { TIMER_SCREEN,              draw_timer_screen,                              timer_refresh_ms,  0,               timer_rgb,       R,                  &kTimerMenu,  ScreenPress::TimerRunPause, nullptr,                ScreenHold::Timer },
+    { GRAPH_SCREEN,              draw_plain<draw_graph_screen>,                  nullptr,           0x005050,        nullptr,         R,                  nullptr,      ScreenPress::Cycle,         graph_cycle_sensor,     ScreenHold::None },
+    { BLE_TOGGLE_SCREEN,         draw_plain<draw_ble_toggle_screen>,             nullptr,           0x0050FF,        nullptr,         0,                  &kBleMenu,    ScreenPress::None,          nullptr,                ScreenHold::None },
+#if PBIT_ENABLE_GRAPH_LAB
+    { LAB_DASH_OVERVIEW_SCREEN,  GALLERY_DRAW(draw_lab_dash_screen),             nullptr,           0x5A5A8C,        nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_SENSOR_FOCUS_SCREEN,   GALLERY_DRAW(draw_lab_focus_screen),            nullptr,           0x006E82,        nullptr,         G,                  nullptr,      ScreenPress::Cycle,         lab_focus_cycle_sensor, ScreenHold::None },
+    { LAB_DUAL_TH_SCREEN,        draw_plain<draw_lab_dual_th_screen>,            nullptr,           0x008CB4,        nullptr,         R,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_ICON_SET_A_SCREEN,     GALLERY_DRAW(draw_lab_icon_set_a_screen),       nullptr,           0xB450FF,        nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_ICON_SET_B_SCREEN,     GALLERY_DRAW(draw_lab_icon_set_b_screen),       nullptr,           0x50B4FF,        nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_ICON_SET_C_SCREEN,     GALLERY_DRAW(draw_lab_icon_set_c_screen),       nullptr,           0xFF7850,        nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_GAUGE_TEMP_SCREEN,     GALLERY_DRAW(draw_lab_gauge_temp_screen),       nullptr,           0xFF8C00,        nullptr,         G,                  nullptr,      ScreenPress::Cycle,         lab_gauge_cycle_sensor, ScreenHold::None },
+    { LAB_VALUE_MODERN_SCREEN,   GALLERY_DRAW(draw_lab_value_modern_screen),     nullptr,           0xFF00B4,        nullptr,         G,                  nullptr,      ScreenPress::Cycle,         lab_value_cycle_sensor, ScreenHold::None },
+    { LAB_SENSOR_CARD_SCREEN,    GALLERY_DRAW(draw_lab_sensor_card_screen),      nullptr,           0xFF8200,        nullptr,         G,                  nullptr,      ScreenPress::Cycle,         lab_sensor_card_cycle,  ScreenHold::None },
+    { LAB_TEMP_CARD_SCREEN,      GALLERY_DRAW(draw_lab_temp_card_screen),        nullptr,           0xFF6E00,        nullptr,         G,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_DS18_CARD_SCREEN,      GALLERY_DRAW(draw_lab_ds18_card_screen),        nullptr,           0xFFFFFF,        nullptr,         G,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_WIDGET_MIX_SCREEN,     draw_plain<draw_lab_widget_mix_screen>,         nullptr,           0xFF8C3C,        nullptr,         R,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_SOUND_VU_STACK_SCREEN, draw_plain<draw_lab_sound_vu_stack_screen>,     nullptr,           0x00DC78,        nullptr,         R,                  nullptr,      ScreenPress::SwapSoundVu,   nullptr,                ScreenHold::None },
+    { LAB_SOUND_VU_WAVE_SCREEN,  draw_plain<draw_lab_sound_vu_wave_screen>,      nullptr,           0x00A0FF,        nullptr,         R,                  nullptr,      ScreenPress::SwapSoundVu,   nullptr,                ScreenHold::None },
+    { LAB_ICON_SIZES_ENV_SCREEN, GALLERY_DRAW(draw_lab_icon_sizes_env_screen),   nullptr,           SCREEN_RGB_KEEP, nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_ICON_SIZES_EXT_SCREEN, GALLERY_DRAW(draw_lab_icon_sizes_ext_screen),   nullptr,           SCREEN_RGB_KEEP, nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_HOME_CARDS_SCREEN,     draw_plain<draw_lab_home_cards_screen>,         nullptr,           0x0096D2,        nullptr,         R,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_LINEAR_DASH_SCREEN,    GALLERY_DRAW(draw_lab_linear_dash_screen),      nullptr,           0x00AA64,        nullptr,         G,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { LAB_ICON_TEST_SCREEN,      GALLERY_DRAW(draw_lab_icon_test_screen),        nullptr,           0xFFA500,        nullptr,         0,                  nullptr,      ScreenPress::None,          nullptr,                ScreenHold::None },
+    { SENSOR_ZONE_SCREEN,        draw_sensor_zone,                               nullptr,           0,               sensor_zone_rgb, R,                  nullptr,      ScreenPress::Cycle,         sz_next_viz,            ScreenHold::SensorMenu },
+#endif
+};
+
+static_assert(sizeof(kScreens) / sizeof(kScreens[0]) == SCREEN_COUNT, "one row per Screen");
+
+constexpr bool rows_follow_enum(uint8_t i = 0) {
+    return i >= SCREEN_COUNT || (kScreens[i].id == (Screen)i && rows_follow_enum(i + 1));
+}
+static_assert(rows_follow_enum(), "kScreens rows must follow the Screen enum order");
+
+} // namespace
+
+const ScreenDesc& screen_desc(Screen screen) {
+    return kScreens[(uint8_t)screen < SCREEN_COUNT ? (uint8_t)screen : (uint8_t)BOOT_SCREEN];
+}
+
+bool screen_is_restorable(uint8_t screen) {
+    return screen < SCREEN_COUNT && (kScreens[screen].flags & SCREEN_RESTORABLE) != 0;
+}
+
+bool screen_menu_is_active(const ScreenDesc& desc) {
+    return desc.menu != nullptr && desc.menu->is_active();
+}
+
+void screen_apply_idle_rgb(Screen screen) {
+    const ScreenDesc& desc = screen_desc(screen);
+    if (desc.rgb_fn != nullptr) {
+        desc.rgb_fn();
+    } else if (desc.rgb != SCREEN_RGB_KEEP) {
+        set_rgb((uint8_t)(desc.rgb >> 16), (uint8_t)(desc.rgb >> 8), (uint8_t)desc.rgb);
+    }
+}
+
+void screen_refresh_settings_ui_flag() {
+    g_settings_ui_active = screen_menu_is_active(screen_desc(active_screen));
+}
+
+bool screen_settings_ui_active() {
+    return g_settings_ui_active;
+}
@@ -1,11 +1,96 @@
 #include "settings_store.h"
 
 #include <Preferences.h>
+#include <esp_rom_crc.h>
+#include <string.h>
+#include "config.h"
 
 namespace {
 
 constexpr char PREFS_NAMESPACE[] = "pbit";
 
+// All user settings live in one blob under this key. BLE gate, build stamp
+// and language keep their own keys: they are device state, not settings.
+constexpr char SETTINGS_BLOB_KEY[] = "cfg";
+constexpr uint16_t SETTINGS_BLOB_MAGIC = 0x5043;   // "PC"
+constexpr uint16_t SETTINGS_SCHEMA_VERSION = 1;
+
+// Write-back: saves only touch the RAM record; the loop task writes the blob
+// once edits settle.
+constexpr uint32_t FLUSH_DEBOUNCE_MS = 2000;       // quiet time after the last edit
+constexpr uint32_t FLUSH_MAX_DELAY_MS = 10000;     // upper bound while edits keep coming
+
+constexpr uint8_t SZ_SENSOR_SLOTS = 6;
+
+// Set once a group has been saved; unset groups fall back to caller defaults.
+enum SettingsGroup : uint32_t {
+    GROUP_SOIL_CAL   = 1u << 0,
+    GROUP_SOIL_THR   = 1u << 1,
+    GROUP_SOIL_AEN   = 1u << 2,
+    GROUP_HUM_THR    = 1u << 3,
+    GROUP_HUM_AEN    = 1u << 4,
+    GROUP_DS18       = 1u << 5,
+    GROUP_DS18_AEN   = 1u << 6,
+    GROUP_SOUND      = 1u << 7,
+    GROUP_SOUND_AEN  = 1u << 8,
+    GROUP_TEMP       = 1u << 9,
+    GROUP_TEMP_AEN   = 1u << 10,
+    GROUP_LIGHT_THR  = 1u << 11,
+    GROUP_LIGHT_MODE = 1u << 12,
+    GROUP_LIGHT_AEN  = 1u << 13,
+    GROUP_SYS_SLEEP  = 1u << 14,
+    GROUP_SYS_SOUND  = 1u << 15,
+};
+
+struct SettingsBlobHeader {
+    uint16_t magic;
+    uint16_t version;
+    uint16_t length;      // payload bytes following the header
+    uint16_t reserved;
+    uint32_t crc;         // CRC-32 of the payload
+};
+
+// Schema v1. Append fields at the end and bump SETTINGS_SCHEMA_VERSION,
+// adding a migrate_vN_to_vN1() step below.
+struct SettingsRecord {
+    uint32_t groups;
+    int32_t  soil_dry;
+    int32_t  soil_wet;
+    int32_t  soil_thr_dry;
+    int32_t  soil_thr_opt;
+    int32_t  soil_thr_moi;
+    int32_t  hum_dry_max;
+    int32_t  hum_comf_max;
+    int32_t  d18_off;
+    int32_t  d18_alow;
+    int32_t  d18_ahigh;
+    int32_t  snd_quiet;
+    int32_t  snd_norm;
+    int32_t  snd_loud;
+    int32_t  tmp_low;
+    int32_t  tmp_high;
+    int32_t  lgt_dim;
+    int32_t  lgt_ind;
+    int32_t  lgt_bri;
+    uint32_t sys_sleep;
+    uint8_t  lgt_mode;
+    uint8_t  soil_aen;
+    uint8_t  hum_aen;
+    uint8_t  d18_aen;
+    uint8_t  snd_aen;
+    uint8_t  tmp_aen;
+    uint8_t  lgt_aen;
+    uint8_t  sys_sound;
+    uint8_t  sz_sen;
+    uint8_t  sz_viz[SZ_SENSOR_SLOTS];
+    uint8_t  pad;
+};
+
+struct SettingsBlob {
+    SettingsBlobHeader header;
+    SettingsRecord record;
+};
+
 class ScopedPrefs {
 public:
     explicit ScopedPrefs(bool read_only) {
@@ -19,204 +104,504 @@ public:
     Preferences prefs;
 };
 
+portMUX_TYPE g_record_mux = portMUX_INITIALIZER_UNLOCKED;
+SettingsRecord g_record = {};
+bool g_loaded = false;
+bool g_dirty = false;
+uint32_t g_edit_seq = 0;          // bumped by every update(), so a flush can tell if it raced an edit
+SettingsLoadResult g_load_result = SettingsLoadResult::Loaded;
+uint32_t g_first_dirty_ms = 0;
+uint32_t g_last_dirty_ms = 0;
+
+uint32_t record_crc(const SettingsRecord& rec, size_t length) {
+    return esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&rec), length);
+}
+
+// --- Migrations -----------------------------------------------------------
+
+// v0: one NVS key per setting (firmware before the blob). Copies every key
+// that exists and marks its group, so calibration survives the upgrade.
+void migrate_legacy_keys(Preferences& p, SettingsRecord& rec) {
+    auto has = [&](const char* key) { return p.isKey(key); };
+
+    if (has("soil_dry") && has("soil_wet")) {
+        rec.soil_dry = p.getInt("soil_dry");
+        rec.soil_wet = p.getInt("soil_wet");
+        rec.groups |= GROUP_SOIL_CAL;
+    }
+    if (has("soil_thr_dry")) {
+        rec.soil_thr_dry = p.getInt("soil_thr_dry");
+        rec.soil_thr_opt = p.getInt("soil_thr_opt");
+        rec.soil_thr_moi = p.getInt("soil_thr_moi");
+        rec.groups |= GROUP_SOIL_THR;
+    }
+    if (has("soil_aen")) { rec.soil_aen = p.getBool("soil_aen"); rec.groups |= GROUP_SOIL_AEN; }
+
+    if (has("hum_dry_max")) {
+        rec.hum_dry_max = p.getInt("hum_dry_max");
+        rec.hum_comf_max = p.getInt("hum_comf_max");
+        rec.groups |= GROUP_HUM_THR;
+    }
+    if (has("hum_alert_en")) { rec.hum_aen = p.getBool("hum_alert_en"); rec.groups |= GROUP_HUM_AEN; }
+
+    if (has("d18_off")) {
+        rec.d18_off = p.getInt("d18_off");
+        rec.d18_alow = p.getInt("d18_alow");
+        rec.d18_ahigh = p.getInt("d18_ahigh");
+        rec.groups |= GROUP_DS18;
+    }
+    if (has("d18_aen")) { rec.d18_aen = p.getBool("d18_aen"); rec.groups |= GROUP_DS18_AEN; }
+
+    if (has("snd_quiet")) {
+        rec.snd_quiet = p.getInt("snd_quiet");
+        rec.snd_norm = p.getInt("snd_norm");
+        rec.snd_loud = p.getInt("snd_loud");
+        rec.groups |= GROUP_SOUND;
+    }
+    if (has("snd_aen")) { rec.snd_aen = p.getBool("snd_aen"); rec.groups |= GROUP_SOUND_AEN; }
+
+    if (has("tmp_low")) {
+        rec.tmp_low = p.getInt("tmp_low");
+        rec.tmp_high = p.getInt("tmp_high");
+        rec.groups |= GROUP_TEMP;
+    }
+    if (has("tmp_aen")) { rec.tmp_aen = p.getBool("tmp_aen"); rec.groups |= GROUP_TEMP_AEN; }
+
+    if (has("lgt_dim")) {
+        rec.lgt_dim = p.getInt("lgt_dim");
+        rec.lgt_ind = p.getInt("lgt_ind");
+        rec.lgt_bri = p.getInt("lgt_bri");
+        rec.groups |= GROUP_LIGHT_THR;
+    }
+    if (has("lgt_mode")) { rec.lgt_mode = p.getUChar("lgt_mode"); rec.groups |= GROUP_LIGHT_MODE; }
+    if (has("lgt_aen")) { rec.lgt_aen = p.getBool("lgt_aen"); rec.groups |= GROUP_LIGHT_AEN; }
+
+    if (has("sys_sleep")) { rec.sys_sleep = p.getUInt("sys_sleep"); rec.groups |= GROUP_SYS_SLEEP; }
+    if (has("sys_sound")) { rec.sys_sound = p.getBool("sys_sound"); rec.groups |= GROUP_SYS_SOUND; }
+
+    rec.sz_sen = p.getUChar("sz_sen", 0);
+    for (uint8_t i = 0; i < SZ_SENSOR_SLOTS; ++i) {
+        char key[6];
+        snprintf(key, sizeof(key), "sz_v%u", (unsigned)i);
+        rec.sz_viz[i] = p.getUChar(key, 0);
+    }
+}
+
+void remove_legacy_keys(Preferences& p) {
+    static const char* const kLegacyKeys[] = {
+        "soil_dry", "soil_wet", "soil_thr_dry", "soil_thr_opt", "soil_thr_moi", "soil_aen",
+        "hum_dry_max", "hum_comf_max", "hum_alert_en",
+        "d18_off", "d18_alow", "d18_ahigh", "d18_aen",
+        "snd_quiet", "snd_norm", "snd_loud", "snd_aen",
+        "tmp_low", "tmp_high", "tmp_aen",
+        "lgt_dim", "lgt_ind", "lgt_bri", "lgt_mode", "lgt_aen",
+        "sys_sleep", "sys_sound",
+        "sz_sen", "sz_v0", "sz_v1", "sz_v2", "sz_v3", "sz_v4", "sz_v5",
+    };
+    for (const char* key : kLegacyKeys) {
+        if (p.isKey(key)) p.remove(key);
+    }
+}
+
+// Bring a blob from any released version up to SETTINGS_SCHEMA_VERSION,
+// one case per step, falling through. Fields added by later versions start
+// zeroed with their group bit clear, i.e. at caller defaults. Only version 0
+// and versions newer than this firmware are unknown.
+bool migrate_blob(uint16_t version, SettingsRecord& rec) {
+    if (version == 0 || version > SETTINGS_SCHEMA_VERSION) return false;
+    switch (version) {
+        case 1:
+            // Current schema.
+            (void)rec;
+            break;
+    }
+    return true;
+}
+
+bool write_blob(Preferences& p, const SettingsRecord& rec) {
+    SettingsBlob blob = {};
+    blob.header.magic = SETTINGS_BLOB_MAGIC;
+    blob.header.version = SETTINGS_SCHEMA_VERSION;
+    blob.header.length = sizeof(SettingsRecord);
+    blob.record = rec;
+    blob.header.crc = record_crc(blob.record, sizeof(SettingsRecord));
+    return p.putBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob)) == sizeof(blob);
+}
+
+// Reads and validates the blob into rec. A blob that exists but cannot be
+// used (bad magic, length or CRC, unknown or newer version) is Unreadable,
+// not Missing: it may hold settings from a newer firmware.
+SettingsLoadResult read_blob(Preferences& p, SettingsRecord& rec, uint16_t* version) {
+    const size_t stored = p.getBytesLength(SETTINGS_BLOB_KEY);
+    if (stored == 0) return SettingsLoadResult::Migrated;
+    // getBytes() refuses a blob larger than the buffer, so check first.
+    if (stored > sizeof(SettingsBlob)) return SettingsLoadResult::Unreadable;
+
+    SettingsBlob blob = {};
+    const size_t n = p.getBytes(SETTINGS_BLOB_KEY, &blob, sizeof(blob));
+    if (n < sizeof(SettingsBlobHeader) || blob.header.magic != SETTINGS_BLOB_MAGIC ||
+        blob.header.length > sizeof(SettingsRecord) ||
+        n != sizeof(SettingsBlobHeader) + blob.header.length) {
+        return SettingsLoadResult::Unreadable;
+    }
+    rec = {};
+    memcpy(&rec, &blob.record, blob.header.length);
+    if (record_crc(rec, blob.header.length) != blob.header.crc) return SettingsLoadResult::Unreadable;
+    if (!migrate_blob(blob.header.version, rec)) return SettingsLoadResult::Unreadable;
+    *version = blob.header.version;
+    return SettingsLoadResult::Loaded;
+}
+
+// One getBytes on the normal path. The legacy keys are migrated only when
+// there is no blob at all; an unreadable blob is left in NVS untouched and
+// the RAM record starts at defaults.
+void load_record() {
+    SettingsRecord rec = {};
+    uint16_t version = SETTINGS_SCHEMA_VERSION;
+    SettingsLoadResult result;
+    {
+        ScopedPrefs prefs(true);
+        result = read_blob(prefs.prefs, rec, &version);
+    }
+
+    if (result == SettingsLoadResult::Migrated) {
+        rec = {};
+        ScopedPrefs prefs(false);
+        migrate_legacy_keys(prefs.prefs, rec);
+        if (rec.groups != 0) {
+            DPRINT("[Settings] Migrated legacy keys (groups %08lX).\n", (unsigned long)rec.groups);
+        }
+        // Keep the old keys until the blob that replaces them is written.
+        if (write_blob(prefs.prefs, rec)) {
+            remove_legacy_keys(prefs.prefs);
+        } else {
+            DPRINTLN("[Settings] Blob write failed -- legacy keys kept.");
+        }
+    } else if (result == SettingsLoadResult::Unreadable) {
+        rec = {};
+        DPRINTLN("[Settings] Blob unreadable (CRC, length or version) -- kept, using defaults.");
+    } else if (version != SETTINGS_SCHEMA_VERSION) {
+        ScopedPrefs prefs(false);
+        if (!write_blob(prefs.prefs, rec)) DPRINTLN("[Settings] Blob upgrade write failed.");
+    }
+
+    portENTER_CRITICAL(&g_record_mux);
+    g_record = rec;
+    g_load_result = result;
+    g_loaded = true;
+    portEXIT_CRITICAL(&g_record_mux);
+}
+
+void ensure_loaded() {
+    if (!g_loaded) load_record();
+}
+
+// Copy of the RAM record for the load_* functions.
+SettingsRecord snapshot() {
+    ensure_loaded();
+    portENTER_CRITICAL(&g_record_mux);
+    SettingsRecord rec = g_record;
+    portEXIT_CRITICAL(&g_record_mux);
+    return rec;
+}
+
+// Run fn on the RAM record and schedule a flush.
+template <typename Fn>
+void update(Fn fn) {
+    ensure_loaded();
+    portENTER_CRITICAL(&g_record_mux);
+    fn(g_record);
+    const uint32_t now = millis();
+    if (!g_dirty) g_first_dirty_ms = now;
+    g_last_dirty_ms = now;
+    g_dirty = true;
+    g_edit_seq++;
+    portEXIT_CRITICAL(&g_record_mux);
+}
+
 } // namespace
 
+void settings_store_begin() {
+    ensure_loaded();
+}
+
+SettingsLoadResult settings_store_load_result() {
+    ensure_loaded();
+    return g_load_result;
+}
+
+// g_dirty stays set until the blob is on flash. An edit made while the write
+// was in progress bumps g_edit_seq and keeps it set for the next flush.
+void settings_store_flush() {
+    portENTER_CRITICAL(&g_record_mux);
+    const bool dirty = g_dirty;
+    const uint32_t seq = g_edit_seq;
+    SettingsRecord rec = g_record;
+    portEXIT_CRITICAL(&g_record_mux);
+    if (!dirty) return;
+
+    bool written;
+    {
+        ScopedPrefs prefs(false);
+        written = write_blob(prefs.prefs, rec);
+    }
+
+    portENTER_CRITICAL(&g_record_mux);
+    if (written) {
+        if (g_edit_seq == seq) g_dirty = false;
+    } else {
+        // Retry after another debounce instead of on every loop pass.
+        g_last_dirty_ms = millis();
+    }
+    portEXIT_CRITICAL(&g_record_mux);
+    if (!written) DPRINTLN("[Settings] Blob write failed -- will retry.");
+}
+
+void settings_store_service(uint32_t now_ms) {
+    portENTER_CRITICAL(&g_record_mux);
+    const bool due = g_dirty &&
+        ((uint32_t)(now_ms - g_last_dirty_ms) >= FLUSH_DEBOUNCE_MS ||
+         (uint32_t)(now_ms - g_first_dirty_ms) >= FLUSH_MAX_DELAY_MS);
+    portEXIT_CRITICAL(&g_record_mux);
+    if (due) settings_store_flush();
+}
+
 SoilCalibrationData load_soil_calibration_store(int default_dry, int default_wet) {
-    ScopedPrefs prefs(true);
-    return {
-        prefs.prefs.getInt("soil_dry", default_dry),
-        prefs.prefs.getInt("soil_wet", default_wet),
-    };
+    const SettingsRecord r = snapshot();
+    if (!(r.groups & GROUP_SOIL_CAL)) return { default_dry, default_wet };
+    return { r.soil_dry, r.soil_wet };
 }
 
 void save_soil_calibration_store(int dry_raw, int wet_raw) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("soil_dry", dry_raw);
-    prefs.prefs.putInt("soil_wet", wet_raw);
+    update([&](SettingsRecord& r) {
+        r.soil_dry = dry_raw;
+        r.soil_wet = wet_raw;
+        r.groups |= GROUP_SOIL_CAL;
+    });
 }
 
 SoilThresholdSettings load_soil_threshold_settings(int default_dry, int default_optimal, int default_moist, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool thr = r.groups & GROUP_SOIL_THR;
     return {
-        prefs.prefs.getInt("soil_thr_dry", default_dry),
-        prefs.prefs.getInt("soil_thr_opt", default_optimal),
-        prefs.prefs.getInt("soil_thr_moi", default_moist),
-        prefs.prefs.getBool("soil_aen", default_alerts_enabled),
+        thr ? r.soil_thr_dry : default_dry,
+        thr ? r.soil_thr_opt : default_optimal,
+        thr ? r.soil_thr_moi : default_moist,
+        (r.groups & GROUP_SOIL_AEN) ? (r.soil_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_soil_threshold_settings(int dry_pct, int optimal_pct, int moist_pct) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("soil_thr_dry", dry_pct);
-    prefs.prefs.putInt("soil_thr_opt", optimal_pct);
-    prefs.prefs.putInt("soil_thr_moi", moist_pct);
+    update([&](SettingsRecord& r) {
+        r.soil_thr_dry = dry_pct;
+        r.soil_thr_opt = optimal_pct;
+        r.soil_thr_moi = moist_pct;
+        r.groups |= GROUP_SOIL_THR;
+    });
 }
 
 void save_soil_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("soil_aen", enabled);
+    update([&](SettingsRecord& r) {
+        r.soil_aen = enabled;
+        r.groups |= GROUP_SOIL_AEN;
+    });
 }
 
 HumiditySettings load_humidity_settings_store(int default_dry, int default_comfort, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool thr = r.groups & GROUP_HUM_THR;
     return {
-        prefs.prefs.getInt("hum_dry_max", default_dry),
-        prefs.prefs.getInt("hum_comf_max", default_comfort),
-        prefs.prefs.getBool("hum_alert_en", default_alerts_enabled),
+        thr ? r.hum_dry_max : default_dry,
+        thr ? r.hum_comf_max : default_comfort,
+        (r.groups & GROUP_HUM_AEN) ? (r.hum_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_humidity_thresholds_store(int dry_max, int comfort_max) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("hum_dry_max", dry_max);
-    prefs.prefs.putInt("hum_comf_max", comfort_max);
+    update([&](SettingsRecord& r) {
+        r.hum_dry_max = dry_max;
+        r.hum_comf_max = comfort_max;
+        r.groups |= GROUP_HUM_THR;
+    });
 }
 
 void save_humidity_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("hum_alert_en", enabled);
+    update([&](SettingsRecord& r) {
+        r.hum_aen = enabled;
+        r.groups |= GROUP_HUM_AEN;
+    });
 }
 
 Ds18Settings load_ds18_settings_store(int default_offset_x10, int default_alarm_low, int default_alarm_high, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool set = r.groups & GROUP_DS18;
     return {
-        prefs.prefs.getInt("d18_off", default_offset_x10),
-        prefs.prefs.getInt("d18_alow", default_alarm_low),
-        prefs.prefs.getInt("d18_ahigh", default_alarm_high),
-        prefs.prefs.getBool("d18_aen", default_alerts_enabled),
+        set ? r.d18_off : default_offset_x10,
+        set ? r.d18_alow : default_alarm_low,
+        set ? r.d18_ahigh : default_alarm_high,
+        (r.groups & GROUP_DS18_AEN) ? (r.d18_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_ds18_settings_store(int offset_x10, int alarm_low, int alarm_high) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("d18_off", offset_x10);
-    prefs.prefs.putInt("d18_alow", alarm_low);
-    prefs.prefs.putInt("d18_ahigh", alarm_high);
+    update([&](SettingsRecord& r) {
+        r.d18_off = offset_x10;
+        r.d18_alow = alarm_low;
+        r.d18_ahigh = alarm_high;
+        r.groups |= GROUP_DS18;
+    });
 }
 
 void save_ds18_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("d18_aen", enabled);
+    update([&](SettingsRecord& r) {
+        r.d18_aen = enabled;
+        r.groups |= GROUP_DS18_AEN;
+    });
 }
 
 SoundSettings load_sound_settings_store(int default_quiet_max, int default_normal_max, int default_loud_max, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool set = r.groups & GROUP_SOUND;
     return {
-        prefs.prefs.getInt("snd_quiet", default_quiet_max),
-        prefs.prefs.getInt("snd_norm", default_normal_max),
-        prefs.prefs.getInt("snd_loud", default_loud_max),
-        prefs.prefs.getBool("snd_aen", default_alerts_enabled),
+        set ? r.snd_quiet : default_quiet_max,
+        set ? r.snd_norm : default_normal_max,
+        set ? r.snd_loud : default_loud_max,
+        (r.groups & GROUP_SOUND_AEN) ? (r.snd_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_sound_settings_store(int quiet_max, int normal_max, int loud_max) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("snd_quiet", quiet_max);
-    prefs.prefs.putInt("snd_norm", normal_max);
-    prefs.prefs.putInt("snd_loud", loud_max);
+    update([&](SettingsRecord& r) {
+        r.snd_quiet = quiet_max;
+        r.snd_norm = normal_max;
+        r.snd_loud = loud_max;
+        r.groups |= GROUP_SOUND;
+    });
 }
 
 void save_sound_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("snd_aen", enabled);
+    update([&](SettingsRecord& r) {
+        r.snd_aen = enabled;
+        r.groups |= GROUP_SOUND_AEN;
+    });
 }
 
 TempSettings load_temp_settings_store(int default_low_alarm, int default_high_alarm, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool set = r.groups & GROUP_TEMP;
     return {
-        prefs.prefs.getInt("tmp_low", default_low_alarm),
-        prefs.prefs.getInt("tmp_high", default_high_alarm),
-        prefs.prefs.getBool("tmp_aen", default_alerts_enabled),
+        set ? r.tmp_low : default_low_alarm,
+        set ? r.tmp_high : default_high_alarm,
+        (r.groups & GROUP_TEMP_AEN) ? (r.tmp_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_temp_settings_store(int low_alarm, int high_alarm) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("tmp_low", low_alarm);
-    prefs.prefs.putInt("tmp_high", high_alarm);
+    update([&](SettingsRecord& r) {
+        r.tmp_low = low_alarm;
+        r.tmp_high = high_alarm;
+        r.groups |= GROUP_TEMP;
+    });
 }
 
 void save_temp_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("tmp_aen", enabled);
+    update([&](SettingsRecord& r) {
+        r.tmp_aen = enabled;
+        r.groups |= GROUP_TEMP_AEN;
+    });
 }
 
 LightSettings load_light_settings_store(int default_dim_max, int default_indoor_max, int default_bright_max, uint8_t default_display_mode, bool default_alerts_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
+    const bool thr = r.groups & GROUP_LIGHT_THR;
     return {
-        prefs.prefs.getInt("lgt_dim", default_dim_max),
-        prefs.prefs.getInt("lgt_ind", default_indoor_max),
-        prefs.prefs.getInt("lgt_bri", default_bright_max),
-        prefs.prefs.getUChar("lgt_mode", default_display_mode),
-        prefs.prefs.getBool("lgt_aen", default_alerts_enabled),
+        thr ? r.lgt_dim : default_dim_max,
+        thr ? r.lgt_ind : default_indoor_max,
+        thr ? r.lgt_bri : default_bright_max,
+        (r.groups & GROUP_LIGHT_MODE) ? r.lgt_mode : default_display_mode,
+        (r.groups & GROUP_LIGHT_AEN) ? (r.lgt_aen != 0) : default_alerts_enabled,
     };
 }
 
 void save_light_thresholds_store(int dim_max, int indoor_max, int bright_max) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putInt("lgt_dim", dim_max);
-    prefs.prefs.putInt("lgt_ind", indoor_max);
-    prefs.prefs.putInt("lgt_bri", bright_max);
+    update([&](SettingsRecord& r) {
+        r.lgt_dim = dim_max;
+        r.lgt_ind = indoor_max;
+        r.lgt_bri = bright_max;
+        r.groups |= GROUP_LIGHT_THR;
+    });
 }
 
 void save_light_display_mode_store(uint8_t mode) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putUChar("lgt_mode", mode);
+    update([&](SettingsRecord& r) {
+        r.lgt_mode = mode;
+        r.groups |= GROUP_LIGHT_MODE;
+    });
 }
 
 void save_light_alerts_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("lgt_aen", enabled);
+    update([&](SettingsRecord& r) {
+        r.lgt_aen = enabled;
+        r.groups |= GROUP_LIGHT_AEN;
+    });
 }
 
 SystemSettings load_system_settings_store(uint32_t default_sleep_timeout_ms, bool default_sound_enabled) {
-    ScopedPrefs prefs(true);
+    const SettingsRecord r = snapshot();
     return {
-        prefs.prefs.getUInt("sys_sleep", default_sleep_timeout_ms),
-        prefs.prefs.getBool("sys_sound", default_sound_enabled),
+        (r.groups & GROUP_SYS_SLEEP) ? r.sys_sleep : default_sleep_timeout_ms,
+        (r.groups & GROUP_SYS_SOUND) ? (r.sys_sound != 0) : default_sound_enabled,
     };
 }
 
 void save_system_sound_enabled_store(bool enabled) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putBool("sys_sound", enabled);
+    update([&](SettingsRecord& r) {
+        r.sys_sound = enabled;
+        r.groups |= GROUP_SYS_SOUND;
+    });
 }
 
 void save_system_sleep_timeout_store(uint32_t timeout_ms) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putUInt("sys_sleep", timeout_ms);
+    update([&](SettingsRecord& r) {
+        r.sys_sleep = timeout_ms;
+        r.groups |= GROUP_SYS_SLEEP;
+    });
 }
 
 void clear_all_settings_store() {
+    portENTER_CRITICAL(&g_record_mux);
+    g_record = {};
+    g_loaded = true;
+    g_dirty = false;
+    g_load_result = SettingsLoadResult::Loaded;
+    portEXIT_CRITICAL(&g_record_mux);
+
     ScopedPrefs prefs(false);
     prefs.prefs.clear();
+    write_blob(prefs.prefs, SettingsRecord{});
 }
 
-// Sensor zone — keys: "sz_sen", "sz_v0".."sz_v5"
+// Sensor zone navigation, part of the settings blob.
 uint8_t load_sz_sensor_store() {
-    ScopedPrefs prefs(true);
-    return prefs.prefs.getUChar("sz_sen", 0);
+    return snapshot().sz_sen;
 }
 
 void save_sz_sensor_store(uint8_t sensor_id) {
-    ScopedPrefs prefs(false);
-    prefs.prefs.putUChar("sz_sen", sensor_id);
+    update([&](SettingsRecord& r) { r.sz_sen = sensor_id; });
 }
 
 uint8_t load_sz_viz_store(uint8_t sensor_id) {
-    char key[6];
-    snprintf(key, sizeof(key), "sz_v%u", (unsigned)sensor_id);
-    ScopedPrefs prefs(true);
-    return prefs.prefs.getUChar(key, 0);
+    if (sensor_id >= SZ_SENSOR_SLOTS) return 0;
+    return snapshot().sz_viz[sensor_id];
 }
 
 void save_sz_viz_store(uint8_t sensor_id, uint8_t viz_mode) {
-    char key[6];
-    snprintf(key, sizeof(key), "sz_v%u", (unsigned)sensor_id);
-    ScopedPrefs prefs(false);
-    prefs.prefs.putUChar(key, viz_mode);
+    if (sensor_id >= SZ_SENSOR_SLOTS) return;
+    update([&](SettingsRecord& r) { r.sz_viz[sensor_id] = viz_mode; });
 }
 
+// Device-state keys below are written through: they are rare and must land
+// before the esp_restart() that usually follows.
 bool load_ble_enabled_store() {
     ScopedPrefs prefs(true);
     return prefs.prefs.getBool("ble_en", false);
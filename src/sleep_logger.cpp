@@ -0,0 +1,237 @@
+// sleep_logger.cpp
+// Deep-sleep logging mode: RTC timer wakes, one reading, back to sleep.
+
+#include "sleep_logger.h"
+
+#if PBIT_ENABLE_LOG_SLEEP
+
+#include <esp_sleep.h>
+#include <driver/rtc_io.h>
+#include <sys/time.h>
+#include <math.h>
+#include <Preferences.h>
+#include "io.h"
+#include "hw.h"
+#include "rotary.h"
+#include "ulp_monitor.h"
+
+namespace {
+
+constexpr int16_t LOG_NO_READING_X10 = INT16_MIN;
+constexpr uint8_t LOG_NO_READING_PCT = 0xFF;
+
+// RTC slow memory keeps these across deep sleep; a power cycle clears them.
+RTC_DATA_ATTR SleepLogSample g_rtc_log[SLEEP_LOG_CAPACITY];
+RTC_DATA_ATTR uint16_t g_rtc_log_head = 0;
+RTC_DATA_ATTR uint16_t g_rtc_log_count = 0;
+RTC_DATA_ATTR bool g_rtc_log_sleep_active = false;
+
+// Flash archive: NVS blocks "b0".."bN-1" of up to SLEEP_LOG_CAPACITY samples
+// each. "nw" is the newest block; archives append to it until it is full and
+// then move on to the next one, which is the oldest and gets overwritten.
+constexpr char LOG_PREFS_NAMESPACE[] = "slog";
+constexpr char LOG_NEWEST_KEY[] = "nw";
+
+uint32_t rtc_seconds() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);   // backed by the RTC timer, keeps running in deep sleep
+    return (uint32_t)tv.tv_sec;
+}
+
+int16_t to_x10(float v) {
+    return isnan(v) ? LOG_NO_READING_X10 : (int16_t)lroundf(v * 10.0f);
+}
+
+void block_key(uint8_t block, char* key, size_t cap) {
+    snprintf(key, cap, "b%u", (unsigned)block);
+}
+
+uint8_t newest_block(Preferences& prefs) {
+    return prefs.getUChar(LOG_NEWEST_KEY, SLEEP_LOG_ARCHIVE_BLOCKS - 1) % SLEEP_LOG_ARCHIVE_BLOCKS;
+}
+
+// Samples stored in a block; 0 for a missing or malformed one.
+size_t block_count(Preferences& prefs, const char* key) {
+    const size_t bytes = prefs.getBytesLength(key);
+    if (bytes % sizeof(SleepLogSample) != 0 || bytes > SLEEP_LOG_CAPACITY * sizeof(SleepLogSample)) return 0;
+    return bytes / sizeof(SleepLogSample);
+}
+
+// Append the ring, oldest first, to the archive and empty it. A short
+// session (encoder wake before the ring filled) tops up the newest block
+// instead of taking a block of its own. Samples not written stay in the ring.
+bool archive_ring() {
+    const size_t n = g_rtc_log_count;
+    if (n == 0) return true;
+    const size_t start = (g_rtc_log_head + SLEEP_LOG_CAPACITY - n) % SLEEP_LOG_CAPACITY;
+
+    Preferences prefs;
+    if (!prefs.begin(LOG_PREFS_NAMESPACE, false)) return false;
+    uint8_t block = newest_block(prefs);
+    char key[4];
+    block_key(block, key, sizeof(key));
+    SleepLogSample buf[SLEEP_LOG_CAPACITY];
+    size_t used = block_count(prefs, key);
+    if (used > 0 && prefs.getBytes(key, buf, used * sizeof(SleepLogSample)) != used * sizeof(SleepLogSample)) {
+        used = 0;
+    }
+
+    size_t done = 0;
+    bool ok = true;
+    while (ok && done < n) {
+        if (used == SLEEP_LOG_CAPACITY) {
+            block = (uint8_t)((block + 1) % SLEEP_LOG_ARCHIVE_BLOCKS);
+            block_key(block, key, sizeof(key));
+            used = 0;
+        }
+        size_t take = SLEEP_LOG_CAPACITY - used;
+        if (take > n - done) take = n - done;
+        for (size_t i = 0; i < take; ++i) buf[used + i] = g_rtc_log[(start + done + i) % SLEEP_LOG_CAPACITY];
+        const size_t bytes = (used + take) * sizeof(SleepLogSample);
+        ok = prefs.putBytes(key, buf, bytes) == bytes && prefs.putUChar(LOG_NEWEST_KEY, block) == 1;
+        if (ok) {
+            used += take;
+            done += take;
+        }
+    }
+    prefs.end();
+
+    // Drop what reached flash; the ring keeps its head, so the rest stays newest.
+    g_rtc_log_count = (uint16_t)(n - done);
+    if (g_rtc_log_count == 0) g_rtc_log_head = 0;
+    if (!ok) {
+        DPRINTLN("[LogSleep] Archive write failed -- ring keeps overwriting.");
+        return false;
+    }
+    DPRINT("[LogSleep] %u samples archived, block %u holds %u\n", (unsigned)n, (unsigned)block, (unsigned)used);
+    return true;
+}
+
+void push_sample(const SleepLogSample& s) {
+    g_rtc_log[g_rtc_log_head] = s;
+    g_rtc_log_head = (g_rtc_log_head + 1) % SLEEP_LOG_CAPACITY;
+    if (g_rtc_log_count < SLEEP_LOG_CAPACITY) ++g_rtc_log_count;   // archive failed: overwrite the oldest
+    // A full ring goes to flash on the wake that fills it.
+    if (g_rtc_log_count == SLEEP_LOG_CAPACITY) archive_ring();
+}
+
+void append_sample(const Reading& r) {
+    SleepLogSample s;
+    s.t_s = rtc_seconds();
+    s.temp_x10 = to_x10(r.temperature);
+    s.hum_x10 = to_x10(r.humidity);
+    s.ds18_x10 = (r.temp_ds18b20 < -100.0f) ? LOG_NO_READING_X10 : to_x10(r.temp_ds18b20);
+    s.ldr = isnan(r.ldr) ? 0 : (uint16_t)constrain(lroundf(r.ldr), 0L, 65535L);
+    s.soil = isnan(r.soil_humidity) ? LOG_NO_READING_PCT : (uint8_t)constrain(lroundf(r.soil_humidity), 0L, 100L);
+    s.mic = isnan(r.mic) ? 0 : (uint8_t)constrain(lroundf(r.mic), 0L, 100L);
+    push_sample(s);
+}
+
+// Move the ULP buffer into the log as light/soil-only samples. The ULP keeps
+// no clock, so timestamps are spaced back from now by the sampling interval.
+// Calibration must be loaded (init_hw) for the lux/percent conversion.
+void append_ulp_samples() {
+    UlpMonitorSample raw[ULP_MONITOR_CAPACITY];
+    const size_t n = ulp_monitor_take_samples(raw, ULP_MONITOR_CAPACITY);
+    const uint32_t now_s = rtc_seconds();
+    const uint32_t step_s = ULP_MONITOR_INTERVAL_MS / 1000;
+    for (size_t i = 0; i < n; ++i) {
+        SleepLogSample s;
+        s.t_s = now_s - (uint32_t)(n - 1 - i) * step_s;
+        s.temp_x10 = LOG_NO_READING_X10;
+        s.hum_x10 = LOG_NO_READING_X10;
+        s.ds18_x10 = LOG_NO_READING_X10;
+        s.ldr = (uint16_t)lroundf(ldr_raw_to_lux((float)raw[i].ldr_raw));
+        const float soil = soil_raw_to_percent(raw[i].soil_raw);
+        s.soil = isnan(soil) ? LOG_NO_READING_PCT : (uint8_t)soil;
+        s.mic = LOG_NO_READING_PCT;
+        push_sample(s);
+    }
+    if (n > 0) DPRINT("[LogSleep] %u ULP samples logged\n", (unsigned)n);
+}
+
+[[noreturn]] void arm_and_sleep() {
+    const gpio_num_t wake_pin = (gpio_num_t)DI_ENCODER_SW;
+    // With the ULP watching LDR/soil the CPU only wakes on its request;
+    // the RTC timer is the fallback if the program cannot be started.
+    if (ulp_monitor_start()) {
+        esp_sleep_enable_ulp_wakeup();
+    } else {
+        esp_sleep_enable_timer_wakeup((uint64_t)LOG_SLEEP_INTERVAL_S * 1000000ULL);
+    }
+    rtc_gpio_pullup_en(wake_pin);
+    rtc_gpio_pulldown_dis(wake_pin);
+    esp_sleep_enable_ext0_wakeup(wake_pin, 0);   // encoder button is active low
+    g_rtc_log_sleep_active = true;
+    esp_deep_sleep_start();
+    for (;;) {}
+}
+
+} // namespace
+
+bool sleep_logger_is_log_wake() {
+    const esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    return g_rtc_log_sleep_active && (cause == ESP_SLEEP_WAKEUP_TIMER || cause == ESP_SLEEP_WAKEUP_ULP);
+}
+
+void sleep_logger_run_log_wake() {
+    // Display, BLE, LEDs and tasks stay off: only the sensor front-end is
+    // brought up (init_hw also loads calibration and offsets).
+    init_hw();
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_ULP) {
+        ulp_monitor_stop();
+        DPRINT("[LogSleep] ULP wake, reason %u\n", (unsigned)ulp_monitor_wake_reason());
+        append_ulp_samples();
+    }
+    Reading r;
+    read_sensors_once(r);
+    append_sample(r);
+    DPRINT("[LogSleep] sample %u/%u\n", (unsigned)g_rtc_log_count, (unsigned)SLEEP_LOG_CAPACITY);
+    Serial.flush();
+    arm_and_sleep();
+}
+
+void sleep_logger_enter() {
+    DPRINTLN("[LogSleep] Entering logging deep sleep.");
+    Serial.flush();
+    arm_and_sleep();
+}
+
+size_t sleep_logger_archive() {
+    // Hand the button pin back to the digital GPIO matrix for the encoder driver.
+    rtc_gpio_deinit((gpio_num_t)DI_ENCODER_SW);
+    if (g_rtc_log_sleep_active) {
+        ulp_monitor_stop();
+        append_ulp_samples();
+    }
+    g_rtc_log_sleep_active = false;
+    const size_t n = g_rtc_log_count;
+    if (!archive_ring()) return 0;
+    return n;
+}
+
+size_t sleep_logger_read(SleepLogSample* out, size_t cap) {
+    size_t total = 0;
+    Preferences prefs;
+    if (prefs.begin(LOG_PREFS_NAMESPACE, true)) {
+        // The block after the newest one is the oldest.
+        const uint8_t newest = newest_block(prefs);
+        for (uint8_t i = 1; i <= SLEEP_LOG_ARCHIVE_BLOCKS; ++i) {
+            char key[4];
+            block_key((uint8_t)((newest + i) % SLEEP_LOG_ARCHIVE_BLOCKS), key, sizeof(key));
+            const size_t n = block_count(prefs, key);
+            if (n == 0) continue;
+            if (n > cap - total) break;
+            total += prefs.getBytes(key, out + total, n * sizeof(SleepLogSample)) / sizeof(SleepLogSample);
+        }
+        prefs.end();
+    }
+    // Samples still in RTC memory (only if the last archive write failed).
+    const size_t start = (g_rtc_log_head + SLEEP_LOG_CAPACITY - g_rtc_log_count) % SLEEP_LOG_CAPACITY;
+    for (size_t i = 0; i < g_rtc_log_count && total < cap; ++i) {
+        out[total++] = g_rtc_log[(start + i) % SLEEP_LOG_CAPACITY];
+    }
+    return total;
+}
+
+#endif // PBIT_ENABLE_LOG_SLEEP
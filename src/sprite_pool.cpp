@@ -0,0 +1,110 @@
+// sprite_pool.cpp
+// Static sprite arena and the leases that hand it out per screen.
+
+#include "sprite_pool.h"
+#include "config.h"
+#include <string.h>
+
+namespace {
+
+alignas(4) uint8_t g_arena[SPRITE_ARENA_BYTES];
+uint32_t g_top = 0;
+uint32_t g_generation = 1;     // bumped on every screen change; 0 is never used
+SpritePoolStats g_stats = { SPRITE_ARENA_BYTES, 0, 0, 0, 0, 0 };
+
+} // namespace
+
+void ArenaSprite::attach(uint16_t* buffer, int16_t w, int16_t h) {
+    detach();
+    setColorDepth(16);
+
+    // Same state createSprite() leaves behind, minus the calloc().
+    _iwidth = _dwidth = _bitwidth = w;
+    _iheight = _dheight = h;
+    cursor_x = 0;
+    cursor_y = 0;
+    _sx = 0;
+    _sy = 0;
+    _sw = w;
+    _sh = h;
+    _scolor = TFT_BLACK;
+    _img8 = (uint8_t*)buffer;
+    _img8_1 = _img8;
+    _img8_2 = _img8;
+    _img = buffer;
+    _img4 = _img8;
+    _created = true;
+    rotation = 0;
+    setViewport(0, 0, w, h);
+    setPivot(w / 2, h / 2);
+}
+
+void ArenaSprite::detach() {
+    if (!_created) return;
+    _created = false;
+    _img = nullptr;
+    _img8 = nullptr;
+    _img8_1 = nullptr;
+    _img8_2 = nullptr;
+    _img4 = nullptr;
+    _vpOoB = true;
+}
+
+TFT_eSprite* SpriteLease::acquire(int16_t w, int16_t h, bool* fresh) {
+    if (fresh) *fresh = false;
+    if (generation_ == g_generation && sprite_.width() == w && sprite_.height() == h) {
+        return &sprite_;
+    }
+    release();
+
+    const uint32_t bytes = (w > 0 && h > 0) ? (uint32_t)sprite_bytes(w, h) : UINT32_MAX;
+    if (bytes > SPRITE_ARENA_BYTES - g_top) {
+        g_stats.failures++;
+        DPRINT("[Sprite] %dx%d does not fit (%u of %u bytes in use)\n",
+               (int)w, (int)h, (unsigned)g_top, (unsigned)SPRITE_ARENA_BYTES);
+        return nullptr;
+    }
+
+    offset_ = g_top;
+    bytes_ = bytes;
+    generation_ = g_generation;
+    g_top += bytes;
+
+    uint16_t* buffer = (uint16_t*)(g_arena + offset_);
+    memset(buffer, 0, bytes);    // createSprite() hands out zeroed (black) memory too
+    sprite_.attach(buffer, w, h);
+
+    g_stats.used_bytes = g_top;
+    if (g_top > g_stats.peak_bytes) g_stats.peak_bytes = g_top;
+    g_stats.active_leases++;
+    g_stats.leases++;
+    if (fresh) *fresh = true;
+    return &sprite_;
+}
+
+void SpriteLease::release() {
+    if (generation_ == 0) return;
+    sprite_.detach();
+    if (generation_ == g_generation) {
+        if (offset_ + bytes_ == g_top) g_top = offset_;
+        g_stats.used_bytes = g_top;
+        g_stats.active_leases--;
+    }
+    generation_ = 0;
+}
+
+void sprite_pool_release_all() {
+    if (g_stats.active_leases > 0) {
+        DPRINT("[Sprite] screen used %u B in %u leases (peak %u of %u B, %lu failures)\n",
+               (unsigned)g_stats.used_bytes, (unsigned)g_stats.active_leases,
+               (unsigned)g_stats.peak_bytes, (unsigned)SPRITE_ARENA_BYTES, (unsigned long)g_stats.failures);
+    }
+    if (++g_generation == 0) g_generation = 1;
+    g_top = 0;
+    g_stats.used_bytes = 0;
+    g_stats.active_leases = 0;
+}
+
+SpritePoolStats sprite_pool_get_stats() {
+    return g_stats;
+}
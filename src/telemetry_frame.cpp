@@ -0,0 +1,198 @@
+// telemetry_frame.cpp
+// Reference encoder/decoder for the v3 BLE telemetry frame.
+
+#include "telemetry_frame.h"
+#include <string.h>
+
+namespace {
+
+struct Writer {
+    uint8_t* p;
+    uint8_t* end;
+    bool ok;
+
+    void byte(uint8_t b) {
+        if (p < end) *p++ = b;
+        else ok = false;
+    }
+
+    void varint(uint32_t v) {
+        while (v >= 0x80) {
+            byte((uint8_t)(v | 0x80));
+            v >>= 7;
+        }
+        byte((uint8_t)v);
+    }
+
+    void zigzag(int32_t v) {
+        varint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+    }
+};
+
+struct Reader {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok;
+
+    uint8_t byte() {
+        if (p < end) return *p++;
+        ok = false;
+        return 0;
+    }
+
+    uint32_t varint() {
+        uint32_t v = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7) {
+            const uint8_t b = byte();
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        ok = false;
+        return 0;
+    }
+
+    int32_t zigzag() {
+        const uint32_t v = varint();
+        return (int32_t)((v >> 1) ^ (~(v & 1) + 1));
+    }
+};
+
+// Deltas use wrapping arithmetic so TELEMETRY_INVALID round-trips.
+int32_t wrap_sub(int32_t a, int32_t b) { return (int32_t)((uint32_t)a - (uint32_t)b); }
+int32_t wrap_add(int32_t a, int32_t b) { return (int32_t)((uint32_t)a + (uint32_t)b); }
+
+struct ScalarField {
+    uint16_t bit;
+    int32_t TelemetrySample::*member;
+};
+
+const ScalarField kScalarFields[] = {
+    { TELEMETRY_FIELD_TEMP,    &TelemetrySample::temp_x10 },
+    { TELEMETRY_FIELD_HUM,     &TelemetrySample::hum_x10 },
+    { TELEMETRY_FIELD_LDR,     &TelemetrySample::ldr_lux },
+    { TELEMETRY_FIELD_MIC,     &TelemetrySample::mic },
+    { TELEMETRY_FIELD_SOIL,    &TelemetrySample::soil },
+};
+
+bool ds18_equal(const TelemetrySample& a, const TelemetrySample& b) {
+    if (a.ds18_count != b.ds18_count) return false;
+    for (uint8_t i = 0; i < a.ds18_count; ++i) {
+        if (a.ds18_x10[i] != b.ds18_x10[i]) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+void telemetry_encoder_reset(TelemetryEncoder& enc) {
+    memset(&enc, 0, sizeof(enc));
+}
+
+void telemetry_decoder_reset(TelemetryDecoder& dec) {
+    memset(&dec, 0, sizeof(dec));
+}
+
+size_t telemetry_encode(TelemetryEncoder& enc, const TelemetrySample& sample, bool force_key,
+                        uint8_t* out, size_t cap) {
+    const bool key = force_key || !enc.has_prev || enc.since_key >= TELEMETRY_KEYFRAME_INTERVAL;
+    const TelemetrySample& prev = enc.prev;
+    TelemetrySample s = sample;
+    if (s.ds18_count > TELEMETRY_MAX_DS18) s.ds18_count = TELEMETRY_MAX_DS18;
+
+    uint16_t bitmap = TELEMETRY_FIELD_TIMESTAMP;
+    for (const ScalarField& f : kScalarFields) {
+        if (key || s.*f.member != prev.*f.member) bitmap |= f.bit;
+    }
+    if (key || !ds18_equal(s, prev)) bitmap |= TELEMETRY_FIELD_DS18;
+    if (key || s.ldr_raw != prev.ldr_raw) bitmap |= TELEMETRY_FIELD_LDR_RAW;
+    if (key || s.alert_codes != prev.alert_codes) bitmap |= TELEMETRY_FIELD_ALERTS;
+
+    Writer w = { out, out + cap, true };
+    w.byte((uint8_t)((TELEMETRY_FRAME_VERSION << 4) | (key ? TELEMETRY_FLAG_KEY : 0)));
+    w.byte(enc.seq);
+    w.varint(bitmap);
+
+    for (const ScalarField& f : kScalarFields) {
+        if (bitmap & f.bit) w.zigzag(key ? s.*f.member : wrap_sub(s.*f.member, prev.*f.member));
+    }
+    if (bitmap & TELEMETRY_FIELD_DS18) {
+        const bool delta = !key && prev.ds18_count == s.ds18_count;
+        w.byte(s.ds18_count);
+        for (uint8_t i = 0; i < s.ds18_count; ++i) {
+            w.zigzag(delta ? wrap_sub(s.ds18_x10[i], prev.ds18_x10[i]) : s.ds18_x10[i]);
+        }
+    }
+    if (bitmap & TELEMETRY_FIELD_LDR_RAW) {
+        w.zigzag(key ? s.ldr_raw : wrap_sub(s.ldr_raw, prev.ldr_raw));
+    }
+    if (bitmap & TELEMETRY_FIELD_ALERTS) w.varint(s.alert_codes);
+    w.varint(key ? s.timestamp_ms : s.timestamp_ms - prev.timestamp_ms);
+
+    if (!w.ok) return 0;
+
+    enc.prev = s;
+    enc.has_prev = true;
+    enc.seq++;
+    enc.since_key = key ? 1 : (uint8_t)(enc.since_key + 1);
+    return (size_t)(w.p - out);
+}
+
+TelemetryDecodeResult telemetry_decode(TelemetryDecoder& dec, const uint8_t* data, size_t len,
+                                       TelemetrySample& out) {
+    TelemetryDecodeResult result = { TelemetryDecodeStatus::BadFrame, 0 };
+    Reader r = { data, data + len, true };
+
+    const uint8_t header = r.byte();
+    const uint8_t seq = r.byte();
+    const uint16_t bitmap = (uint16_t)r.varint();
+    if (!r.ok || (header >> 4) != TELEMETRY_FRAME_VERSION) return result;
+
+    const bool key = (header & TELEMETRY_FLAG_KEY) != 0;
+    result.lost = dec.synced ? (uint8_t)(seq - dec.next_seq) : 0;
+    if (!key && (!dec.synced || result.lost != 0)) {
+        dec.synced = false;
+        result.status = TelemetryDecodeStatus::NeedKeyFrame;
+        return result;
+    }
+
+    const TelemetrySample& prev = dec.prev;
+    TelemetrySample s = key ? TelemetrySample{} : prev;
+    if (key) {
+        // Absent fields in a key frame are unknown, not unchanged.
+        for (const ScalarField& f : kScalarFields) s.*f.member = TELEMETRY_INVALID;
+        s.ldr_raw = TELEMETRY_INVALID;
+    }
+
+    for (const ScalarField& f : kScalarFields) {
+        if (!(bitmap & f.bit)) continue;
+        const int32_t v = r.zigzag();
+        s.*f.member = key ? v : wrap_add(prev.*f.member, v);
+    }
+    if (bitmap & TELEMETRY_FIELD_DS18) {
+        const uint8_t count = r.byte();
+        if (count > TELEMETRY_MAX_DS18) return result;
+        const bool delta = !key && prev.ds18_count == count;
+        s.ds18_count = count;
+        for (uint8_t i = 0; i < count; ++i) {
+            const int32_t v = r.zigzag();
+            s.ds18_x10[i] = delta ? wrap_add(prev.ds18_x10[i], v) : v;
+        }
+    }
+    if (bitmap & TELEMETRY_FIELD_LDR_RAW) {
+        const int32_t v = r.zigzag();
+        s.ldr_raw = key ? v : wrap_add(prev.ldr_raw, v);
+    }
+    if (bitmap & TELEMETRY_FIELD_ALERTS) s.alert_codes = r.varint();
+    if (bitmap & TELEMETRY_FIELD_TIMESTAMP) {
+        const uint32_t v = r.varint();
+        s.timestamp_ms = key ? v : prev.timestamp_ms + v;
+    }
+    if (!r.ok || r.p != r.end) return result;
+
+    dec.prev = s;
+    dec.synced = true;
+    dec.next_seq = (uint8_t)(seq + 1);
+    out = s;
+    result.status = TelemetryDecodeStatus::Ok;
+    return result;
+}
@@ -12,37 +12,16 @@
 #include "languages.h"
 #include "runtime_events.h"
 #include "led_control.h"
+#include "perf_probe.h"
+#include "boot_profile.h"
+#include "power_manager.h"
+#include "input_events.h"
+#include "rotary.h"
+#include "screen_registry.h"
+#include "sprite_pool.h"
 #include <stdio.h>
 #include <string.h>
 
-// --- Screen modules ---
-#include "ui_boot.h"
-#include "ui_ble_toggle.h"
-#include "ui_temp.h"
-#include "ui_humidity.h"
-#include "ui_light.h"
-#include "ui_sound.h"
-#include "ui_soil.h"
-#include "ui_ds18.h"
-#include "ui_system.h"
-#include "ui_timer.h"
-#include "ui_graph.h"
-#if PBIT_ENABLE_GRAPH_LAB
-#include "sensor_zone.h"
-#include "ui_lab_dash.h"
-#include "ui_lab_focus.h"
-#include "ui_lab_dual.h"
-#include "ui_lab_icon_gallery.h"
-#include "ui_lab_sensor_cards.h"
-#include "ui_lab_sound_vu.h"
-#include "ui_lab_widget_showcase.h"
-#include "ui_lab_icon_sizes.h"
-#include "ui_lab_home_cards.h"
-#include "ui_lab_linear_dash.h"
-#include "ui_lab_icon_test.h"
-#endif
-// ----------------------------------------------------
-
 // --- Global TFT/UI state ---
 volatile Screen active_screen;
 Reading g_ui_readings_snapshot;
@@ -52,160 +31,71 @@ volatile Screen g_last_active_screen_before_sleep = TEMP_SCREEN;
 
 // --- External state ---
 extern volatile bool g_sensor_data_ready;
-extern bool userTimerRunning;
 extern volatile bool g_timer_just_reset;
 
 namespace {
 
-static void apply_global_alert_rgb(const GlobalAlertSummary& summary) {
-    // Keep the RGB LED off on the light screen so the LED does not skew the LDR.
-    if (active_screen == LIGHT_SCREEN) {
-        set_rgb(0, 0, 0);
-        return;
-    }
-
-    if (!summary.active) {
-        switch (active_screen) {
-            case TEMP_SCREEN:
-                set_rgb(255, 69, 0);
-                break;
-            case HUMIDITY_SCREEN:
-                set_rgb(0, 0, 255);
-                break;
-            case LIGHT_SCREEN:
-                set_rgb(0, 0, 0);
-                break;
-            case SOUND_SCREEN:
-                set_rgb(255, 0, 255);
-                break;
-            case SOIL_SCREEN: {
-                const float soil = g_ui_readings_snapshot.soil_humidity;
-                if (isnan(soil)) {
-                    set_rgb(120, 0, 0);
-                } else if (soil < (float)get_soil_threshold_dry()) {
-                    set_rgb(255, 0, 0);
-                } else if (soil < (float)get_soil_threshold_optimal()) {
-                    set_rgb(0, 255, 0);
-                } else {
-                    set_rgb(0, 0, 200);
-                }
-                break;
-            }
-            case DS18B20_SCREEN:
-                set_rgb(255, 255, 255);
-                break;
-            case SYSTEM_SCREEN:
-                set_rgb(0, 255, 0);
-                break;
-            case BLE_TOGGLE_SCREEN:
-                set_rgb(0, 80, 255);
-                break;
-            case GRAPH_SCREEN:
-                set_rgb(0, 80, 80); // Teal neutro para la pantalla de gráfica
-                break;
-#if PBIT_ENABLE_GRAPH_LAB
-            case LAB_HOME_CARDS_SCREEN:
-                set_rgb(0, 150, 210);
-                break;
-            case LAB_LINEAR_DASH_SCREEN:
-                set_rgb(0, 170, 100);
-                break;
-            case LAB_DASH_OVERVIEW_SCREEN:
-                set_rgb(90, 90, 140);
-                break;
-            case LAB_SENSOR_FOCUS_SCREEN:
-                set_rgb(0, 110, 130);
-                break;
-            case LAB_DUAL_TH_SCREEN:
-                set_rgb(0, 140, 180);
-                break;
-            case LAB_ICON_SET_A_SCREEN:
-                set_rgb(180, 80, 255);
-                break;
-            case LAB_ICON_SET_B_SCREEN:
-                set_rgb(80, 180, 255);
-                break;
-            case LAB_ICON_SET_C_SCREEN:
-                set_rgb(255, 120, 80);
-                break;
-            case LAB_GAUGE_TEMP_SCREEN:
-                set_rgb(255, 140, 0);
-                break;
-            case LAB_VALUE_MODERN_SCREEN:
-                set_rgb(255, 0, 180);
-                break;
-            case LAB_SENSOR_CARD_SCREEN:
-                set_rgb(255, 130, 0);
-                break;
-            case LAB_TEMP_CARD_SCREEN:
-                set_rgb(255, 110, 0);
-                break;
-            case LAB_DS18_CARD_SCREEN:
-                set_rgb(255, 255, 255);
-                break;
-            case LAB_WIDGET_MIX_SCREEN:
-                set_rgb(255, 140, 60);
-                break;
-            case LAB_SOUND_VU_STACK_SCREEN:
-                set_rgb(0, 220, 120);
-                break;
-            case LAB_SOUND_VU_WAVE_SCREEN:
-                set_rgb(0, 160, 255);
-                break;
-            case LAB_ICON_TEST_SCREEN:
-                set_rgb(255, 165, 0);
-                break;
-            case SENSOR_ZONE_SCREEN: {
-                uint8_t r, g, b;
-                sz_sensor_rgb(sz_get_sensor(), r, g, b);
-                set_rgb(r, g, b);
-                break;
-            }
-#endif
-            case TIMER_SCREEN:
-                if (userTimerRunning) {
-                    set_rgb(0, 255, 0);
-                } else if (userTimerElapsed > 0) {
-                    set_rgb(255, 200, 0);
-                } else {
-                    set_rgb(0, 0, 255);
-                }
-                break;
-            default:
-                break;
-        }
-        return;
-    }
+// Critical alerts blink their colour; everything else is steady.
+constexpr uint16_t ALERT_BLINK_PERIOD_MS = 600;
 
+static bool alert_rgb(const GlobalAlertSummary& summary, uint8_t& r, uint8_t& g, uint8_t& b) {
+    const uint8_t code = summary.primary_code;
+    r = g = b = 0;
     switch (summary.primary_sensor) {
         case AlertSensor::Temp:
         case AlertSensor::Ds18:
-            if (summary.primary_code == ALERT_CODE_LOW) set_rgb(0, 90, 255);
-            else set_rgb(255, 0, 0);
+            if (code == ALERT_CODE_LOW) { g = 90; b = 255; }
+            else r = 255;
             break;
 
         case AlertSensor::Humidity:
-            if (summary.primary_code == ALERT_CODE_LOW) set_rgb(255, 120, 0);
-            else set_rgb(255, 0, 0);
+            if (code == ALERT_CODE_LOW) { r = 255; g = 120; }
+            else r = 255;
             break;
 
         case AlertSensor::Light:
-            if (summary.primary_code == ALERT_CODE_LOW) set_rgb(0, 180, 255);
-            else set_rgb(255, 180, 0);
+            if (code == ALERT_CODE_LOW) { g = 180; b = 255; }
+            else { r = 255; g = 180; }
             break;
 
         case AlertSensor::Sound:
-            if (summary.primary_code == ALERT_CODE_CRITICAL) set_rgb(255, 0, 0);
-            else set_rgb(255, 140, 0);
+            if (code == ALERT_CODE_CRITICAL) r = 255;
+            else { r = 255; g = 140; }
             break;
 
         case AlertSensor::Soil:
-            if (summary.primary_code == ALERT_CODE_LOW) set_rgb(255, 0, 0);
-            else set_rgb(0, 0, 200);
+            if (code == ALERT_CODE_LOW) r = 255;
+            else b = 200;
             break;
 
         default:
-            break;
+            return false;
+    }
+    return true;
+}
+
+// Runs every UI pass; set_rgb() and led_effect_start() skip repeats.
+static void apply_global_alert_rgb(const GlobalAlertSummary& summary) {
+    // Keep the RGB LED off on the light screen so the LED does not skew the LDR.
+    if (screen_desc(active_screen).flags & SCREEN_LED_DARK) {
+        led_effect_stop(LedEffect::Blink);
+        set_rgb(0, 0, 0);
+        return;
+    }
+
+    if (!summary.active) {
+        led_effect_stop(LedEffect::Blink);
+        screen_apply_idle_rgb(active_screen);
+        return;
+    }
+
+    uint8_t r, g, b;
+    if (!alert_rgb(summary, r, g, b)) return;
+    set_rgb(r, g, b);
+    if (summary.primary_code == ALERT_CODE_CRITICAL) {
+        led_effect_start(LedEffect::Blink, r, g, b, ALERT_BLINK_PERIOD_MS);
+    } else {
+        led_effect_stop(LedEffect::Blink);
     }
 }
 
@@ -262,23 +152,24 @@ void init_tft_display() {
 
 void switch_screen(void *param) {
     DPRINTLN("[Display] UI router task started on core 1.");
+    perf_probe_register_task("SwitchScreen");
+    input_events_set_consumer(xTaskGetCurrentTaskHandle());
     
     bool screen_changed = true; 
     Screen last_drawn = BOOT_SCREEN; 
     
-    unsigned long last_timer_update_ms = 0;
-    unsigned long last_system_update_ms = 0;
-    unsigned long last_soil_cal_update_ms = 0;
+    unsigned long last_tick_ms = 0;
     UiOverlayState last_overlay_state = UI_OVERLAY_NONE;
     
     while (1) {
-        bool timer_needs_update = false;
-        bool system_needs_update = false;
-        bool soil_cal_needs_update = false;
+        // Input first, so a knob turn is drawn in the same pass.
+        rotary_process_input();
+
         UiOverlayState overlay_state = runtime_get_ui_overlay();
 
         if (overlay_state != UI_OVERLAY_NONE) {
             if (overlay_state != last_overlay_state) {
+                PowerBoostScope boost(POWER_LOCK_RENDER);
                 switch (overlay_state) {
                     case UI_OVERLAY_SLEEP_WARNING:
                         draw_sleep_warning_overlay();
@@ -294,7 +185,8 @@ void switch_screen(void *param) {
                 }
             }
             last_overlay_state = overlay_state;
-            vTaskDelay(pdMS_TO_TICKS(10));
+            input_events_wait(pdMS_TO_TICKS(
+                (g_power_mode == POWER_IDLE && !rotary_input_settling()) ? POWER_IDLE_UI_PERIOD_MS : 10));
             continue;
         }
 
@@ -306,24 +198,19 @@ void switch_screen(void *param) {
         bool force_redraw = runtime_take_ui_full_redraw();
         bool sensor_data_changed = runtime_take_sensor_data_ready();
 
-        const unsigned long timer_refresh_ms = timer_display_uses_centiseconds() ? 40UL : 100UL;
-        if (millis() - last_timer_update_ms >= timer_refresh_ms) {
-            timer_needs_update = true;
-            last_timer_update_ms = millis();
-        }
-
-        if (active_screen == SYSTEM_SCREEN && millis() - last_system_update_ms >= 100) {
-            system_needs_update = true;
-            last_system_update_ms = millis();
-        }
-
-        if (active_screen == SOIL_SCREEN && soilCalibrationIsActive() && millis() - last_soil_cal_update_ms >= 180) {
-            soil_cal_needs_update = true;
-            last_soil_cal_update_ms = millis();
+        // Periodic redraw for screens that animate between sensor updates
+        // (timer digits, system stats, soil calibration).
+        const ScreenDesc& desc = screen_desc(active_screen);
+        const unsigned long refresh_ms = desc.refresh_ms ? desc.refresh_ms() : 0;
+        bool tick = false;
+        if (refresh_ms > 0 && millis() - last_tick_ms >= refresh_ms) {
+            tick = true;
+            last_tick_ms = millis();
         }
 
         if (last_drawn != active_screen) {
             screen_changed = true;
+            sprite_pool_release_all();   // the new screen gets the whole sprite arena
             if (active_screen != BOOT_SCREEN) sensor_data_changed = true; 
         } else {
             screen_changed = false;
@@ -333,17 +220,14 @@ void switch_screen(void *param) {
             sensor_data_changed = true;
         }
 
-        if (g_timer_just_reset) timer_needs_update = true;
+        if (g_timer_just_reset && active_screen == TIMER_SCREEN) tick = true;
 
         // ------------------------------------------------------------------
         // Main drawing logic.
         // ------------------------------------------------------------------
         
-        if (screen_changed
-            || sensor_data_changed
-            || (active_screen == SOIL_SCREEN && soil_cal_needs_update)
-            || (active_screen == TIMER_SCREEN && (timer_needs_update || g_timer_just_reset))
-            || (active_screen == SYSTEM_SCREEN && system_needs_update)) {
+        if (screen_changed || sensor_data_changed || tick) {
+            PowerBoostScope boost(POWER_LOCK_RENDER);
             if (screen_changed) {
                 last_drawn = active_screen;
             }
@@ -355,157 +239,10 @@ void switch_screen(void *param) {
             }
             
             // --- ENRUTADOR DE UI ---
-            switch (active_screen) {
-                
-                case BOOT_SCREEN:
-                    // (Esta pantalla solo se ejecuta en el setup)
-                    break; 
-
-                case TEMP_SCREEN: 
-                    draw_temp_screen(screen_changed, sensor_data_changed); 
-                    break;
-                
-                case HUMIDITY_SCREEN: 
-                    draw_humidity_screen(screen_changed, sensor_data_changed); 
-                    break;
-
-                case LIGHT_SCREEN: 
-                    draw_light_screen(screen_changed, sensor_data_changed); 
-                    break;
-
-                case SOUND_SCREEN:
-                    draw_sound_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case SOIL_SCREEN:
-                    draw_soil_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case DS18B20_SCREEN:
-                    draw_ds18_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case SYSTEM_SCREEN: 
-                    draw_system_screen(screen_changed, sensor_data_changed);
-                    break;
-                
-                case TIMER_SCREEN:
-                    draw_timer_screen(screen_changed, sensor_data_changed, timer_needs_update);
-                    break;
-
-                case GRAPH_SCREEN:
-                    draw_graph_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case BLE_TOGGLE_SCREEN:
-                    draw_ble_toggle_screen(screen_changed, sensor_data_changed);
-                    break;
-
-#if PBIT_ENABLE_GRAPH_LAB
-                case LAB_DASH_OVERVIEW_SCREEN:
-                    draw_lab_dash_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_SENSOR_FOCUS_SCREEN:
-                    draw_lab_focus_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_DUAL_TH_SCREEN:
-                    draw_lab_dual_th_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_SET_A_SCREEN:
-                    draw_lab_icon_set_a_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_SET_B_SCREEN:
-                    draw_lab_icon_set_b_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_SET_C_SCREEN:
-                    draw_lab_icon_set_c_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_GAUGE_TEMP_SCREEN:
-                    draw_lab_gauge_temp_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_VALUE_MODERN_SCREEN:
-                    draw_lab_value_modern_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_SENSOR_CARD_SCREEN:
-                    draw_lab_sensor_card_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_TEMP_CARD_SCREEN:
-                    draw_lab_temp_card_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_DS18_CARD_SCREEN:
-                    draw_lab_ds18_card_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_WIDGET_MIX_SCREEN:
-                    draw_lab_widget_mix_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_SOUND_VU_STACK_SCREEN:
-                    draw_lab_sound_vu_stack_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_SOUND_VU_WAVE_SCREEN:
-                    draw_lab_sound_vu_wave_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_SIZES_ENV_SCREEN:
-                    draw_lab_icon_sizes_env_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_SIZES_EXT_SCREEN:
-                    draw_lab_icon_sizes_ext_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_HOME_CARDS_SCREEN:
-                    draw_lab_home_cards_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_LINEAR_DASH_SCREEN:
-                    draw_lab_linear_dash_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case LAB_ICON_TEST_SCREEN:
-                    draw_lab_icon_test_screen(screen_changed, sensor_data_changed);
-                    break;
-
-                case SENSOR_ZONE_SCREEN:
-                    sz_set_active(true);
-                    sz_sync_renderer(screen_changed);
-                    switch (sz_get_viz()) {
-                        case SZ_VIZ_CARD:
-                            draw_lab_sensor_card_screen(screen_changed, sensor_data_changed);
-                            break;
-                        case SZ_VIZ_VALOR:
-                            draw_lab_value_modern_screen(screen_changed, sensor_data_changed);
-                            break;
-                        case SZ_VIZ_FOCUS:
-                            draw_lab_focus_screen(screen_changed, sensor_data_changed);
-                            break;
-                        case SZ_VIZ_GRAPH:
-                            draw_graph_screen(screen_changed, sensor_data_changed);
-                            break;
-                        case SZ_VIZ_GAUGE:
-                            draw_lab_gauge_temp_screen(screen_changed, sensor_data_changed);
-                            break;
-                        default:
-                            break;
-                    }
-                    if (screen_changed) drawHeader(sz_header_name());
-                    sz_set_active(false);
-                    break;
-#endif
+            // BOOT_SCREEN has no draw entry: it is only shown during setup.
+            if (desc.draw) desc.draw(screen_changed, sensor_data_changed, tick);
 
-            } // fin del switch
+            if (active_screen != BOOT_SCREEN) boot_profile_mark_first_pixel();
             
             if (g_timer_just_reset) g_timer_just_reset = false;
 
@@ -517,6 +254,7 @@ void switch_screen(void *param) {
         static bool _hwm_reported = false;
         if (!_hwm_reported) { _hwm_reported = true; DPRINT("[Stack] DisplayTask HWM: %u words\n", uxTaskGetStackHighWaterMark(NULL)); }
 #endif
-        vTaskDelay(pdMS_TO_TICKS(5));
+        // Wakes early on any encoder/button interrupt.
+        input_events_wait(pdMS_TO_TICKS(5));
     }
 }
@@ -257,7 +257,8 @@ void serviceUserTimer() {
             { 2200, 180 }, { 0, 140 },
             { 1800, 180 }, { 0, 140 },
         };
-        play_tone_sequence(timer_alarm_steps, sizeof(timer_alarm_steps) / sizeof(timer_alarm_steps[0]));
+        play_tone_sequence(timer_alarm_steps, sizeof(timer_alarm_steps) / sizeof(timer_alarm_steps[0]),
+                           ToneSource::TimerAlarm);
     }
     DPRINTLN("[Timer] Countdown finished");
 }
@@ -81,6 +81,7 @@ void draw_ble_toggle_screen(bool screen_changed, bool data_changed) {
 
 uint8_t handle_ble_toggle_button() {
     save_ble_enabled_store(g_ble_selection == 1);
+    settings_store_flush();
     // Full-screen restart overlay before rebooting
     tft.fillScreen(BLE_BG);
     tft.setTextDatum(MC_DATUM);
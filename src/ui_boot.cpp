@@ -4,18 +4,14 @@
 #include "ui_boot.h"
 #include "ui_widgets.h" // Para tft
 #include "hw.h"         // Para dev_name
-#include "led_control.h"// Para set_rgb() y play_tone_blocking()
+#include "led_control.h"// Para set_rgb() y beep()
+#include "boot_profile.h"
+#include <esp_timer.h>
 
-// Include the two logo assets used by the startup animation.
-#include "img_logo_cuadrado.h" 
-#include "img_POWAR_logo_WEB.h"
-
-// External declarations for the logo image arrays.
-extern const uint16_t PBIT_TFT_160x128_2[]; 
-extern const uint16_t POWAR_logo_WEB[]; 
-
-// The local play_tone_blocking implementation was removed; the shared helper
-// now lives in led_control.cpp.
+// The two logo assets used by the startup animation, palette + RLE encoded
+// by tools/rle565_encode.py from the raw arrays in assets/.
+#include "img_logo_cuadrado_rle.h"
+#include "img_POWAR_logo_WEB_rle.h"
 
 namespace {
 struct BootStep {
@@ -84,41 +80,114 @@ static const BootProfile BOOT_PROFILES[] = {
     { BOOT_STEPS_RETRO_ARCADE, sizeof(BOOT_STEPS_RETRO_ARCADE) / sizeof(BOOT_STEPS_RETRO_ARCADE[0]), 2,  720 },
     { BOOT_STEPS_TECH_CLEAN,   sizeof(BOOT_STEPS_TECH_CLEAN) / sizeof(BOOT_STEPS_TECH_CLEAN[0]), 2,  700 },
 };
-} // namespace
 
-/**
- * @brief Dibuja la secuencia de arranque (animación, luces y sonido).
- * Esta función es intencionalmente bloqueante y se llama DESDE setup().
- */
-void run_boot_sequence() {
-    const BootProfile& profile = BOOT_PROFILES[(uint8_t)ACTIVE_BOOT_PROFILE];
+// Each step is a tone phase followed by a gap phase; the last gap leads to
+// the final hold. Deadlines are chained from the previous one, not from the
+// wake-up time, so scheduling jitter does not stretch the sequence.
+enum class BootAnimPhase : uint8_t {
+    Tone,
+    Gap,
+    Hold,
+    Done
+};
 
-    // --- SECUENCIA DE ARRANQUE "8-BIT" ---
+struct BootAnimState {
+    BootAnimPhase phase;
+    size_t step;
+    uint32_t deadline_ms;
+};
 
-    // 1. (0.0s) PANTALLA 1: Símbolo (PBIT_TFT_160x128_2)
-    int x_draw1 = (tft.width() - PBIT_TFT_160X128_2_WIDTH) / 2;
-    int y_draw1 = (tft.height() - PBIT_TFT_160X128_2_HEIGHT) / 2;
-    tft.pushImage(x_draw1, y_draw1, PBIT_TFT_160X128_2_WIDTH, PBIT_TFT_160X128_2_HEIGHT, (const uint16_t*)PBIT_TFT_160x128_2);
-
-    for (size_t i = 0; i < profile.step_count; ++i) {
-        if (i == profile.logo_switch_after_step) {
-            int x_draw2 = (tft.width() - POWAR_LOGO_WEB_WIDTH) / 2;
-            int y_draw2 = (tft.height() - POWAR_LOGO_WEB_HEIGHT) / 2;
-            tft.pushImage(x_draw2, y_draw2, POWAR_LOGO_WEB_WIDTH, POWAR_LOGO_WEB_HEIGHT, (const uint16_t*)POWAR_logo_WEB);
-        }
+BootAnimState g_anim = { BootAnimPhase::Done, 0, 0 };
+SemaphoreHandle_t g_anim_done = nullptr;
+
+void draw_centered(const Rle565Image& image) {
+    rle565_draw(tft, (tft.width() - image.width) / 2, (tft.height() - image.height) / 2, image);
+}
+
+void enter_step(const BootProfile& profile, size_t index) {
+    if (index == profile.logo_switch_after_step) draw_centered(POWAR_logo_WEB_RLE);
+
+    const BootStep& step = profile.steps[index];
+    set_rgb(step.r, step.g, step.b);
+    beep(step.freq_hz, step.tone_ms, ToneSource::System);
+    g_anim.phase = BootAnimPhase::Tone;
+    g_anim.step = index;
+    g_anim.deadline_ms += step.tone_ms;
+}
 
-        const BootStep& step = profile.steps[i];
-        set_rgb(step.r, step.g, step.b);
-        play_tone_blocking(step.freq_hz, step.tone_ms);
-        if (step.gap_ms > 0) {
-            vTaskDelay(pdMS_TO_TICKS(step.gap_ms));
+// Run every phase whose deadline has passed. Returns the ms to sleep until
+// the next one, or 0 once the sequence is over.
+uint32_t advance(uint32_t now_ms) {
+    const BootProfile& profile = BOOT_PROFILES[(uint8_t)ACTIVE_BOOT_PROFILE];
+
+    while (g_anim.phase != BootAnimPhase::Done && (int32_t)(now_ms - g_anim.deadline_ms) >= 0) {
+        switch (g_anim.phase) {
+            case BootAnimPhase::Tone:
+                g_anim.phase = BootAnimPhase::Gap;
+                g_anim.deadline_ms += profile.steps[g_anim.step].gap_ms;
+                break;
+            case BootAnimPhase::Gap:
+                if (g_anim.step + 1 < profile.step_count) {
+                    enter_step(profile, g_anim.step + 1);
+                } else {
+                    g_anim.phase = BootAnimPhase::Hold;
+                    g_anim.deadline_ms += profile.final_hold_ms;
+                }
+                break;
+            case BootAnimPhase::Hold:
+                set_rgb(0, 0, 0);
+                tft.fillScreen(TFT_BLACK); // Prepara la pantalla para la UI principal
+                g_anim.phase = BootAnimPhase::Done;
+                break;
+            default:
+                break;
         }
     }
+    if (g_anim.phase == BootAnimPhase::Done) return 0;
+    const uint32_t wait_ms = g_anim.deadline_ms - now_ms;
+    return wait_ms > 0 ? wait_ms : 1;
+}
+
+void run_animation() {
+    const int64_t start_us = esp_timer_get_time();
 
-    // Retención final según perfil.
-    vTaskDelay(pdMS_TO_TICKS(profile.final_hold_ms));
+    // 1. (0.0s) PANTALLA 1: Símbolo (PBIT_TFT_160x128_2)
+    draw_centered(PBIT_TFT_160x128_2_RLE);
+    g_anim.deadline_ms = millis();
+    enter_step(BOOT_PROFILES[(uint8_t)ACTIVE_BOOT_PROFILE], 0);
+
+    uint32_t wait_ms;
+    while ((wait_ms = advance(millis())) > 0) {
+        const TickType_t ticks = pdMS_TO_TICKS(wait_ms);
+        vTaskDelay(ticks > 0 ? ticks : 1);
+    }
+    boot_profile_record_async("animation", (uint32_t)(esp_timer_get_time() - start_us));
+}
+
+void boot_anim_task(void*) {
+    run_animation();
+    xSemaphoreGive(g_anim_done);
+    vTaskDelete(NULL);
+}
+} // namespace
+
+void boot_animation_start() {
+    g_anim_done = xSemaphoreCreateBinary();
+    // Above setup()'s priority on the same core, so the steps keep their
+    // timing while the init work fills the gaps.
+    BaseType_t ok = g_anim_done
+        ? xTaskCreatePinnedToCore(boot_anim_task, "BootAnim", 4096, NULL, 2, NULL, 1)
+        : pdFAIL;
+    if (ok != pdPASS) {
+        DPRINTLN("[Boot] Animation task failed, running inline.");
+        run_animation();
+        if (g_anim_done) xSemaphoreGive(g_anim_done);
+    }
+}
 
-    // Apagado final
-    set_rgb(0, 0, 0);
-    tft.fillScreen(TFT_BLACK); // Prepara la pantalla para la UI principal
+void boot_animation_wait() {
+    if (!g_anim_done) return;
+    xSemaphoreTake(g_anim_done, portMAX_DELAY);
+    vSemaphoreDelete(g_anim_done);
+    g_anim_done = nullptr;
 }
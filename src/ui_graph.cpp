@@ -3,14 +3,19 @@
 // Short press cycles through all six available sensors.
 
 #include "ui_graph.h"
+#include "config.h"
+#if PBIT_ENABLE_GRAPH_LAB
 #include "sensor_zone.h"
+#endif
 #include "palette.h"
+#include "sprite_pool.h"
 
 #include "fonts.h"
 #include "graph_buffer.h"
 #include "io.h"
 #include "languages.h"
 #include "layout.h"
+#include "perf_probe.h"
 #include "runtime_events.h"
 #include "tft_display.h"
 #include "ui_widgets.h"
@@ -36,15 +41,8 @@ enum GraphSensor : uint8_t {
 };
 
 static GraphSensor g_graph_sensor = GRAPH_TEMP;
-static TFT_eSprite g_sprite(&tft);
-static bool g_sprite_ready = false;
-
-static void ensure_sprite() {
-    if (g_sprite_ready) return;
-    g_sprite.setColorDepth(16);
-    g_sprite.createSprite(LG_GRAPH_W, LG_GRAPH_H);
-    g_sprite_ready = true;
-}
+static SpriteLease g_sprite_lease(&tft);
+static_assert(sprite_bytes(LG_GRAPH_W, LG_GRAPH_H) <= SPRITE_ARENA_BYTES, "graph sprite exceeds the sprite arena");
 
 static uint16_t graph_bg_color() {
     return tft.color565(4, 8, 18);
@@ -257,16 +255,18 @@ static void format_graph_corner_value(char* out, size_t out_size, GraphSensor se
 }
 
 static void render_graph(const float* data, size_t n, GraphSensor sensor) {
-    ensure_sprite();
-    g_sprite.fillSprite(graph_bg_color());
+    PERF_PROBE_SCOPE(PERF_RENDER_GRAPH);
+    TFT_eSprite* sprite = g_sprite_lease.acquire(LG_GRAPH_W, LG_GRAPH_H);
+    if (!sprite) return;
+    sprite->fillSprite(graph_bg_color());
 
     const int grid_step = 12;
     int row = 0;
     for (int gy = 0; gy < LG_GRAPH_H; gy += grid_step, ++row) {
-        g_sprite.drawFastHLine(0, gy, LG_GRAPH_W, graph_grid_h_color(sensor, row));
+        sprite->drawFastHLine(0, gy, LG_GRAPH_W, graph_grid_h_color(sensor, row));
     }
     for (int gx = 0; gx < LG_GRAPH_W; gx += grid_step) {
-        g_sprite.drawFastVLine(gx, 0, LG_GRAPH_H, graph_grid_v_color(sensor));
+        sprite->drawFastVLine(gx, 0, LG_GRAPH_H, graph_grid_v_color(sensor));
     }
 
     const size_t start_i = (n > (size_t)LG_GRAPH_W) ? (n - (size_t)LG_GRAPH_W) : 0;
@@ -306,26 +306,26 @@ static void render_graph(const float* data, size_t n, GraphSensor sensor) {
         const int xj = x_off + (int)(i - start_i);
         const int yi = val_to_py(data[i - 1]);
         const int yj = val_to_py(data[i]);
-        g_sprite.drawLine(xi, yi + 1, xj, yj + 1, shadow_col);
-        g_sprite.drawLine(xi, yi, xj, yj, line_col);
-        g_sprite.drawPixel(xj, yj, line_col);
+        sprite->drawLine(xi, yi + 1, xj, yj + 1, shadow_col);
+        sprite->drawLine(xi, yi, xj, yj, line_col);
+        sprite->drawPixel(xj, yj, line_col);
     }
 
     char buf[16];
-    g_sprite.setTextFont(1);
+    sprite->setTextFont(1);
 
     format_graph_corner_value(buf, sizeof(buf), sensor, vmax);
-    g_sprite.setTextDatum(TL_DATUM);
-    g_sprite.setTextColor(graph_max_label_color(sensor), TFT_BLACK);
-    g_sprite.drawString(buf, 2, 2);
+    sprite->setTextDatum(TL_DATUM);
+    sprite->setTextColor(graph_max_label_color(sensor), TFT_BLACK);
+    sprite->drawString(buf, 2, 2);
 
     format_graph_corner_value(buf, sizeof(buf), sensor, vmin);
-    g_sprite.setTextDatum(BL_DATUM);
-    g_sprite.setTextColor(graph_min_label_color(sensor), TFT_BLACK);
-    g_sprite.drawString(buf, 2, LG_GRAPH_H - 1);
+    sprite->setTextDatum(BL_DATUM);
+    sprite->setTextColor(graph_min_label_color(sensor), TFT_BLACK);
+    sprite->drawString(buf, 2, LG_GRAPH_H - 1);
 
-    g_sprite.setTextFont(0);
-    g_sprite.pushSprite(LG_GRAPH_X + 1, LG_GRAPH_Y + 1);
+    sprite->setTextFont(0);
+    sprite->pushSprite(LG_GRAPH_X + 1, LG_GRAPH_Y + 1);
 }
 
 static void draw_graph_band(bool valid,
@@ -375,7 +375,11 @@ void draw_graph_screen(bool screen_changed, bool sensor_data_changed) {
 
     if (need_full) {
         tft.fillScreen(TFT_BLACK);
+#if PBIT_ENABLE_GRAPH_LAB
         if (!sz_is_active()) drawHeader(L(TIT_GRAPH));
+#else
+        drawHeader(L(TIT_GRAPH));
+#endif
     }
 
     if (need_full) {
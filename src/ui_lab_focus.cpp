@@ -6,6 +6,7 @@
 #include "ui_lab_focus.h"
 #include "sensor_zone.h"
 #include "palette.h"
+#include "color565.h"
 
 #include "tft_display.h"
 #include "ui_widgets.h"
@@ -16,6 +17,7 @@
 #include "ui_icons.h"
 #include "io.h"
 #include "runtime_events.h"
+#include "sprite_pool.h"
 
 #include <TFT_eSPI.h>
 #include <climits>
@@ -52,27 +54,9 @@ static bool g_last_summary_valid = false;
 static int g_last_summary_key = INT_MIN;
 static bool g_last_summary_unit_mode = false;
 
-static TFT_eSprite g_graph_sprite(&tft);
-static bool g_graph_sprite_ready = false;
-
-static void ensure_graph_sprite() {
-    if (g_graph_sprite_ready) return;
-    g_graph_sprite.setColorDepth(16);
-    g_graph_sprite.createSprite(LF_GRAPH_INNER_W, LF_GRAPH_INNER_H);
-    g_graph_sprite_ready = true;
-}
-
-static uint16_t blend565(uint16_t a, uint16_t b) {
-    const uint8_t ar = (uint8_t)((a >> 11) & 0x1F);
-    const uint8_t ag = (uint8_t)((a >> 5) & 0x3F);
-    const uint8_t ab = (uint8_t)(a & 0x1F);
-    const uint8_t br = (uint8_t)((b >> 11) & 0x1F);
-    const uint8_t bg = (uint8_t)((b >> 5) & 0x3F);
-    const uint8_t bb = (uint8_t)(b & 0x1F);
-    return (uint16_t)(((uint8_t)((ar + br) / 2) << 11) |
-                      ((uint8_t)((ag + bg) / 2) << 5) |
-                      (uint8_t)((ab + bb) / 2));
-}
+static SpriteLease g_graph_sprite_lease(&tft);
+static_assert(sprite_bytes(LF_GRAPH_INNER_W, LF_GRAPH_INNER_H) <= SPRITE_ARENA_BYTES,
+              "focus graph sprite exceeds the sprite arena");
 
 // LabFocusSensor order: HUM=0 TEMP=1 LIGHT=2 SOUND=3 SOIL=4 DS18=5
 // SzSensorId order:     TEMP=0 HUM=1 LIGHT=2 SOUND=3 SOIL=4 DS18=5
@@ -387,8 +371,9 @@ static void draw_summary_panel(LabFocusSensor sensor, bool valid, bool shell_red
 }
 
 static void render_graph_sprite(LabFocusSensor sensor, const float* data, size_t n) {
-    ensure_graph_sprite();
-    g_graph_sprite.fillSprite(graph_bg_color(sensor));
+    TFT_eSprite* sprite = g_graph_sprite_lease.acquire(LF_GRAPH_INNER_W, LF_GRAPH_INNER_H);
+    if (!sprite) return;
+    sprite->fillSprite(graph_bg_color(sensor));
 
     const uint16_t grid_h_col = tft.color565(12, 18, 34);
     const uint16_t p2f = sensor_secondary_color(sensor);
@@ -398,19 +383,19 @@ static void render_graph_sprite(LabFocusSensor sensor, const float* data, size_t
          (uint16_t)( (p2f        & 0x1F) * 9 / 25)
     );
     for (int gy = 0; gy < LF_GRAPH_INNER_H; gy += 10) {
-        g_graph_sprite.drawFastHLine(0, gy, LF_GRAPH_INNER_W, grid_h_col);
+        sprite->drawFastHLine(0, gy, LF_GRAPH_INNER_W, grid_h_col);
     }
     for (int gx = 0; gx < LF_GRAPH_INNER_W; gx += 10) {
-        g_graph_sprite.drawFastVLine(gx, 0, LF_GRAPH_INNER_H, grid_v_col);
+        sprite->drawFastVLine(gx, 0, LF_GRAPH_INNER_H, grid_v_col);
     }
 
     if (n == 0) {
-        g_graph_sprite.setFreeFont(FONT_SMALL);
-        g_graph_sprite.setTextDatum(MC_DATUM);
-        g_graph_sprite.setTextColor(TFT_DARKGREY, TFT_BLACK);
-        g_graph_sprite.drawString(L(ST_WAITING), LF_GRAPH_INNER_W / 2, LF_GRAPH_INNER_H / 2);
-        g_graph_sprite.setTextFont(0);
-        g_graph_sprite.pushSprite(LF_GRAPH_X + LF_GRAPH_INSET, LF_GRAPH_Y + LF_GRAPH_INSET);
+        sprite->setFreeFont(FONT_SMALL);
+        sprite->setTextDatum(MC_DATUM);
+        sprite->setTextColor(TFT_DARKGREY, TFT_BLACK);
+        sprite->drawString(L(ST_WAITING), LF_GRAPH_INNER_W / 2, LF_GRAPH_INNER_H / 2);
+        sprite->setTextFont(0);
+        sprite->pushSprite(LF_GRAPH_X + LF_GRAPH_INSET, LF_GRAPH_Y + LF_GRAPH_INSET);
         return;
     }
 
@@ -448,21 +433,21 @@ static void render_graph_sprite(LabFocusSensor sensor, const float* data, size_t
 
     if (visible == 1) {
         const int y = value_to_y(data[n - 1]);
-        g_graph_sprite.drawPixel(x_off + 1, y + 1, shadow_col);
-        g_graph_sprite.drawPixel(x_off, y, line_col);
+        sprite->drawPixel(x_off + 1, y + 1, shadow_col);
+        sprite->drawPixel(x_off, y, line_col);
     } else {
         for (size_t i = start_i + 1; i < n; ++i) {
             const int xi = x_off + (int)(i - 1 - start_i);
             const int xj = x_off + (int)(i - start_i);
             const int yi = value_to_y(data[i - 1]);
             const int yj = value_to_y(data[i]);
-            g_graph_sprite.drawLine(xi, yi + 1, xj, yj + 1, shadow_col);
-            g_graph_sprite.drawLine(xi, yi, xj, yj, line_col);
-            g_graph_sprite.drawPixel(xj, yj, line_col);
+            sprite->drawLine(xi, yi + 1, xj, yj + 1, shadow_col);
+            sprite->drawLine(xi, yi, xj, yj, line_col);
+            sprite->drawPixel(xj, yj, line_col);
         }
     }
 
-    g_graph_sprite.pushSprite(LF_GRAPH_X + LF_GRAPH_INSET, LF_GRAPH_Y + LF_GRAPH_INSET);
+    sprite->pushSprite(LF_GRAPH_X + LF_GRAPH_INSET, LF_GRAPH_Y + LF_GRAPH_INSET);
 }
 
 static void draw_graph_panel(LabFocusSensor sensor, bool valid, bool shell_redraw) {
@@ -1,6 +1,7 @@
 #include "ui_lab_widget_showcase.h"
 #include "sensor_zone.h"
 #include "palette.h"
+#include "color565.h"
 
 #include "fonts.h"
 #include "graph_buffer.h"
@@ -8,6 +9,7 @@
 #include "languages.h"
 #include "layout.h"
 #include "runtime_events.h"
+#include "perf_probe.h"
 #include "tft_display.h"
 #include "ui_icons.h"
 #include "ui_widgets.h"
@@ -37,20 +39,6 @@ constexpr uint16_t kRoyalBlue = 0x21D9;
 constexpr uint16_t kNeonYellow = 0xFFE0;
 constexpr uint16_t kDeepPurple = 0x881F;
 
-static uint16_t mix565(uint16_t a, uint16_t b, uint8_t amount_b) {
-    const uint16_t ar = (a >> 11) & 0x1F;
-    const uint16_t ag = (a >> 5) & 0x3F;
-    const uint16_t ab = a & 0x1F;
-    const uint16_t br = (b >> 11) & 0x1F;
-    const uint16_t bg = (b >> 5) & 0x3F;
-    const uint16_t bb = b & 0x1F;
-    const uint16_t amount_a = 255 - amount_b;
-    const uint16_t r = (ar * amount_a + br * amount_b) / 255;
-    const uint16_t g = (ag * amount_a + bg * amount_b) / 255;
-    const uint16_t bl = (ab * amount_a + bb * amount_b) / 255;
-    return (uint16_t)((r << 11) | (g << 5) | bl);
-}
-
 enum ValueLabSensor : uint8_t {
     VALUE_SENSOR_TEMP = 0,
     VALUE_SENSOR_HUM,
@@ -157,6 +145,7 @@ static void draw_gauge_ring(int cx, int cy, int radius, int thickness, float rat
     const float sweep_deg = 270.0f;
     const int active_until = (int)roundf(ratio * (float)segs);
 
+    PERF_PROBE_SCOPE(PERF_COLOR_BLEND);
     for (int i = 0; i < segs; ++i) {
         const float a0 = (start_deg + ((float)i * sweep_deg / (float)segs)) * DEG_TO_RAD;
         const float a1 = (start_deg + ((float)(i + 1) * sweep_deg / (float)segs)) * DEG_TO_RAD;
@@ -711,14 +700,17 @@ static void draw_delta_bar(int x, int y, int w, int h, bool valid, float delta_v
     const bool dht_hotter = delta_value >= 0.0f;
     const int step = 3;
 
-    for (int i = 0; i < fill_w; i += step) {
-        const int seg_w = min(step, fill_w - i);
-        const float seg_ratio = (float)(i + seg_w) / (float)max(1, fill_w);
-        const uint16_t color = delta_bar_color(seg_ratio, dht_hotter);
-        if (dht_hotter) {
-            tft.fillRect(center_x - i - seg_w, y + 2, seg_w, h - 4, color);
-        } else {
-            tft.fillRect(center_x + 1 + i, y + 2, seg_w, h - 4, color);
+    {
+        PERF_PROBE_SCOPE(PERF_COLOR_BLEND);
+        for (int i = 0; i < fill_w; i += step) {
+            const int seg_w = min(step, fill_w - i);
+            const float seg_ratio = (float)(i + seg_w) / (float)max(1, fill_w);
+            const uint16_t color = delta_bar_color(seg_ratio, dht_hotter);
+            if (dht_hotter) {
+                tft.fillRect(center_x - i - seg_w, y + 2, seg_w, h - 4, color);
+            } else {
+                tft.fillRect(center_x + 1 + i, y + 2, seg_w, h - 4, color);
+            }
         }
     }
 
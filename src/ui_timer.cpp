@@ -7,6 +7,8 @@
 #include "languages.h"  // Para L()
 #include "fonts.h"      // GFXfont
 #include "layout.h"
+#include "perf_probe.h"
+#include "sprite_pool.h"
 #include <cstring>
 #include <climits>
 #include <stdio.h>
@@ -23,119 +25,112 @@ namespace {
 constexpr int LT_EDITOR_CARD_Y = 64;
 constexpr int LT_EDITOR_CARD_H = 42;
 constexpr int LT_EDITOR_TIME_Y = 82;
-constexpr int LT_RUNTIME_SEGMENTS = 5;
+
+// The value is always "xx:xx:xx" (MM:SS:CC or HH:MM:SS).
+constexpr int LT_TIME_CHARS = 8;
+constexpr int LT_ATLAS_DIGITS = 10;          // tiles 0..9 are the digits
+constexpr int LT_ATLAS_COLON = LT_ATLAS_DIGITS;
+constexpr int LT_ATLAS_MAX_CELL_W = 20;      // FONT_TIMER advances are 14 px
+
+static_assert(sprite_bytes((LT_ATLAS_DIGITS + 1) * LT_ATLAS_MAX_CELL_W, LT_TIME_SPRITE_H) <= SPRITE_ARENA_BYTES,
+              "timer digit atlas exceeds the sprite arena");
 
 } // namespace
 
+// The digits and the colon are rendered once per colour into one strip of
+// tiles, each a full cell high with its black background. A frame then only
+// copies the tiles of the characters that changed (usually the centisecond
+// pair) to the panel; no glyph is rasterised and no cell needs clearing.
 static void draw_timer_value_sprite(const char* time, uint16_t color, bool force_redraw = false) {
-    static TFT_eSprite segmentSprites[LT_RUNTIME_SEGMENTS] = {
-        TFT_eSprite(&tft),
-        TFT_eSprite(&tft),
-        TFT_eSprite(&tft),
-        TFT_eSprite(&tft),
-        TFT_eSprite(&tft)
-    };
-    static bool sprites_ready = false;
+    static SpriteLease atlasLease(&tft);
     static bool layout_ready = false;
-    static int segment_x[LT_RUNTIME_SEGMENTS] = {0, 0, 0, 0, 0};
-    static int segment_w[LT_RUNTIME_SEGMENTS] = {0, 0, 0, 0, 0};
-    static char last_fields[3][3] = {{0}, {0}, {0}};
-    static uint16_t last_color = 0;
+    static int digit_w = 0;
+    static int colon_w = 0;
+    static int char_x[LT_TIME_CHARS] = {};
+    static char last_chars[LT_TIME_CHARS] = {};
+    static uint16_t atlas_color = 0;
 
     auto ensure_layout = [&]() {
         if (layout_ready) return;
 
         tft.setFreeFont(FONT_TIMER);
-        const int field_w = tft.textWidth("88") + 2;
-        const int colon_w = tft.textWidth(":") + 2;
-        const int total_w = field_w * 3 + colon_w * 2;
-        int x = (LT_TIME_SPRITE_W - total_w) / 2;
-
-        segment_x[0] = x;        segment_w[0] = field_w; x += field_w;
-        segment_x[1] = x;        segment_w[1] = colon_w; x += colon_w;
-        segment_x[2] = x;        segment_w[2] = field_w; x += field_w;
-        segment_x[3] = x;        segment_w[3] = colon_w; x += colon_w;
-        segment_x[4] = x;        segment_w[4] = field_w;
+        int widest = 0;
+        for (char c = '0'; c <= '9'; ++c) {
+            const char glyph[2] = { c, '\0' };
+            const int w = tft.textWidth(glyph);
+            if (w > widest) widest = w;
+        }
+        digit_w = widest + 1;
+        colon_w = tft.textWidth(":") + 2;
         tft.setTextFont(0);
+        if (digit_w > LT_ATLAS_MAX_CELL_W) digit_w = LT_ATLAS_MAX_CELL_W;
+        if (colon_w > LT_ATLAS_MAX_CELL_W) colon_w = LT_ATLAS_MAX_CELL_W;
 
+        int x = (LT_TIME_SPRITE_W - (digit_w * 6 + colon_w * 2)) / 2;
+        for (int i = 0; i < LT_TIME_CHARS; ++i) {
+            char_x[i] = x;
+            x += (i == 2 || i == 5) ? colon_w : digit_w;
+        }
         layout_ready = true;
     };
 
-    auto ensure_sprites = [&]() {
-        if (sprites_ready) return;
-        ensure_layout();
-        for (int i = 0; i < LT_RUNTIME_SEGMENTS; ++i) {
-            segmentSprites[i].setColorDepth(16);
-            segmentSprites[i].createSprite(segment_w[i], LT_TIME_SPRITE_H);
+    auto build_atlas = [&](TFT_eSprite& atlas) {
+        PERF_PROBE_SCOPE(PERF_GLYPH_DRAW);
+        atlas.fillSprite(TFT_BLACK);
+        atlas.setTextDatum(MC_DATUM);
+        atlas.setTextColor(color, TFT_BLACK);
+        atlas.setFreeFont(FONT_TIMER);
+        for (int g = 0; g < LT_ATLAS_DIGITS; ++g) {
+            const char glyph[2] = { (char)('0' + g), '\0' };
+            atlas.drawString(glyph, g * digit_w + digit_w / 2, LT_TIME_SPRITE_H / 2 + 1);
         }
-        sprites_ready = true;
+        atlas.drawString(":", LT_ATLAS_COLON * digit_w + colon_w / 2, LT_TIME_SPRITE_H / 2 + 1);
+        atlas.setTextFont(0);
     };
 
-    auto render_segment = [&](TFT_eSprite& sprite, const char* text) {
-        sprite.fillSprite(TFT_BLACK);
-        sprite.setTextDatum(MC_DATUM);
-        sprite.setTextColor(color, TFT_BLACK);
-        sprite.setFreeFont(FONT_TIMER);
-        sprite.drawString(text, sprite.width() / 2, sprite.height() / 2 + 1);
-        sprite.setTextFont(0);
-    };
-
-    auto push_segment = [&](int segment_index) {
-        const int dst_x = LT_TIME_SPRITE_X + segment_x[segment_index];
-        tft.fillRect(dst_x, LT_TIME_SPRITE_Y, segment_w[segment_index], LT_TIME_SPRITE_H, TFT_BLACK);
-        segmentSprites[segment_index].pushSprite(dst_x, LT_TIME_SPRITE_Y, TFT_BLACK);
+    auto push_char = [&](TFT_eSprite& atlas, int index, char c) {
+        const int dst_x = LT_TIME_SPRITE_X + char_x[index];
+        const bool colon = (index == 2 || index == 5);
+        const int w = colon ? colon_w : digit_w;
+        int tile_x;
+        if (c >= '0' && c <= '9' && !colon) {
+            tile_x = (c - '0') * digit_w;
+        } else if (c == ':' && colon) {
+            tile_x = LT_ATLAS_COLON * digit_w;
+        } else {
+            tft.fillRect(dst_x, LT_TIME_SPRITE_Y, w, LT_TIME_SPRITE_H, TFT_BLACK);
+            return;
+        }
+        atlas.pushSprite(dst_x, LT_TIME_SPRITE_Y, tile_x, 0, w, LT_TIME_SPRITE_H);
     };
 
-    ensure_sprites();
+    ensure_layout();
 
-    char fields[3][3] = {
-        { time[0], time[1], '\0' },
-        { time[3], time[4], '\0' },
-        { time[6], time[7], '\0' }
-    };
+    // The lease is dropped on every screen change; a fresh binding starts
+    // out black and needs its glyphs again.
+    bool fresh = false;
+    TFT_eSprite* atlas = atlasLease.acquire(LT_ATLAS_DIGITS * digit_w + colon_w, LT_TIME_SPRITE_H, &fresh);
+    if (!atlas) return;
 
-    const bool color_changed = (last_color != color);
-    if (!force_redraw && !color_changed
-        && strcmp(fields[0], last_fields[0]) == 0
-        && strcmp(fields[1], last_fields[1]) == 0
-        && strcmp(fields[2], last_fields[2]) == 0) {
-        return;
+    const bool rebuild = fresh || atlas_color != color;
+    if (rebuild) {
+        build_atlas(*atlas);
+        atlas_color = color;
     }
 
-    if (force_redraw || color_changed || last_fields[0][0] == '\0') {
+    const bool full = force_redraw || rebuild || last_chars[0] == '\0';
+    if (full) {
         tft.fillRect(LT_TIME_SPRITE_X, LT_TIME_SPRITE_Y, LT_TIME_SPRITE_W, LT_TIME_SPRITE_H, TFT_BLACK);
-
-        render_segment(segmentSprites[0], fields[0]);
-        render_segment(segmentSprites[1], ":");
-        render_segment(segmentSprites[2], fields[1]);
-        render_segment(segmentSprites[3], ":");
-        render_segment(segmentSprites[4], fields[2]);
-
-        for (int i = 0; i < LT_RUNTIME_SEGMENTS; ++i) {
-            segmentSprites[i].pushSprite(LT_TIME_SPRITE_X + segment_x[i], LT_TIME_SPRITE_Y, TFT_BLACK);
-        }
-    } else {
-        if (strcmp(fields[0], last_fields[0]) != 0) {
-            render_segment(segmentSprites[0], fields[0]);
-            push_segment(0);
-        }
-        if (strcmp(fields[1], last_fields[1]) != 0) {
-            render_segment(segmentSprites[2], fields[1]);
-            push_segment(2);
-        }
-        if (strcmp(fields[2], last_fields[2]) != 0) {
-            render_segment(segmentSprites[4], fields[2]);
-            push_segment(4);
-        }
     }
 
-    strncpy(last_fields[0], fields[0], sizeof(last_fields[0]) - 1);
-    last_fields[0][sizeof(last_fields[0]) - 1] = '\0';
-    strncpy(last_fields[1], fields[1], sizeof(last_fields[1]) - 1);
-    last_fields[1][sizeof(last_fields[1]) - 1] = '\0';
-    strncpy(last_fields[2], fields[2], sizeof(last_fields[2]) - 1);
-    last_fields[2][sizeof(last_fields[2]) - 1] = '\0';
-    last_color = color;
+    bool ended = false;
+    for (int i = 0; i < LT_TIME_CHARS; ++i) {
+        if (!ended && time[i] == '\0') ended = true;
+        const char c = ended ? ' ' : time[i];
+        if (!full && c == last_chars[i]) continue;
+        push_char(*atlas, i, c);
+        last_chars[i] = c;
+    }
 }
 
 static void draw_timer_target_label(const char* label, uint16_t color) {
@@ -4,6 +4,7 @@
 #include "ui_widgets.h"
 #include "fonts.h"      // GFXfont Inter (Latin-1: á é í ó ú ñ à è ç...)
 #include "layout.h"
+#include "perf_probe.h"
 #include <stdio.h>      // Para snprintf()
 
 // Global TFT object definition shared by all modules.
@@ -287,6 +288,7 @@ void drawResetChoicePrompt(const char* title,
  * Split the integer and decimal parts so the value can be centered cleanly.
  */
 void drawSplitDecimalValue(float value, int cx, int topY, uint16_t color, uint16_t bg_color) {
+    PERF_PROBE_SCOPE(PERF_GLYPH_DRAW);
     char valStr[8];
     snprintf(valStr, sizeof(valStr), "%.1f", value);
 
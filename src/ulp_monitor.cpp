@@ -0,0 +1,228 @@
+// ulp_monitor.cpp
+// ULP program that watches the LDR and soil ADC channels while the CPU sleeps.
+
+#include "ulp_monitor.h"
+
+#if PBIT_ENABLE_ULP_MONITOR
+
+#include <esp32/ulp.h>
+#include <driver/adc.h>
+#include <soc/rtc_cntl_reg.h>
+#include <math.h>
+#include "ulp_monitor_model.h"
+#include "alert_engine.h"
+#include "hw.h"
+#include "io.h"
+
+namespace {
+
+// Word offsets inside g_ulp_words. The ULP only sees the low 16 bits of each
+// word; the high half of words it stores holds the PC of the ST instruction.
+enum UlpWord : uint16_t {
+    W_LDR_BOUNDARY  = 0,                                   // 4 words
+    W_SOIL_BOUNDARY = W_LDR_BOUNDARY + ULP_MON_MAX_BOUNDARIES,
+    W_LDR_REF       = W_SOIL_BOUNDARY + ULP_MON_MAX_BOUNDARIES,
+    W_SOIL_REF,
+    W_COUNT,
+    W_CAPACITY,
+    W_STREAK,
+    W_CONFIRM,
+    W_WAKE,
+    W_SAMPLES       = 16                                   // ldr, soil pairs
+};
+
+// The program itself goes in the reserved area at the start of RTC slow
+// memory; the data lives in a normal RTC variable so the buffer is not
+// limited by CONFIG_ESP32_ULP_COPROC_RESERVE_MEM.
+RTC_SLOW_ATTR uint32_t g_ulp_words[W_SAMPLES + 2 * ULP_MONITOR_CAPACITY];
+static_assert(W_WAKE < W_SAMPLES, "ULP control words overlap the sample buffer");
+
+// I_ADC takes the ADC1 channel; the macro adds the +1 the SAR mux expects.
+constexpr uint32_t LDR_ADC_PAD  = ADC1_CHANNEL_3;   // GPIO39
+constexpr uint32_t SOIL_ADC_PAD = ADC1_CHANNEL_7;   // GPIO35
+
+enum UlpLabel : uint16_t {
+    LBL_RUN = 1,
+    LBL_SOIL_ZONE,
+    LBL_SOIL_SAME,
+    LBL_LDR_ZONE,
+    LBL_SAME,
+    LBL_DIFF,
+    LBL_CHECK_FULL,
+    LBL_WAKE,
+    LBL_HALT
+};
+
+// R1 = sample, R3 = data base. Leaves the zone (ulp_mon_zone) in R0.
+#define ULP_MON_ZONE_STEP(first, i, done) \
+    I_LD(R2, R3, (first) + (i)), I_SUBR(R2, R1, R2), M_BXF(done), I_ADDI(R0, R0, 1)
+#define ULP_MON_ZONE(first, done) \
+    I_MOVI(R0, 0), \
+    ULP_MON_ZONE_STEP(first, 0, done), ULP_MON_ZONE_STEP(first, 1, done), \
+    ULP_MON_ZONE_STEP(first, 2, done), ULP_MON_ZONE_STEP(first, 3, done), \
+    M_LABEL(done)
+
+uint8_t classify_ldr_raw(uint16_t raw, const void*) {
+    return classify_light_alert(ldr_raw_to_lux((float)raw),
+                                get_light_alerts_enabled(),
+                                get_light_threshold_dim(),
+                                get_light_threshold_bright());
+}
+
+uint8_t classify_soil_raw(uint16_t raw, const void*) {
+    const float soil = soil_raw_to_percent(raw);
+    const bool no_sensor = isnan(soil);
+    return classify_soil_alert(classify_soil_category(soil, no_sensor), no_sensor, get_soil_alerts_enabled());
+}
+
+uint16_t data_base_word() {
+    return (uint16_t)(((uintptr_t)g_ulp_words - (uintptr_t)RTC_SLOW_MEM) / sizeof(uint32_t));
+}
+
+esp_err_t load_program() {
+    const uint16_t base = data_base_word();
+    // Same steps as ulp_mon_step(): guard, store, soil zone, LDR zone, streak, full.
+    const ulp_insn_t program[] = {
+        I_MOVI(R3, base),
+        // A pending wake or a full buffer: idle until the CPU re-arms.
+        I_LD(R0, R3, W_WAKE),
+        M_BGE(LBL_HALT, 1),
+        I_LD(R0, R3, W_COUNT),
+        I_LD(R1, R3, W_CAPACITY),
+        I_SUBR(R1, R0, R1),
+        M_BXF(LBL_RUN),
+        M_BX(LBL_HALT),
+
+        M_LABEL(LBL_RUN),
+        I_LSHI(R2, R0, 1),
+        I_ADDR(R2, R2, R3),
+        I_ADC(R1, 0, LDR_ADC_PAD),
+        I_ST(R1, R2, W_SAMPLES),
+        I_ADC(R1, 0, SOIL_ADC_PAD),
+        I_ST(R1, R2, W_SAMPLES + 1),
+        I_ADDI(R0, R0, 1),
+        I_ST(R0, R3, W_COUNT),
+
+        ULP_MON_ZONE(W_SOIL_BOUNDARY, LBL_SOIL_ZONE),
+        I_LD(R2, R3, W_SOIL_REF),
+        I_SUBR(R2, R0, R2),
+        M_BXZ(LBL_SOIL_SAME),
+        M_BX(LBL_DIFF),
+
+        M_LABEL(LBL_SOIL_SAME),
+        // Reload the LDR sample from slot count - 1.
+        I_LD(R2, R3, W_COUNT),
+        I_SUBI(R2, R2, 1),
+        I_LSHI(R2, R2, 1),
+        I_ADDR(R2, R2, R3),
+        I_LD(R1, R2, W_SAMPLES),
+        ULP_MON_ZONE(W_LDR_BOUNDARY, LBL_LDR_ZONE),
+        I_LD(R2, R3, W_LDR_REF),
+        I_SUBR(R2, R0, R2),
+        M_BXZ(LBL_SAME),
+
+        M_LABEL(LBL_DIFF),
+        I_LD(R0, R3, W_STREAK),
+        I_ADDI(R0, R0, 1),
+        I_ST(R0, R3, W_STREAK),
+        I_LD(R1, R3, W_CONFIRM),
+        I_SUBR(R1, R0, R1),
+        M_BXF(LBL_CHECK_FULL),
+        I_MOVI(R0, ULP_MON_WAKE_CROSSING),
+        M_BX(LBL_WAKE),
+
+        M_LABEL(LBL_SAME),
+        I_MOVI(R0, 0),
+        I_ST(R0, R3, W_STREAK),
+
+        M_LABEL(LBL_CHECK_FULL),
+        I_LD(R0, R3, W_COUNT),
+        I_LD(R1, R3, W_CAPACITY),
+        I_SUBR(R1, R0, R1),
+        M_BXF(LBL_HALT),
+        I_MOVI(R0, ULP_MON_WAKE_FULL),
+
+        M_LABEL(LBL_WAKE),
+        I_ST(R0, R3, W_WAKE),
+        I_WAKE(),
+        I_END(),              // stop the ULP timer; the CPU restarts it
+        M_LABEL(LBL_HALT),
+        I_HALT(),
+    };
+    size_t size = sizeof(program) / sizeof(ulp_insn_t);
+    return ulp_process_macros_and_load(0, program, &size);
+}
+
+void write_state(const UlpMonState& st) {
+    for (uint8_t i = 0; i < ULP_MON_MAX_BOUNDARIES; ++i) {
+        g_ulp_words[W_LDR_BOUNDARY + i] = st.boundary[ULP_MON_CH_LDR][i];
+        g_ulp_words[W_SOIL_BOUNDARY + i] = st.boundary[ULP_MON_CH_SOIL][i];
+    }
+    g_ulp_words[W_LDR_REF] = st.ref_zone[ULP_MON_CH_LDR];
+    g_ulp_words[W_SOIL_REF] = st.ref_zone[ULP_MON_CH_SOIL];
+    g_ulp_words[W_COUNT] = st.count;
+    g_ulp_words[W_CAPACITY] = st.capacity;
+    g_ulp_words[W_STREAK] = st.streak;
+    g_ulp_words[W_CONFIRM] = st.confirm;
+    g_ulp_words[W_WAKE] = st.wake;
+}
+
+} // namespace
+
+bool ulp_monitor_start() {
+    UlpMonState st = {};
+    const uint8_t ldr_changes =
+        ulp_mon_derive_boundaries(classify_ldr_raw, nullptr, st.boundary[ULP_MON_CH_LDR]);
+    const uint8_t soil_changes =
+        ulp_mon_derive_boundaries(classify_soil_raw, nullptr, st.boundary[ULP_MON_CH_SOIL]);
+    if (ldr_changes > ULP_MON_MAX_BOUNDARIES || soil_changes > ULP_MON_MAX_BOUNDARIES) {
+        DPRINT("[ULP] %u/%u class changes, only the lowest %u are watched\n",
+               (unsigned)ldr_changes, (unsigned)soil_changes, (unsigned)ULP_MON_MAX_BOUNDARIES);
+    }
+    st.capacity = ULP_MONITOR_CAPACITY;
+    st.confirm = ULP_MONITOR_CONFIRM_SAMPLES > 0 ? ULP_MONITOR_CONFIRM_SAMPLES : 1;
+
+    // Reference zones come from the CPU's own reading, before ADC1 is handed over.
+    ulp_mon_arm(st, (uint16_t)analogRead(PIN_LDR_SIGNAL), (uint16_t)read_soil_raw_average());
+    write_state(st);
+
+    adc1_config_width(ADC_WIDTH_BIT_12);
+    adc1_config_channel_atten(ADC1_CHANNEL_3, ADC_ATTEN_DB_11);
+    adc1_config_channel_atten(ADC1_CHANNEL_7, ADC_ATTEN_DB_11);
+    adc1_ulp_enable();
+
+    esp_err_t err = load_program();
+    if (err == ESP_OK) err = ulp_set_wakeup_period(0, ULP_MONITOR_INTERVAL_MS * 1000UL);
+    if (err == ESP_OK) err = ulp_run(0);
+    if (err != ESP_OK) {
+        DPRINT("[ULP] start failed: %d\n", (int)err);
+        return false;
+    }
+    DPRINT("[ULP] monitoring, ref zones ldr=%u soil=%u\n",
+           (unsigned)st.ref_zone[ULP_MON_CH_LDR], (unsigned)st.ref_zone[ULP_MON_CH_SOIL]);
+    return true;
+}
+
+void ulp_monitor_stop() {
+    CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+    delayMicroseconds(100);   // let a pass that already started reach HALT
+}
+
+uint8_t ulp_monitor_wake_reason() {
+    return (uint8_t)(g_ulp_words[W_WAKE] & 0xFFFF);
+}
+
+size_t ulp_monitor_take_samples(UlpMonitorSample* out, size_t max) {
+    size_t n = g_ulp_words[W_COUNT] & 0xFFFF;
+    if (n > ULP_MONITOR_CAPACITY) n = ULP_MONITOR_CAPACITY;
+    if (n > max) n = max;
+    for (size_t i = 0; i < n; ++i) {
+        out[i].ldr_raw = (uint16_t)(g_ulp_words[W_SAMPLES + 2 * i] & 0xFFFF);
+        out[i].soil_raw = (uint16_t)(g_ulp_words[W_SAMPLES + 2 * i + 1] & 0xFFFF);
+    }
+    g_ulp_words[W_COUNT] = 0;
+    g_ulp_words[W_WAKE] = ULP_MON_WAKE_NONE;
+    return n;
+}
+
+#endif // PBIT_ENABLE_ULP_MONITOR
@@ -0,0 +1,55 @@
+// ulp_monitor_model.cpp
+// Host-buildable reference for the ULP LDR/soil threshold monitor.
+
+#include "ulp_monitor_model.h"
+
+uint8_t ulp_mon_derive_boundaries(UlpMonClassifier classify, const void* ctx,
+                                  uint16_t out[ULP_MON_MAX_BOUNDARIES]) {
+    for (uint8_t i = 0; i < ULP_MON_MAX_BOUNDARIES; ++i) out[i] = ULP_MON_NO_BOUNDARY;
+
+    uint8_t changes = 0;
+    uint8_t prev = classify(0, ctx);
+    for (uint16_t raw = 1; raw <= ULP_MON_ADC_MAX; ++raw) {
+        const uint8_t code = classify(raw, ctx);
+        if (code == prev) continue;
+        if (changes < ULP_MON_MAX_BOUNDARIES) out[changes] = raw;
+        ++changes;
+        prev = code;
+    }
+    return changes;
+}
+
+uint16_t ulp_mon_zone(uint16_t raw, const uint16_t boundary[ULP_MON_MAX_BOUNDARIES]) {
+    // Boundaries are ascending: stop at the first one above the sample, the
+    // same early exit the ULP program takes.
+    uint16_t zone = 0;
+    while (zone < ULP_MON_MAX_BOUNDARIES && raw >= boundary[zone]) ++zone;
+    return zone;
+}
+
+void ulp_mon_arm(UlpMonState& s, uint16_t ldr_raw, uint16_t soil_raw) {
+    s.ref_zone[ULP_MON_CH_LDR] = ulp_mon_zone(ldr_raw, s.boundary[ULP_MON_CH_LDR]);
+    s.ref_zone[ULP_MON_CH_SOIL] = ulp_mon_zone(soil_raw, s.boundary[ULP_MON_CH_SOIL]);
+    s.count = 0;
+    s.streak = 0;
+    s.wake = ULP_MON_WAKE_NONE;
+}
+
+UlpMonWake ulp_mon_step(UlpMonState& s, uint16_t ldr_raw, uint16_t soil_raw) {
+    if (s.wake != ULP_MON_WAKE_NONE || s.count >= s.capacity) return (UlpMonWake)s.wake;
+    ++s.count;
+
+    // Soil is checked first; a soil change skips the LDR zone, as on the ULP.
+    const bool outside =
+        ulp_mon_zone(soil_raw, s.boundary[ULP_MON_CH_SOIL]) != s.ref_zone[ULP_MON_CH_SOIL] ||
+        ulp_mon_zone(ldr_raw, s.boundary[ULP_MON_CH_LDR]) != s.ref_zone[ULP_MON_CH_LDR];
+
+    if (outside) {
+        ++s.streak;
+        if (s.streak >= s.confirm) s.wake = ULP_MON_WAKE_CROSSING;
+    } else {
+        s.streak = 0;
+    }
+    if (s.wake == ULP_MON_WAKE_NONE && s.count >= s.capacity) s.wake = ULP_MON_WAKE_FULL;
+    return (UlpMonWake)s.wake;
+}
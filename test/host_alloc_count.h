@@ -0,0 +1,67 @@
+#pragma once
+
+// Heap allocation counter for the native suites that must prove a path
+// never allocates. Include it from exactly one suite file: it replaces the
+// global allocation functions for that program.
+//
+// glibc exports its allocator under __libc_*, so malloc/calloc/realloc are
+// replaced too and still reach it. Elsewhere only operator new is counted
+// (HOST_COUNTS_MALLOC is 0).
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Counted only while armed, so Unity's own output does not show up.
+volatile bool g_host_alloc_counting = false;
+volatile uint32_t g_host_allocs = 0;
+
+inline void host_alloc_note() {
+    if (g_host_alloc_counting) g_host_allocs = g_host_allocs + 1;
+}
+
+// Allocations made by fn().
+template <typename Fn>
+uint32_t host_count_allocs(Fn fn) {
+    g_host_allocs = 0;
+    g_host_alloc_counting = true;
+    fn();
+    g_host_alloc_counting = false;
+    return g_host_allocs;
+}
+
+#if defined(__GLIBC__)
+#define HOST_COUNTS_MALLOC 1
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t n, size_t size);
+extern "C" void* __libc_realloc(void* p, size_t size);
+
+extern "C" void* malloc(size_t size) {
+    host_alloc_note();
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t n, size_t size) {
+    host_alloc_note();
+    return __libc_calloc(n, size);
+}
+
+extern "C" void* realloc(void* p, size_t size) {
+    host_alloc_note();
+    return __libc_realloc(p, size);
+}
+#else
+#define HOST_COUNTS_MALLOC 0
+#endif
+
+void* operator new(size_t size) {
+    if (!HOST_COUNTS_MALLOC) host_alloc_note();     // otherwise counted by malloc()
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
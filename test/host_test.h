@@ -0,0 +1,36 @@
+#pragma once
+
+// Shared fixture for the native suites in test/ (`pio test -e native`).
+//
+// Each test_* directory is one host program: it includes this header,
+// defines setUp()/tearDown() and its test cases, and runs them from main()
+// through Unity. Only the host-buildable modules listed in the [env:native]
+// build_src_filter are linked, so nothing here may pull in Arduino or IDF
+// headers.
+
+#include <unity.h>
+
+#include <chrono>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// printf-style TEST_MESSAGE, for numbers worth seeing in the log (timings,
+// counts) that are not assertions.
+inline void host_test_message(const char* fmt, ...) {
+    char buf[160];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    TEST_MESSAGE(buf);
+}
+
+// Mean wall-clock ns per call of fn(i) over `iterations` calls.
+template <typename Fn>
+double host_bench_ns(uint32_t iterations, Fn fn) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) fn(i);
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+}
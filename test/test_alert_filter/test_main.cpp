@@ -0,0 +1,167 @@
+// Alert hysteresis and dwell filter (src/alert_filter.cpp), replayed over
+// sensor traces at the sensor task rate.
+//
+// The traces sit on the sound loud threshold and the soil dry boundary with
+// the default thresholds from hw.cpp, plus sensor-like noise from a fixed
+// LCG so every run sees the same samples. Each test counts committed code
+// changes and compares them with the flips of the bare classifier.
+
+#include "host_test.h"
+#include "alert_filter.h"
+
+namespace {
+
+constexpr uint32_t kSensorPeriodMs = 100;   // sensor task loop (io.cpp)
+
+// hw.cpp defaults; alert_engine.cpp passes quiet/loud as the sound limits.
+constexpr int kSoundQuietMax = 20;
+constexpr int kSoundLoudMax = 85;
+constexpr int kSoilDry = 20;
+constexpr int kSoilOptimal = 55;
+constexpr int kSoilMoist = 80;
+
+struct Replay {
+    AlertSensor sensor;
+    AlertInput in;
+    uint8_t stable;
+    AlertFilterState state;
+    uint32_t now_ms;
+    uint8_t last_raw;
+    int changes;
+    int raw_flips;
+    uint32_t last_change_ms;
+};
+
+Replay make_replay(AlertSensor sensor) {
+    Replay r = {};
+    r.sensor = sensor;
+    r.in.enabled = true;
+    if (sensor == AlertSensor::Sound) {
+        r.in.low = kSoundQuietMax;
+        r.in.high = kSoundLoudMax;
+    } else {
+        r.in.low = kSoilDry;
+        r.in.mid = kSoilOptimal;
+        r.in.high = kSoilMoist;
+    }
+    r.stable = ALERT_CODE_OFF;
+    return r;
+}
+
+void feed(Replay& r, float value) {
+    r.in.value = value;
+    const uint8_t raw = alert_classify_input(r.sensor, r.in, value);
+    if (r.now_ms > 0 && raw != r.last_raw) r.raw_flips++;
+    r.last_raw = raw;
+    const uint8_t code = alert_filter_code(r.sensor, r.in, r.stable, r.state, r.now_ms);
+    if (code != r.stable) {
+        if (r.stable != ALERT_CODE_OFF) r.changes++;
+        r.stable = code;
+        r.last_change_ms = r.now_ms;
+    }
+    r.now_ms += kSensorPeriodMs;
+}
+
+void hold(Replay& r, float value, uint32_t duration_ms) {
+    for (uint32_t t = 0; t < duration_ms; t += kSensorPeriodMs) feed(r, value);
+}
+
+// Uniform noise in [-amp, amp], same sequence on every run.
+struct Noise {
+    uint32_t state;
+    float next(float amp) {
+        state = state * 1664525u + 1013904223u;
+        return ((float)(state >> 8) / (float)(1u << 24) * 2.0f - 1.0f) * amp;
+    }
+};
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_sound_hovering_at_loud_threshold(void) {
+    Replay r = make_replay(AlertSensor::Sound);
+    Noise n = { 1 };
+    hold(r, 70.0f, 1000);
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_HIGH, r.stable);
+    for (int i = 0; i < 300; ++i) feed(r, (float)kSoundLoudMax + n.next(2.5f));   // 30 s
+    host_test_message("sound at %d: %d raw flips, %d committed", kSoundLoudMax, r.raw_flips, r.changes);
+    TEST_ASSERT_GREATER_THAN(20, r.raw_flips);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, r.changes, "noise inside the band never commits");
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_HIGH, r.stable);
+}
+
+void test_sound_burst_shorter_than_dwell(void) {
+    Replay r = make_replay(AlertSensor::Sound);
+    hold(r, 70.0f, 1000);
+    const uint32_t dwell = ALERT_FILTER_SPEC[(size_t)AlertSensor::Sound].dwell_ms;
+    hold(r, 95.0f, dwell - kSensorPeriodMs);
+    hold(r, 70.0f, 1000);
+    TEST_ASSERT_EQUAL_INT(0, r.changes);
+}
+
+void test_sound_sustained_loud_commits_once_each_way(void) {
+    Replay r = make_replay(AlertSensor::Sound);
+    Noise n = { 7 };
+    hold(r, 70.0f, 1000);
+    const uint32_t onset = r.now_ms;
+    for (int i = 0; i < 50; ++i) feed(r, 95.0f + n.next(2.0f));
+    TEST_ASSERT_EQUAL_INT(1, r.changes);
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_CRITICAL, r.stable);
+    const uint32_t delay = r.last_change_ms - onset;
+    TEST_ASSERT_TRUE_MESSAGE(delay >= ALERT_FILTER_SPEC[(size_t)AlertSensor::Sound].dwell_ms &&
+                             delay <= ALERT_FILTER_SPEC[(size_t)AlertSensor::Sound].dwell_ms + kSensorPeriodMs,
+                             "commits after the dwell time");
+    for (int i = 0; i < 50; ++i) feed(r, 70.0f + n.next(2.0f));
+    TEST_ASSERT_EQUAL_INT(2, r.changes);
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_HIGH, r.stable);
+}
+
+void test_soil_hovering_at_dry_boundary(void) {
+    Replay r = make_replay(AlertSensor::Soil);
+    Noise n = { 3 };
+    hold(r, 30.0f, 2000);
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_OK, r.stable);
+    for (int i = 0; i < 3000; ++i) feed(r, (float)kSoilDry + n.next(1.8f));   // 5 min
+    host_test_message("soil at %d: %d raw flips, %d committed", kSoilDry, r.raw_flips, r.changes);
+    TEST_ASSERT_GREATER_THAN(50, r.raw_flips);
+    TEST_ASSERT_EQUAL_INT(0, r.changes);
+}
+
+void test_soil_drying_through_boundary(void) {
+    Replay r = make_replay(AlertSensor::Soil);
+    Noise n = { 11 };
+    hold(r, 26.0f, 2000);
+    // 26 % -> 14 % over 10 min with +/-1.5 % of probe noise.
+    const int steps = 6000;
+    for (int i = 0; i <= steps; ++i) feed(r, 26.0f - 12.0f * (float)i / steps + n.next(1.5f));
+    host_test_message("soil ramp: %d raw flips, %d committed", r.raw_flips, r.changes);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, r.changes, "one OK -> LOW transition");
+    TEST_ASSERT_EQUAL_UINT8(ALERT_CODE_LOW, r.stable);
+}
+
+void test_off_is_immediate(void) {
+    Replay r = make_replay(AlertSensor::Soil);
+    hold(r, 30.0f, 2000);
+    r.in.no_sensor = true;
+    feed(r, 30.0f);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ALERT_CODE_OFF, r.stable, "probe lost");
+    r.in.no_sensor = false;
+    feed(r, 10.0f);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ALERT_CODE_LOW, r.stable, "back without dwell");
+    r.in.enabled = false;
+    feed(r, 10.0f);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(ALERT_CODE_OFF, r.stable, "alerts disabled");
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sound_hovering_at_loud_threshold);
+    RUN_TEST(test_sound_burst_shorter_than_dwell);
+    RUN_TEST(test_sound_sustained_loud_commits_once_each_way);
+    RUN_TEST(test_soil_hovering_at_dry_boundary);
+    RUN_TEST(test_soil_drying_through_boundary);
+    RUN_TEST(test_off_is_immediate);
+    return UNITY_END();
+}
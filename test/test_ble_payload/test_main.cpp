@@ -0,0 +1,169 @@
+// BLE payload encoders (src/ble_payload.cpp).
+//
+// The notify path runs at 10 Hz for as long as a client is connected, so
+// assm_pkt() and makeJson() must not allocate. This suite counts every
+// malloc/calloc/realloc and operator new made while they run, over a sweep
+// of readings that covers missing sensors, negatives and the widest values,
+// and checks the bytes they produce against hand-built payloads.
+
+#include "host_test.h"
+#include "host_alloc_count.h"
+#include "ble_payload.h"
+
+#include <math.h>
+#include <string.h>
+
+namespace {
+
+Reading make_reading(float temp, float hum, float ldr, float mic, float soil, float ds18) {
+    Reading r;
+    r.humidity = hum;
+    r.temperature = temp;
+    r.ldr = ldr;
+    r.ldr_raw = NAN;
+    r.mic = mic;
+    r.soil_humidity = soil;
+    r.temp_ds18b20 = ds18;
+    r.co2_ppm = NAN;
+    r.co2_temperature = NAN;
+    r.co2_humidity = NAN;
+    r.lux_i2c = NAN;
+    return r;
+}
+
+// Longest JSON the firmware can produce (see JSON_PACKET_MAX_LEN).
+const Reading kWidest = make_reading(-20.0f, 100.0f, 20000.0f, 100.0f, 100.0f, -55.0f);
+const Reading kMissing = make_reading(NAN, NAN, NAN, NAN, NAN, -999.0f);
+
+// Readings from every range the sensors report, with NaN dropouts mixed in.
+Reading sweep_reading(uint32_t i) {
+    const float t = -20.0f + (float)(i % 701) * 0.1f;
+    Reading r = make_reading(t, (float)(i % 1001) * 0.1f, (float)(i * 37 % 20001), (float)(i % 101),
+                             (float)(i * 7 % 101), -55.0f + (float)(i % 1800) * 0.1f);
+    if (i % 11 == 0) r.temperature = NAN;
+    if (i % 13 == 0) r.humidity = NAN;
+    if (i % 17 == 0) r.ldr = NAN;
+    if (i % 19 == 0) r.mic = NAN;
+    if (i % 23 == 0) r.soil_humidity = NAN;
+    if (i % 29 == 0) r.temp_ds18b20 = -999.0f;
+    return r;
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_counter_sees_allocations(void) {
+    // Guards against the overrides silently not being linked in.
+    const uint32_t allocs = host_count_allocs([] {
+        int* p = new int(1);
+        delete p;
+#if HOST_COUNTS_MALLOC
+        void* q = malloc(16);
+        free(q);
+#endif
+    });
+    TEST_ASSERT_EQUAL_UINT32(HOST_COUNTS_MALLOC ? 2 : 1, allocs);
+}
+
+void test_packet_layout(void) {
+    uint8_t buf[DATA_PACKET_LEN];
+    memset(buf, 0xAA, sizeof(buf));
+    const Reading r = make_reading(-12.3f, 45.6f, 1234.0f, 77.0f, 55.0f, 21.5f);
+    TEST_ASSERT_EQUAL_UINT32(DATA_PACKET_LEN, assm_pkt(r, buf));
+    // -123 = 0xFF85, 456 = 0x01C8, 1234 = 0x04D2, 215 = 0x00D7.
+    const uint8_t expected[DATA_PACKET_LEN] = {
+        0x02, 0x00,
+        1, 0x85, 0xFF,
+        2, 0xC8, 0x01,
+        3, 0xD2, 0x04,
+        4, 77, 0,
+        5, 55, 0,
+        6, 0xD7, 0x00,
+    };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buf, DATA_PACKET_LEN);
+}
+
+void test_packet_missing_sensors(void) {
+    uint8_t buf[DATA_PACKET_LEN];
+    memset(buf, 0xAA, sizeof(buf));
+    assm_pkt(kMissing, buf);
+    for (int field = 0; field < 6; ++field) {
+        TEST_ASSERT_EQUAL_UINT8(field + 1, buf[2 + field * 3]);
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, buf[3 + field * 3], "missing sensor sends 0");
+        TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, buf[4 + field * 3], "missing sensor sends 0");
+    }
+}
+
+void test_json_fields(void) {
+    char out[JSON_PACKET_MAX_LEN];
+    const Reading r = make_reading(-0.4f, 45.6f, 1234.0f, 77.0f, 55.0f, 21.5f);
+    const size_t len = makeJson(r, out, sizeof(out));
+    TEST_ASSERT_EQUAL_STRING("{\"temp\":-0.4,\"hum\":45.6,\"ldr\":1234,\"mic\":77,\"soil\":55,\"ds18\":21.5}", out);
+    TEST_ASSERT_EQUAL_UINT32(strlen(out), len);
+
+    TEST_ASSERT_EQUAL_UINT32(2, makeJson(kMissing, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_STRING_MESSAGE("{}", out, "missing sensors are left out");
+}
+
+void test_json_widest_fits(void) {
+    char out[JSON_PACKET_MAX_LEN];
+    const size_t len = makeJson(kWidest, out, sizeof(out));
+    TEST_ASSERT_EQUAL_STRING("{\"temp\":-20.0,\"hum\":100.0,\"ldr\":20000,\"mic\":100,\"soil\":100,\"ds18\":-55.0}",
+                             out);
+    TEST_ASSERT_TRUE_MESSAGE(len < JSON_PACKET_MAX_LEN, "room for the terminator");
+}
+
+void test_json_truncates(void) {
+    char out[8];
+    memset(out, 'x', sizeof(out));
+    TEST_ASSERT_EQUAL_UINT32(7, makeJson(kWidest, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_STRING("{\"temp\"", out);
+    TEST_ASSERT_EQUAL_UINT32(0, makeJson(kWidest, out, 0));
+}
+
+void test_zero_allocations(void) {
+    uint8_t pkt[DATA_PACKET_LEN];
+    char json[JSON_PACKET_MAX_LEN];
+    constexpr uint32_t kReadings = 100000;
+    size_t bytes = 0;
+
+    const uint32_t allocs = host_count_allocs([&] {
+        bytes += assm_pkt(kWidest, pkt) + makeJson(kWidest, json, sizeof(json));
+        bytes += assm_pkt(kMissing, pkt) + makeJson(kMissing, json, sizeof(json));
+        for (uint32_t i = 0; i < kReadings; ++i) {
+            const Reading r = sweep_reading(i);
+            bytes += assm_pkt(r, pkt);
+            bytes += makeJson(r, json, sizeof(json));
+        }
+    });
+
+    host_test_message("%u readings, %u payload bytes, %u allocations%s", (unsigned)kReadings, (unsigned)bytes,
+                      (unsigned)allocs, HOST_COUNTS_MALLOC ? "" : " (operator new only)");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, allocs, "assm_pkt/makeJson allocated");
+}
+
+void test_cost_report(void) {
+    uint8_t pkt[DATA_PACKET_LEN];
+    char json[JSON_PACKET_MAX_LEN];
+    volatile size_t sink = 0;
+    const double pkt_ns = host_bench_ns(1000000, [&](uint32_t i) { sink = assm_pkt(sweep_reading(i), pkt); });
+    const double json_ns =
+        host_bench_ns(1000000, [&](uint32_t i) { sink = makeJson(sweep_reading(i), json, sizeof(json)); });
+    (void)sink;
+    host_test_message("assm_pkt %6.1f ns, makeJson %6.1f ns (sweep_reading included)", pkt_ns, json_ns);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_allocations);
+    RUN_TEST(test_packet_layout);
+    RUN_TEST(test_packet_missing_sensors);
+    RUN_TEST(test_json_fields);
+    RUN_TEST(test_json_widest_fits);
+    RUN_TEST(test_json_truncates);
+    RUN_TEST(test_zero_allocations);
+    RUN_TEST(test_cost_report);
+    return UNITY_END();
+}
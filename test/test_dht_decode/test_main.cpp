@@ -0,0 +1,136 @@
+// DHT11 pulse decoder (src/dht_decode.cpp).
+//
+// The captures are pulse trains in the form the RMT receiver delivers them
+// (level + µs, starting with the tail of the host start pulse). They are
+// built from the DHT11 datasheet timing, with the spread seen between units:
+// fast and slow parts, the 20-40 µs release gap, and a few broken frames.
+// Paste real captures into kRecorded as { level, us } pairs to replay them.
+
+#include "host_test.h"
+#include "dht_decode.h"
+
+#include <vector>
+
+namespace {
+
+struct Timing {
+    uint16_t release_us;        // host release until the sensor pulls low
+    uint16_t response_low_us;
+    uint16_t response_high_us;
+    uint16_t bit_low_us;
+    uint16_t zero_high_us;
+    uint16_t one_high_us;
+};
+
+constexpr Timing kNominal = { 30, 80, 80, 50, 26, 70 };
+constexpr Timing kFastUnit = { 20, 72, 74, 44, 22, 64 };
+constexpr Timing kSlowUnit = { 40, 92, 88, 58, 32, 78 };
+
+std::vector<DhtPulse> capture(const uint8_t (&bytes)[5], const Timing& t) {
+    std::vector<DhtPulse> p;
+    p.push_back({ 0, 6 });                  // start pulse tail after rmt_rx_start
+    p.push_back({ 1, t.release_us });
+    p.push_back({ 0, t.response_low_us });
+    p.push_back({ 1, t.response_high_us });
+    for (int bit = 0; bit < 40; ++bit) {
+        const bool one = (bytes[bit / 8] >> (7 - bit % 8)) & 1;
+        p.push_back({ 0, t.bit_low_us });
+        p.push_back({ 1, one ? t.one_high_us : t.zero_high_us });
+    }
+    p.push_back({ 0, t.bit_low_us });       // end of frame, then the line idles high
+    return p;
+}
+
+DhtDecodeStatus decode(const std::vector<DhtPulse>& p, DhtFrame* frame) {
+    return dht_decode_pulses(p.data(), p.size(), frame);
+}
+
+// 45.0 %RH, 23.4 °C; checksum 45 + 0 + 23 + 4 = 72.
+constexpr uint8_t kRoom[5] = { 45, 0, 23, 4, 72 };
+// 80.0 %RH, -2.5 °C: the library reads 0x85 as -1 - T + 0.5.
+constexpr uint8_t kCold[5] = { 80, 0, 2, 0x85, 80 + 2 + 0x85 };
+
+// Placeholder for captures taken on hardware (DPRINT the pulses in
+// capture_response()). Empty entries are skipped.
+const DhtPulse kRecorded[] = { { 0, 0 } };
+
+void expect_room(const Timing& timing) {
+    DhtFrame frame;
+    float h = 0.0f;
+    float t = 0.0f;
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::Ok, (int)decode(capture(kRoom, timing), &frame));
+    dht11_frame_values(frame, &h, &t);
+    TEST_ASSERT_EQUAL_FLOAT(45.0f, h);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 23.4f, t);
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_nominal_timing(void) { expect_room(kNominal); }
+void test_fast_unit(void) { expect_room(kFastUnit); }
+void test_slow_unit(void) { expect_room(kSlowUnit); }
+
+void test_negative_temperature(void) {
+    DhtFrame frame;
+    float h = 0.0f;
+    float t = 0.0f;
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::Ok, (int)decode(capture(kCold, kNominal), &frame));
+    dht11_frame_values(frame, &h, &t);
+    TEST_ASSERT_EQUAL_FLOAT(80.0f, h);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.05f, -2.5f, t, "negative temperature follows the Adafruit rule");
+}
+
+void test_truncated_capture(void) {
+    DhtFrame frame;
+    std::vector<DhtPulse> p = capture(kRoom, kNominal);
+    p.resize(p.size() - 20);
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::ShortFrame, (int)decode(p, &frame));
+}
+
+void test_out_of_window_bit(void) {
+    DhtFrame frame;
+    std::vector<DhtPulse> p = capture(kRoom, kNominal);
+    p[4 + 2 * 10 + 1].us = 140;             // bit 10 high stretched past any valid width
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::BadTiming, (int)decode(p, &frame));
+}
+
+void test_checksum_mismatch(void) {
+    DhtFrame frame;
+    const uint8_t bad_sum[5] = { 45, 0, 23, 4, 73 };
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::Checksum, (int)decode(capture(bad_sum, kNominal), &frame));
+}
+
+void test_no_response(void) {
+    DhtFrame frame;
+    const std::vector<DhtPulse> silent = { { 0, 6 }, { 1, 200 } };
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::NoResponse, (int)decode(silent, &frame));
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::NoResponse, (int)dht_decode_pulses(nullptr, 0, &frame));
+}
+
+void test_recorded_capture(void) {
+    if (kRecorded[0].us == 0) TEST_IGNORE_MESSAGE("no hardware capture pasted in kRecorded");
+    DhtFrame frame;
+    float h = 0.0f;
+    float t = 0.0f;
+    const DhtDecodeStatus s = dht_decode_pulses(kRecorded, sizeof(kRecorded) / sizeof(kRecorded[0]), &frame);
+    dht11_frame_values(frame, &h, &t);
+    host_test_message("%s: %.1f %%RH %.1f C", dht_decode_status_name(s), h, t);
+    TEST_ASSERT_EQUAL_INT((int)DhtDecodeStatus::Ok, (int)s);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_nominal_timing);
+    RUN_TEST(test_fast_unit);
+    RUN_TEST(test_slow_unit);
+    RUN_TEST(test_negative_temperature);
+    RUN_TEST(test_truncated_capture);
+    RUN_TEST(test_out_of_window_bit);
+    RUN_TEST(test_checksum_mismatch);
+    RUN_TEST(test_no_response);
+    RUN_TEST(test_recorded_capture);
+    return UNITY_END();
+}
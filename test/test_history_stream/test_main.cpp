@@ -0,0 +1,452 @@
+// BLE history download framing (src/history_stream.cpp).
+//
+// A snapshot is streamed through history_encode_next() at the payload sizes
+// of a default (23) and a negotiated (247) ATT MTU, and a client built on
+// history_decode_frame() reassembles it. The pump in ble.cpp encodes from a
+// copy of the cursor and keeps the copy only when notify() succeeds; the
+// dropped-frame tests replay that pattern. The sleep-log source (0x11
+// records) goes through the same checks.
+
+#include "host_test.h"
+#include "history_stream.h"
+
+#include <string.h>
+#include <vector>
+
+namespace {
+
+constexpr size_t kMinPayload = 23 - 3;
+constexpr size_t kMaxPayload = 247 - 3;
+constexpr uint8_t kAllSensors = 0x3F;
+
+HistorySnapshot make_snapshot(uint16_t id) {
+    HistorySnapshot snap = {};
+    snap.id = id;
+    const uint16_t counts[HISTORY_SENSOR_COUNT] = { 160, 160, 37, 0, 1, 159 };
+    for (uint8_t s = 0; s < HISTORY_SENSOR_COUNT; ++s) {
+        snap.count[s] = counts[s];
+        snap.scale[s] = (s == 2) ? 1 : 10;
+        for (uint16_t k = 0; k < counts[s]; ++k) snap.samples[s][k] = (int16_t)(s * 1000 - 500 + k * 7);
+    }
+    snap.samples[5][3] = HISTORY_SAMPLE_INVALID;
+    return snap;
+}
+
+struct Client {
+    std::vector<int16_t> samples[HISTORY_SENSOR_COUNT];
+    uint16_t next_offset[HISTORY_SENSOR_COUNT] = {};
+    uint16_t snapshot_id = 0;
+    bool done = false;
+    uint32_t end_total = 0;
+    int frames = 0;
+
+    // Returns false on any framing error.
+    bool accept(const uint8_t* data, size_t len) {
+        HistoryFrame f;
+        if (!history_decode_frame(data, len, f)) return false;
+        ++frames;
+        if (f.type == HISTORY_FRAME_END) {
+            done = true;
+            end_total = f.total;
+            return f.snapshot_id == snapshot_id;
+        }
+        if (snapshot_id == 0) snapshot_id = f.snapshot_id;
+        const uint8_t idx = f.sensor_id - 1;
+        if (f.snapshot_id != snapshot_id || f.offset != next_offset[idx] || f.sample_count == 0) return false;
+        for (uint16_t i = 0; i < f.sample_count; ++i) samples[idx].push_back(history_frame_sample(f, i));
+        next_offset[idx] = (uint16_t)(f.offset + f.sample_count);
+        return true;
+    }
+};
+
+// Streams until the end frame, dropping every `drop_every`-th frame the way a
+// failed notify() does (0: never). Returns false on a framing error.
+bool stream(const HistorySnapshot& snap, HistoryCursor& cur, size_t cap, Client& client, int drop_every = 0) {
+    uint8_t frame[kMaxPayload];
+    int sent = 0;
+    for (int guard = 0; guard < 2000; ++guard) {
+        HistoryCursor next = cur;
+        const size_t len = history_encode_next(snap, next, frame, cap);
+        if (len == 0) return true;
+        if (len > cap) return false;
+        if (drop_every && (++sent % drop_every) == 0) continue;   // not queued: cursor stays
+        cur = next;
+        if (!client.accept(frame, len)) return false;
+    }
+    return false;
+}
+
+void expect_complete(const HistorySnapshot& snap, const Client& client, uint8_t mask) {
+    uint32_t total = 0;
+    for (uint8_t s = 0; s < HISTORY_SENSOR_COUNT; ++s) {
+        const bool selected = mask & (1u << s);
+        const size_t expected = selected ? snap.count[s] : 0;
+        TEST_ASSERT_EQUAL_UINT32(expected, client.samples[s].size());
+        for (size_t k = 0; k < expected; ++k) TEST_ASSERT_EQUAL_INT16(snap.samples[s][k], client.samples[s][k]);
+        total += expected;
+    }
+    TEST_ASSERT_TRUE(client.done);
+    TEST_ASSERT_EQUAL_UINT32(total, client.end_total);
+}
+
+void begin(HistoryCursor& cur, const HistorySnapshot& snap, uint8_t mask, uint16_t id = 0, uint8_t sensor = 0,
+           uint16_t offset = 0) {
+    const HistoryStartRequest req = { mask, id, sensor, offset, HISTORY_SOURCE_GRAPH };
+    history_cursor_begin(cur, snap, req);
+}
+
+std::vector<SleepLogSample> make_log(size_t n) {
+    std::vector<SleepLogSample> log(n);
+    for (size_t i = 0; i < n; ++i) {
+        SleepLogSample& r = log[i];
+        r.t_s = 0x01000000u + (uint32_t)i * 60;
+        r.temp_x10 = (int16_t)(215 - (int)i);
+        r.hum_x10 = (int16_t)(400 + i);
+        r.ds18_x10 = (i % 5 == 0) ? INT16_MIN : (int16_t)(-30 + (int)i);
+        r.ldr = (uint16_t)(i * 41);
+        r.soil = (i % 7 == 0) ? 0xFF : (uint8_t)i;
+        r.mic = 0xFF;
+    }
+    return log;
+}
+
+HistoryLogSnapshot log_snapshot(const std::vector<SleepLogSample>& log, uint16_t id) {
+    const HistoryLogSnapshot snap = { id, (uint16_t)log.size(), log.data() };
+    return snap;
+}
+
+struct LogClient {
+    std::vector<SleepLogSample> records;
+    uint16_t snapshot_id = 0;
+    bool done = false;
+    uint32_t end_total = 0;
+    int frames = 0;
+
+    bool accept(const uint8_t* data, size_t len) {
+        HistoryFrame f;
+        if (!history_decode_frame(data, len, f)) return false;
+        ++frames;
+        if (f.type == HISTORY_FRAME_END) {
+            done = true;
+            end_total = f.total;
+            return f.snapshot_id == snapshot_id;
+        }
+        if (f.type != HISTORY_FRAME_LOG) return false;
+        if (snapshot_id == 0) snapshot_id = f.snapshot_id;
+        if (f.snapshot_id != snapshot_id || f.offset != records.size() || f.sample_count == 0) return false;
+        for (uint16_t i = 0; i < f.sample_count; ++i) {
+            SleepLogSample rec;
+            if (!history_frame_log_record(f, i, rec)) return false;
+            records.push_back(rec);
+        }
+        return true;
+    }
+};
+
+bool stream_log(const HistoryLogSnapshot& log, HistoryCursor& cur, size_t cap, LogClient& client, int drop_every = 0) {
+    uint8_t frame[kMaxPayload];
+    int sent = 0;
+    for (int guard = 0; guard < 2000; ++guard) {
+        HistoryCursor next = cur;
+        const size_t len = history_log_encode_next(log, next, frame, cap);
+        if (len == 0) return true;
+        if (len > cap) return false;
+        if (drop_every && (++sent % drop_every) == 0) continue;
+        cur = next;
+        if (!client.accept(frame, len)) return false;
+    }
+    return false;
+}
+
+void expect_log_complete(const std::vector<SleepLogSample>& log, const LogClient& client) {
+    TEST_ASSERT_EQUAL_UINT32(log.size(), client.records.size());
+    for (size_t i = 0; i < log.size(); ++i) {
+        TEST_ASSERT_EQUAL_UINT32(log[i].t_s, client.records[i].t_s);
+        TEST_ASSERT_EQUAL_INT16(log[i].temp_x10, client.records[i].temp_x10);
+        TEST_ASSERT_EQUAL_INT16(log[i].hum_x10, client.records[i].hum_x10);
+        TEST_ASSERT_EQUAL_INT16(log[i].ds18_x10, client.records[i].ds18_x10);
+        TEST_ASSERT_EQUAL_UINT16(log[i].ldr, client.records[i].ldr);
+        TEST_ASSERT_EQUAL_UINT8(log[i].soil, client.records[i].soil);
+        TEST_ASSERT_EQUAL_UINT8(log[i].mic, client.records[i].mic);
+    }
+    TEST_ASSERT_TRUE(client.done);
+    TEST_ASSERT_EQUAL_UINT32(log.size(), client.end_total);
+}
+
+void begin_log(HistoryCursor& cur, const HistoryLogSnapshot& log, uint16_t id = 0, uint16_t offset = 0) {
+    const HistoryStartRequest req = { 0, id, 0, offset, HISTORY_SOURCE_SLEEP_LOG };
+    history_log_cursor_begin(cur, log, req);
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_start_command_round_trip(void) {
+    const HistoryStartRequest req = { 0x15, 0xBEEF, 3, 0x0102, HISTORY_SOURCE_GRAPH };
+    uint8_t buf[HISTORY_CMD_START_LEN];
+    TEST_ASSERT_EQUAL_UINT32(HISTORY_CMD_START_LEN, history_encode_start(req, buf, sizeof(buf)));
+    const uint8_t expected[] = { 0x10, 0x15, 0xEF, 0xBE, 0x03, 0x02, 0x01 };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buf, sizeof(expected));
+
+    HistoryStartRequest back;
+    TEST_ASSERT_TRUE(history_parse_start(buf, sizeof(buf), back));
+    TEST_ASSERT_EQUAL_UINT8(req.mask, back.mask);
+    TEST_ASSERT_EQUAL_UINT16(req.snapshot_id, back.snapshot_id);
+    TEST_ASSERT_EQUAL_UINT8(req.sensor_id, back.sensor_id);
+    TEST_ASSERT_EQUAL_UINT16(req.offset, back.offset);
+
+    TEST_ASSERT_FALSE_MESSAGE(history_parse_start(buf, sizeof(buf) - 1, back), "short command");
+    buf[0] = HISTORY_CMD_ABORT;
+    TEST_ASSERT_FALSE_MESSAGE(history_parse_start(buf, sizeof(buf), back), "other opcode");
+    TEST_ASSERT_EQUAL_UINT32(0, history_encode_start(req, buf, HISTORY_CMD_START_LEN - 1));
+}
+
+void test_start_command_source(void) {
+    HistoryStartRequest req = { 0, 3, 0, 17, HISTORY_SOURCE_SLEEP_LOG };
+    uint8_t buf[HISTORY_CMD_START_SOURCE_LEN];
+    TEST_ASSERT_EQUAL_UINT32(HISTORY_CMD_START_SOURCE_LEN, history_encode_start(req, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_UINT8(HISTORY_SOURCE_SLEEP_LOG, buf[7]);
+    TEST_ASSERT_EQUAL_UINT32(0, history_encode_start(req, buf, HISTORY_CMD_START_LEN));
+
+    HistoryStartRequest back;
+    TEST_ASSERT_TRUE(history_parse_start(buf, sizeof(buf), back));
+    TEST_ASSERT_EQUAL_UINT8(HISTORY_SOURCE_SLEEP_LOG, back.source);
+    TEST_ASSERT_EQUAL_UINT16(17, back.offset);
+    TEST_ASSERT_TRUE(history_parse_start(buf, HISTORY_CMD_START_LEN, back));
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(HISTORY_SOURCE_GRAPH, back.source, "7-byte command is the graph");
+
+    buf[7] = 2;
+    TEST_ASSERT_FALSE_MESSAGE(history_parse_start(buf, sizeof(buf), back), "unknown source");
+}
+
+void test_quantize(void) {
+    TEST_ASSERT_EQUAL_INT16(235, history_quantize(23.46f, 10));
+    TEST_ASSERT_EQUAL_INT16(-25, history_quantize(-2.5f, 10));
+    TEST_ASSERT_EQUAL_INT16(20000, history_quantize(20000.0f, 1));
+    TEST_ASSERT_EQUAL_INT16(HISTORY_SAMPLE_INVALID, history_quantize(NAN, 10));
+    TEST_ASSERT_EQUAL_INT16_MESSAGE(HISTORY_SAMPLE_INVALID, history_quantize(20000.0f, 10), "overflows int16");
+    TEST_ASSERT_EQUAL_INT16_MESSAGE(HISTORY_SAMPLE_INVALID, history_quantize(-3276.8f, 10), "sentinel is never a value");
+}
+
+void test_full_stream_at_both_mtus(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    const size_t caps[] = { kMinPayload, kMaxPayload };
+    for (size_t cap : caps) {
+        HistoryCursor cur;
+        Client client;
+        begin(cur, snap, kAllSensors);
+        TEST_ASSERT_TRUE(stream(snap, cur, cap, client));
+        expect_complete(snap, client, kAllSensors);
+        host_test_message("payload %u: %d frames", (unsigned)cap, client.frames);
+    }
+}
+
+void test_mask_skips_sensors(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    const uint8_t mask = (1u << 1) | (1u << 3) | (1u << 4);   // hum, mic (empty), soil
+    HistoryCursor cur;
+    Client client;
+    begin(cur, snap, mask);
+    TEST_ASSERT_TRUE(stream(snap, cur, kMaxPayload, client));
+    expect_complete(snap, client, mask);
+}
+
+void test_empty_selection_sends_only_the_end_frame(void) {
+    const HistorySnapshot snap = make_snapshot(9);
+    HistoryCursor cur;
+    Client client;
+    client.snapshot_id = 9;
+    begin(cur, snap, 1u << 3);                                  // mic has no samples
+    TEST_ASSERT_TRUE(stream(snap, cur, kMaxPayload, client));
+    TEST_ASSERT_EQUAL_INT(1, client.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, client.end_total);
+    uint8_t frame[kMaxPayload];
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, history_encode_next(snap, cur, frame, kMaxPayload), "nothing after the end");
+}
+
+void test_dropped_frames_are_resent(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    const int drops[] = { 2, 3, 5 };
+    for (int every : drops) {
+        HistoryCursor cur;
+        Client client;
+        begin(cur, snap, kAllSensors);
+        TEST_ASSERT_TRUE(stream(snap, cur, kMinPayload, client, every));
+        expect_complete(snap, client, kAllSensors);
+    }
+}
+
+void test_resume_with_current_snapshot(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    HistoryCursor cur;
+    Client client;
+    begin(cur, snap, kAllSensors);
+    uint8_t frame[kMaxPayload];
+    for (int i = 0; i < 20; ++i) {
+        const size_t len = history_encode_next(snap, cur, frame, kMinPayload);
+        TEST_ASSERT_TRUE(client.accept(frame, len));
+    }
+    TEST_ASSERT_FALSE(client.done);
+
+    // Reconnect: ask for the first sensor not yet complete at its next offset.
+    uint8_t sensor = 1;
+    while (client.next_offset[sensor - 1] == snap.count[sensor - 1]) ++sensor;
+    begin(cur, snap, kAllSensors, snap.id, sensor, client.next_offset[sensor - 1]);
+    TEST_ASSERT_TRUE(stream(snap, cur, kMaxPayload, client));
+    expect_complete(snap, client, kAllSensors);
+}
+
+void test_stale_snapshot_restarts(void) {
+    const HistorySnapshot snap = make_snapshot(8);
+    HistoryCursor cur;
+    begin(cur, snap, kAllSensors, 7, 3, 20);
+    TEST_ASSERT_EQUAL_UINT8(1, cur.sensor_id);
+    TEST_ASSERT_EQUAL_UINT16(0, cur.offset);
+    begin(cur, snap, kAllSensors, 0, 3, 20);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(1, cur.sensor_id, "id 0 always restarts");
+}
+
+void test_small_payload_leaves_the_cursor(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    HistoryCursor cur;
+    begin(cur, snap, kAllSensors);
+    const HistoryCursor before = cur;
+    uint8_t frame[kMaxPayload];
+    TEST_ASSERT_EQUAL_UINT32(0, history_encode_next(snap, cur, frame, HISTORY_DATA_HEADER_LEN + 1));
+    TEST_ASSERT_EQUAL_UINT8(before.sensor_id, cur.sensor_id);
+    TEST_ASSERT_EQUAL_UINT16(before.offset, cur.offset);
+    TEST_ASSERT_TRUE(cur.active);
+}
+
+void test_decoder_rejects_malformed_frames(void) {
+    const HistorySnapshot snap = make_snapshot(7);
+    HistoryCursor cur;
+    begin(cur, snap, kAllSensors);
+    uint8_t frame[kMaxPayload];
+    const size_t len = history_encode_next(snap, cur, frame, kMinPayload);
+    HistoryFrame f;
+    TEST_ASSERT_TRUE(history_decode_frame(frame, len, f));
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(frame, len - 1, f), "odd sample bytes");
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(frame, HISTORY_DATA_HEADER_LEN - 1, f), "short header");
+
+    uint8_t bad[kMaxPayload];
+    memcpy(bad, frame, len);
+    bad[1] = 0;
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(bad, len, f), "sensor id 0");
+    memcpy(bad, frame, len);
+    bad[6] = 2;
+    bad[7] = 0;                                                 // total 2, frame carries more
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(bad, len, f), "samples past total");
+
+    const uint8_t end[] = { HISTORY_FRAME_END, 7, 0, 10, 0, 0 };
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(end, sizeof(end), f), "end frame length");
+    TEST_ASSERT_TRUE(history_decode_frame(end, HISTORY_END_FRAME_LEN, f));
+    TEST_ASSERT_EQUAL_INT16(HISTORY_SAMPLE_INVALID, history_frame_sample(f, 0));
+}
+
+void test_log_full_stream_at_both_mtus(void) {
+    const std::vector<SleepLogSample> log = make_log(480);
+    const HistoryLogSnapshot snap = log_snapshot(log, 12);
+    const size_t caps[] = { kMinPayload, kMaxPayload };
+    for (size_t cap : caps) {
+        HistoryCursor cur;
+        LogClient client;
+        begin_log(cur, snap);
+        TEST_ASSERT_TRUE(stream_log(snap, cur, cap, client));
+        expect_log_complete(log, client);
+        host_test_message("log payload %u: %d frames", (unsigned)cap, client.frames);
+    }
+}
+
+void test_log_empty_sends_only_the_end_frame(void) {
+    const HistoryLogSnapshot snap = { 4, 0, nullptr };
+    HistoryCursor cur;
+    LogClient client;
+    client.snapshot_id = 4;
+    begin_log(cur, snap);
+    TEST_ASSERT_TRUE(stream_log(snap, cur, kMaxPayload, client));
+    TEST_ASSERT_EQUAL_INT(1, client.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, client.end_total);
+}
+
+void test_log_dropped_frames_and_resume(void) {
+    const std::vector<SleepLogSample> log = make_log(250);
+    const HistoryLogSnapshot snap = log_snapshot(log, 12);
+    HistoryCursor cur;
+    LogClient client;
+    begin_log(cur, snap);
+    TEST_ASSERT_TRUE(stream_log(snap, cur, kMinPayload, client, 3));
+    expect_log_complete(log, client);
+
+    // Reconnect part-way with the current id: resumes at the next record.
+    LogClient partial;
+    begin_log(cur, snap);
+    uint8_t frame[kMaxPayload];
+    for (int i = 0; i < 5; ++i) {
+        const size_t len = history_log_encode_next(snap, cur, frame, kMaxPayload);
+        TEST_ASSERT_TRUE(partial.accept(frame, len));
+    }
+    TEST_ASSERT_FALSE(partial.done);
+    begin_log(cur, snap, snap.id, (uint16_t)partial.records.size());
+    TEST_ASSERT_TRUE(stream_log(snap, cur, kMaxPayload, partial));
+    expect_log_complete(log, partial);
+
+    begin_log(cur, snap, 11, 100);
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, cur.offset, "stale id restarts");
+    begin_log(cur, snap, snap.id, 251);
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, cur.offset, "offset past the end restarts");
+}
+
+void test_log_frame_layout(void) {
+    SleepLogSample rec = {};
+    rec.t_s = 0x04030201;
+    rec.temp_x10 = -5;
+    rec.hum_x10 = 0x0605;
+    rec.ds18_x10 = INT16_MIN;
+    rec.ldr = 0x0807;
+    rec.soil = 0xFF;
+    rec.mic = 0x09;
+    const HistoryLogSnapshot snap = { 0x0102, 1, &rec };
+    HistoryCursor cur;
+    begin_log(cur, snap);
+    uint8_t frame[kMaxPayload];
+    const size_t len = history_log_encode_next(snap, cur, frame, kMinPayload);
+    TEST_ASSERT_TRUE_MESSAGE(HISTORY_LOG_HEADER_LEN + HISTORY_LOG_RECORD_LEN <= kMinPayload, "one record per default-MTU frame");
+    const uint8_t expected[] = { 0x11, 0x02, 0x01, 0x00, 0x00,
+                                 0x01, 0x02, 0x03, 0x04, 0xFB, 0xFF, 0x05, 0x06,
+                                 0x00, 0x80, 0x07, 0x08, 0xFF, 0x09 };
+    TEST_ASSERT_EQUAL_UINT32(sizeof(expected), len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, frame, sizeof(expected));
+
+    HistoryFrame f;
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(frame, len - 1, f), "partial record");
+    TEST_ASSERT_FALSE_MESSAGE(history_decode_frame(frame, HISTORY_LOG_HEADER_LEN - 1, f), "short header");
+    TEST_ASSERT_TRUE(history_decode_frame(frame, len, f));
+    SleepLogSample back;
+    TEST_ASSERT_FALSE(history_frame_log_record(f, 1, back));
+    TEST_ASSERT_EQUAL_INT16_MESSAGE(HISTORY_SAMPLE_INVALID, history_frame_sample(f, 0), "not a graph frame");
+    TEST_ASSERT_EQUAL_UINT32(0, history_log_encode_next(snap, cur, frame, HISTORY_END_FRAME_LEN - 1));
+    TEST_ASSERT_TRUE(cur.active);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_start_command_round_trip);
+    RUN_TEST(test_start_command_source);
+    RUN_TEST(test_quantize);
+    RUN_TEST(test_full_stream_at_both_mtus);
+    RUN_TEST(test_mask_skips_sensors);
+    RUN_TEST(test_empty_selection_sends_only_the_end_frame);
+    RUN_TEST(test_dropped_frames_are_resent);
+    RUN_TEST(test_resume_with_current_snapshot);
+    RUN_TEST(test_stale_snapshot_restarts);
+    RUN_TEST(test_small_payload_leaves_the_cursor);
+    RUN_TEST(test_decoder_rejects_malformed_frames);
+    RUN_TEST(test_log_full_stream_at_both_mtus);
+    RUN_TEST(test_log_empty_sends_only_the_end_frame);
+    RUN_TEST(test_log_dropped_frames_and_resume);
+    RUN_TEST(test_log_frame_layout);
+    return UNITY_END();
+}
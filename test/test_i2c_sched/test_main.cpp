@@ -0,0 +1,275 @@
+// I2C sensor scheduler and drivers (src/i2c_sched.cpp, src/i2c_drivers.cpp)
+// against simulated devices.
+//
+// The simulated SCD41 and BH1750 answer the datasheet command sets on a
+// virtual clock: the SCD41 refuses commands for 500 ms after a stop,
+// produces a sample every 5 s from its own (slightly slow) clock and
+// CRC-protects every word; the BH1750 needs 120 ms per one-shot conversion.
+// run_for() mimics I2cTask: step, then sleep for what the step returned
+// (at least one tick). Transfers are costed at 100 kHz.
+
+#include "host_test.h"
+#include "i2c_sched.h"
+#include "i2c_drivers.h"
+
+#include <math.h>
+
+namespace {
+
+struct SimClock {
+    uint32_t now_ms = 0;
+    uint32_t step_bus_us = 0;       // transfer time spent in the current step
+};
+
+SimClock g_clock;
+
+struct SimScd41 {
+    bool present = true;
+    bool periodic = false;
+    bool data_ready = false;
+    uint32_t busy_until_ms = 0;
+    uint32_t next_sample_ms = 0;
+    uint16_t pending = 0;
+    uint16_t co2 = 612;
+    float temp_c = 23.5f;
+    float humidity = 41.0f;
+    bool corrupt_next = false;
+    uint32_t polls = 0;
+    uint32_t samples_read = 0;
+    uint32_t busy_violations = 0;   // commands sent while still settling
+
+    void power_cycle() {
+        periodic = false;
+        data_ready = false;
+        pending = 0;
+    }
+
+    void update() {
+        while (periodic && (int32_t)(g_clock.now_ms - next_sample_ms) >= 0) {
+            data_ready = true;
+            next_sample_ms += 5010;     // 0.2 % slow against the host clock
+        }
+    }
+
+    I2cStatus write(const uint8_t* data, size_t len) {
+        if (!present || len != 2) return I2cStatus::Nack;
+        if ((int32_t)(g_clock.now_ms - busy_until_ms) < 0) {
+            busy_violations++;
+            return I2cStatus::Nack;
+        }
+        update();
+        const uint16_t cmd = (uint16_t)((data[0] << 8) | data[1]);
+        switch (cmd) {
+            case 0x3F86:
+                power_cycle();
+                busy_until_ms = g_clock.now_ms + 500;
+                return I2cStatus::Ok;
+            case 0x21B1:
+                if (periodic) return I2cStatus::Nack;
+                periodic = true;
+                next_sample_ms = g_clock.now_ms + 5000;
+                return I2cStatus::Ok;
+            case 0xE4B8:
+            case 0xEC05:
+                pending = cmd;
+                return I2cStatus::Ok;
+        }
+        return I2cStatus::Nack;
+    }
+
+    I2cStatus read(uint8_t* data, size_t len) {
+        if (!present) return I2cStatus::Nack;
+        update();
+        uint16_t words[3];
+        uint8_t count = 0;
+        if (pending == 0xE4B8) {
+            polls++;
+            words[count++] = data_ready ? 0x8006 : 0x8000;
+        } else if (pending == 0xEC05) {
+            samples_read++;
+            data_ready = false;
+            words[count++] = co2;
+            words[count++] = (uint16_t)lroundf((temp_c + 45.0f) * 65535.0f / 175.0f);
+            words[count++] = (uint16_t)lroundf(humidity * 65535.0f / 100.0f);
+        }
+        pending = 0;
+        if (len != (size_t)count * 3) return I2cStatus::Nack;
+        for (uint8_t w = 0; w < count; ++w) {
+            data[w * 3] = (uint8_t)(words[w] >> 8);
+            data[w * 3 + 1] = (uint8_t)words[w];
+            data[w * 3 + 2] = sensirion_crc8(data + w * 3, 2);
+        }
+        if (corrupt_next && count == 3) {
+            data[0] ^= 0x10;            // bit error on the wire: CO2 high byte
+            corrupt_next = false;
+        }
+        return I2cStatus::Ok;
+    }
+};
+
+struct SimBh1750 {
+    bool present = true;
+    bool measuring = false;
+    uint32_t ready_ms = 0;
+    float lux = 345.0f;
+    uint32_t early_reads = 0;       // reads before the conversion finished
+
+    I2cStatus write(const uint8_t* data, size_t len) {
+        if (!present || len != 1) return I2cStatus::Nack;
+        if (data[0] == 0x20) {
+            measuring = true;
+            ready_ms = g_clock.now_ms + 120;
+        }
+        return I2cStatus::Ok;
+    }
+
+    I2cStatus read(uint8_t* data, size_t len) {
+        if (!present || len != 2) return I2cStatus::Nack;
+        if (!measuring || (int32_t)(g_clock.now_ms - ready_ms) < 0) early_reads++;
+        const uint16_t raw = (uint16_t)lroundf(lux * 1.2f);
+        data[0] = (uint8_t)(raw >> 8);
+        data[1] = (uint8_t)raw;
+        measuring = false;
+        return I2cStatus::Ok;
+    }
+};
+
+SimScd41 g_scd41;
+SimBh1750 g_bh1750;
+
+uint32_t transfer_us(size_t len) { return (uint32_t)(len + 1) * 90; }   // 9 bits per byte at 100 kHz
+
+I2cStatus sim_write(void*, uint8_t addr, const uint8_t* data, size_t len) {
+    g_clock.step_bus_us += transfer_us(len);
+    if (addr == SCD41_I2C_ADDR) return g_scd41.write(data, len);
+    if (addr == BH1750_I2C_ADDR) return g_bh1750.write(data, len);
+    return I2cStatus::Nack;
+}
+
+I2cStatus sim_read(void*, uint8_t addr, uint8_t* data, size_t len) {
+    g_clock.step_bus_us += transfer_us(len);
+    if (addr == SCD41_I2C_ADDR) return g_scd41.read(data, len);
+    if (addr == BH1750_I2C_ADDR) return g_bh1750.read(data, len);
+    return I2cStatus::Nack;
+}
+
+void sim_wait_ms(void*, uint32_t ms) { g_clock.now_ms += ms + 1; }  // one extra tick, as on target
+
+const I2cBus kSimBus = { sim_write, sim_read, sim_wait_ms, nullptr };
+const I2cDriver* const kDrivers[] = { &I2C_DRIVER_SCD41, &I2C_DRIVER_BH1750 };
+
+uint32_t g_max_step_us = 0;
+uint32_t g_bad_co2 = 0;             // published CO2 values the simulated sensor never produced
+
+void run_for(I2cScheduler& s, uint32_t ms) {
+    const uint32_t end = g_clock.now_ms + ms;
+    while ((int32_t)(g_clock.now_ms - end) < 0) {
+        const uint32_t t0 = g_clock.now_ms;
+        g_clock.step_bus_us = 0;
+        const uint32_t wait_ms = i2c_sched_step(s, g_clock.now_ms);
+        const uint32_t step_us = (g_clock.now_ms - t0) * 1000 + g_clock.step_bus_us;
+        if (step_us > g_max_step_us) g_max_step_us = step_us;
+        const float co2 = s.channels[I2C_CH_CO2_PPM];
+        if (!isnan(co2) && co2 != 612.0f && co2 != 700.0f) g_bad_co2++;
+        g_clock.now_ms += wait_ms ? wait_ms : 1;
+    }
+}
+
+void start(I2cScheduler& s) {
+    i2c_sched_init(s, kSimBus, kDrivers, 2, g_clock.now_ms);
+}
+
+I2cScheduler g_sched;
+
+} // namespace
+
+void setUp(void) {
+    g_clock = SimClock();
+    g_scd41 = SimScd41();
+    g_bh1750 = SimBh1750();
+    g_max_step_us = 0;
+    g_bad_co2 = 0;
+}
+
+void tearDown(void) {}
+
+// Both sensors detected on a warm start (SCD41 still measuring) and run for 20 s.
+static void start_both() {
+    g_scd41.periodic = true;
+    g_scd41.next_sample_ms = 1234;
+    start(g_sched);
+    run_for(g_sched, 20000);
+}
+
+void test_boot_detects_only_connected_devices(void) {
+    g_scd41.present = false;
+    start(g_sched);
+    run_for(g_sched, 1500);
+    TEST_ASSERT_EQUAL_HEX8(0x02, i2c_sched_present_mask(g_sched));
+    TEST_ASSERT_TRUE_MESSAGE(isnan(g_sched.channels[I2C_CH_CO2_PPM]), "missing SCD41 publishes NaN");
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 345.0f, g_sched.channels[I2C_CH_LUX]);
+}
+
+void test_two_devices_share_the_bus(void) {
+    start_both();
+    TEST_ASSERT_EQUAL_HEX8(0x03, i2c_sched_present_mask(g_sched));
+    TEST_ASSERT_EQUAL_FLOAT(612.0f, g_sched.channels[I2C_CH_CO2_PPM]);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 23.5f, g_sched.channels[I2C_CH_CO2_TEMP_C]);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 41.0f, g_sched.channels[I2C_CH_CO2_HUMIDITY]);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 345.0f, g_sched.channels[I2C_CH_LUX]);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, g_scd41.busy_violations, "no command inside the SCD41 stop settle time");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, g_bh1750.early_reads, "no BH1750 read before its conversion ends");
+}
+
+void test_steady_state_cadence(void) {
+    start_both();
+    const uint32_t polls0 = g_scd41.polls;
+    const uint32_t samples0 = g_scd41.samples_read;
+    const uint32_t bh_samples0 = g_sched.devices[1].samples;
+    run_for(g_sched, 60000);
+    const uint32_t samples = g_scd41.samples_read - samples0;
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32_MESSAGE(11, samples, "SCD41 read every 5 s");
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(2 * samples, g_scd41.polls - polls0,
+                                             "at most two ready polls per SCD41 sample");
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32_MESSAGE(55, g_sched.devices[1].samples - bh_samples0,
+                                                "BH1750 read about once a second");
+    host_test_message("longest bus turn: %u us", (unsigned)g_max_step_us);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(4000, g_max_step_us, "one bus turn stays under 4 ms");
+}
+
+void test_crc_error_is_not_published(void) {
+    start_both();
+    g_scd41.co2 = 700;
+    g_scd41.corrupt_next = true;
+    run_for(g_sched, 11000);              // the corrupted sample plus at least one clean one
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, g_bad_co2, "a CRC error never reaches the published value");
+    TEST_ASSERT_EQUAL_FLOAT(700.0f, g_sched.channels[I2C_CH_CO2_PPM]);
+    TEST_ASSERT_EQUAL_HEX8(0x03, i2c_sched_present_mask(g_sched));
+}
+
+void test_unplug_and_replug(void) {
+    start_both();
+    g_scd41.present = false;
+    run_for(g_sched, 7000);
+    TEST_ASSERT_EQUAL_HEX8(0x02, i2c_sched_present_mask(g_sched));
+    TEST_ASSERT_TRUE_MESSAGE(isnan(g_sched.channels[I2C_CH_CO2_PPM]), "unplugged SCD41 dropped to NaN");
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 345.0f, g_sched.channels[I2C_CH_LUX]);
+
+    g_scd41.power_cycle();
+    g_scd41.present = true;
+    run_for(g_sched, I2C_SCHED_REPROBE_MS + 6000);
+    TEST_ASSERT_EQUAL_HEX8(0x03, i2c_sched_present_mask(g_sched));
+    TEST_ASSERT_EQUAL_FLOAT(612.0f, g_sched.channels[I2C_CH_CO2_PPM]);
+    TEST_ASSERT_EQUAL_UINT32(0, g_scd41.busy_violations);
+    TEST_ASSERT_EQUAL_UINT32(0, g_bh1750.early_reads);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_detects_only_connected_devices);
+    RUN_TEST(test_two_devices_share_the_bus);
+    RUN_TEST(test_steady_state_cadence);
+    RUN_TEST(test_crc_error_is_not_published);
+    RUN_TEST(test_unplug_and_replug);
+    return UNITY_END();
+}
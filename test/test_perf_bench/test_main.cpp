@@ -0,0 +1,170 @@
+// Host side of the hot-kernel benchmark (include/perf_probe.h is the
+// target side).
+//
+// Runs the kernels that build without Arduino through the same ns/op,
+// worst-case and allocations/op accounting the probes use, asserts that
+// none of them allocates, and prints one {"perf":...} line that
+// tools/perf_diff.py compares against tools/perf_baseline_host.json.
+// "max_ns" here is the slowest batch of kBatch calls, not a single call:
+// a clock read per call would cost more than most of these kernels.
+//
+// render_graph, the glyph paths and the LDR conversion need the display or
+// the ADC calibration and are only measured on the target.
+
+#include "host_test.h"
+#include "host_alloc_count.h"
+#include "alert_filter.h"
+#include "ble_payload.h"
+#include "color565.h"
+#include "graph_buffer.h"
+
+#include <math.h>
+#include <stdio.h>
+
+namespace {
+
+constexpr uint32_t kBatch = 1000;
+constexpr uint32_t kBatches = 200;
+constexpr size_t kMaxResults = 8;
+constexpr size_t kReadingCount = 256;
+
+struct BenchResult {
+    const char* id;
+    uint32_t n;
+    double ns_op;
+    double max_ns;
+    double allocs_op;
+};
+
+BenchResult g_results[kMaxResults];
+size_t g_result_count = 0;
+
+Reading g_readings[kReadingCount];
+volatile uint32_t g_sink = 0;
+
+void bench(const char* id, void (*fn)(uint32_t i)) {
+    double total_ns = 0.0;
+    double max_ns = 0.0;
+    const uint32_t allocs = host_count_allocs([&] {
+        for (uint32_t b = 0; b < kBatches; ++b) {
+            const double ns = host_bench_ns(kBatch, [&](uint32_t i) { fn(b * kBatch + i); });
+            total_ns += ns;
+            if (ns > max_ns) max_ns = ns;
+        }
+    });
+    const uint32_t n = kBatch * kBatches;
+    if (g_result_count < kMaxResults) {
+        g_results[g_result_count++] = { id, n, total_ns / kBatches, max_ns, (double)allocs / n };
+    }
+    host_test_message("%-14s %8.1f ns/op  worst batch %8.1f  allocs/op %.2f", id, total_ns / kBatches, max_ns,
+                      (double)allocs / n);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, allocs, id);
+}
+
+// Same shape as a day of sensor task output: slow drifts, NaN dropouts,
+// and the DS18B20 coming and going.
+void fill_readings() {
+    for (size_t i = 0; i < kReadingCount; ++i) {
+        Reading& r = g_readings[i];
+        const float t = (float)i / (float)kReadingCount;
+        r.temperature = (i % 37 == 0) ? NAN : 18.0f + 8.0f * sinf(t * 6.28f);
+        r.humidity = (i % 41 == 0) ? NAN : 55.0f + 20.0f * cosf(t * 6.28f);
+        r.ldr = 20000.0f * t * t;
+        r.ldr_raw = 4095.0f * t;
+        r.mic = (float)(i * 13 % 101);
+        r.soil_humidity = 80.0f - 60.0f * t;
+        r.temp_ds18b20 = (i % 64 < 8) ? -999.0f : -5.0f + 40.0f * t;
+        r.co2_ppm = NAN;
+        r.co2_temperature = NAN;
+        r.co2_humidity = NAN;
+        r.lux_i2c = NAN;
+    }
+}
+
+GraphBuffer g_graph = {{}, 0, 0};
+float g_graph_out[GRAPH_BUFFER_SIZE];
+uint8_t g_pkt[DATA_PACKET_LEN];
+char g_json[JSON_PACKET_MAX_LEN];
+
+// Thresholds in the range of the settings defaults.
+AlertInput alert_input(AlertSensor sensor, const Reading& r) {
+    switch (sensor) {
+        case AlertSensor::Temp:     return { r.temperature, isnan(r.temperature), true, 10, 0, 30 };
+        case AlertSensor::Humidity: return { r.humidity, isnan(r.humidity), true, 30, 0, 60 };
+        case AlertSensor::Light:    return { r.ldr, false, true, 50, 0, 10000 };
+        case AlertSensor::Sound:    return { r.mic, false, true, 60, 0, 85 };
+        case AlertSensor::Soil:     return { r.soil_humidity, isnan(r.soil_humidity), true, 20, 55, 80 };
+        default:                    return { r.temp_ds18b20, r.temp_ds18b20 < -100.0f, true, 10, 0, 30 };
+    }
+}
+
+uint8_t g_alert_codes[(size_t)AlertSensor::Count];
+AlertFilterState g_alert_state[(size_t)AlertSensor::Count];
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_graph_push(void) {
+    bench("graph_push", [](uint32_t i) { graph_buffer_push(g_graph, (float)(i & 1023)); });
+}
+
+void test_graph_get(void) {
+    bench("graph_get", [](uint32_t) { g_sink = g_sink + graph_buffer_get(g_graph, g_graph_out, GRAPH_BUFFER_SIZE); });
+}
+
+void test_ble_pkt(void) {
+    bench("ble_pkt", [](uint32_t i) { g_sink = g_sink + assm_pkt(g_readings[i % kReadingCount], g_pkt); });
+}
+
+void test_ble_json(void) {
+    bench("ble_json", [](uint32_t i) {
+        g_sink = g_sink + makeJson(g_readings[i % kReadingCount], g_json, sizeof(g_json));
+    });
+}
+
+void test_alert_filter(void) {
+    // One call covers the six sensors, like one alert_engine_refresh_from_reading().
+    bench("alert_filter", [](uint32_t i) {
+        const Reading& r = g_readings[(i / 16) % kReadingCount];
+        for (size_t s = 0; s < (size_t)AlertSensor::Count; ++s) {
+            const AlertSensor sensor = (AlertSensor)s;
+            g_alert_codes[s] = alert_filter_code(sensor, alert_input(sensor, r), g_alert_codes[s], g_alert_state[s],
+                                                 i * 100);
+        }
+    });
+}
+
+void test_mix565(void) {
+    bench("mix565", [](uint32_t i) { g_sink = g_sink + mix565(0xF81F, 0xFFE0, (uint8_t)i); });
+}
+
+void test_blend565(void) {
+    bench("blend565", [](uint32_t i) { g_sink = g_sink + blend565((uint16_t)(i * 2654435761u), 0x0861); });
+}
+
+void test_report(void) {
+    printf("{\"perf\":{\"host\":true,\"probes\":[");
+    for (size_t i = 0; i < g_result_count; ++i) {
+        const BenchResult& r = g_results[i];
+        printf("%s{\"id\":\"%s\",\"n\":%lu,\"ns_op\":%.1f,\"max_ns\":%.1f,\"allocs_op\":%.2f}", i == 0 ? "" : ",",
+               r.id, (unsigned long)r.n, r.ns_op, r.max_ns, r.allocs_op);
+    }
+    printf("]}}\n");
+    fflush(stdout);
+}
+
+int main(int, char**) {
+    fill_readings();
+    UNITY_BEGIN();
+    RUN_TEST(test_graph_push);
+    RUN_TEST(test_graph_get);
+    RUN_TEST(test_ble_pkt);
+    RUN_TEST(test_ble_json);
+    RUN_TEST(test_alert_filter);
+    RUN_TEST(test_mix565);
+    RUN_TEST(test_blend565);
+    RUN_TEST(test_report);
+    return UNITY_END();
+}
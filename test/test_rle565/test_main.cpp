@@ -0,0 +1,89 @@
+// RLE565 reader (src/rle565.cpp) against the raw logo arrays.
+//
+// Both generated headers in include/ are decoded in strips of several sizes,
+// including the firmware's four rows, single pixels and sizes that split runs
+// and literals, and compared pixel by pixel with the arrays in assets/ they
+// were made from. A stale or hand-edited header fails here.
+
+#include "host_test.h"
+#include "rle565.h"
+
+#include "img_logo_cuadrado_rle.h"
+#include "img_POWAR_logo_WEB_rle.h"
+#include "../../assets/img_logo_cuadrado.h"
+#include "../../assets/img_POWAR_logo_WEB.h"
+
+#include <vector>
+
+namespace {
+
+const size_t kStripPixels[] = { 1, 7, 127, 128, 129, 160, 333, 160 * 4, 160 * 128 };
+
+// Decodes the whole image in strips of `strip` pixels and returns the first
+// mismatching pixel index, or -1 when the image matches.
+long first_mismatch(const Rle565Image& image, const uint16_t* raw, size_t strip) {
+    const size_t total = (size_t)image.width * image.height;
+    std::vector<uint16_t> buf(strip);
+    Rle565Reader reader(image);
+    size_t done = 0;
+    while (done < total) {
+        const size_t want = (total - done) < strip ? (total - done) : strip;
+        const size_t got = reader.read(buf.data(), want);
+        for (size_t i = 0; i < got; ++i) {
+            if (buf[i] != raw[done + i]) return (long)(done + i);
+        }
+        done += got;
+        if (got < want) return (long)done;          // stream ended early
+    }
+    return reader.read(buf.data(), 1) == 0 ? -1 : (long)total;   // nothing past the last pixel
+}
+
+void expect_image(const char* name, const Rle565Image& image, const uint16_t* raw, size_t raw_len) {
+    TEST_ASSERT_EQUAL_UINT32((size_t)image.width * image.height, raw_len);
+    for (size_t strip : kStripPixels) {
+        const long bad = first_mismatch(image, raw, strip);
+        if (bad >= 0) {
+            host_test_message("%s, strip %u: mismatch at pixel %ld (x %ld, y %ld)", name, (unsigned)strip, bad,
+                              bad % image.width, bad / image.width);
+            TEST_FAIL_MESSAGE("decoded image differs from assets/");
+        }
+    }
+    host_test_message("%s: %u colours, %u bytes for %u raw", name, (unsigned)image.palette_count,
+                      (unsigned)image.data_len, (unsigned)(raw_len * 2));
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_logo_cuadrado(void) {
+    expect_image("logo_cuadrado", PBIT_TFT_160x128_2_RLE, PBIT_TFT_160x128_2,
+                 sizeof(PBIT_TFT_160x128_2) / sizeof(PBIT_TFT_160x128_2[0]));
+}
+
+void test_powar_logo(void) {
+    expect_image("POWAR_logo_WEB", POWAR_logo_WEB_RLE, POWAR_logo_WEB,
+                 sizeof(POWAR_logo_WEB) / sizeof(POWAR_logo_WEB[0]));
+}
+
+void test_truncated_stream_stops_cleanly(void) {
+    Rle565Image cut = POWAR_logo_WEB_RLE;
+    uint16_t buf[64];
+    for (uint32_t len = 0; len < 40; ++len) {
+        cut.data_len = len;
+        Rle565Reader reader(cut);
+        size_t total = 0;
+        size_t got;
+        while ((got = reader.read(buf, 64)) > 0) total += got;
+        TEST_ASSERT_LESS_OR_EQUAL((size_t)cut.width * cut.height, total);
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_logo_cuadrado);
+    RUN_TEST(test_powar_logo);
+    RUN_TEST(test_truncated_stream_stops_cleanly);
+    return UNITY_END();
+}
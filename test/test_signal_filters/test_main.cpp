@@ -0,0 +1,149 @@
+// Step responses and per-sample cost of include/signal_filters.h.
+//
+// Each filter gets a 0 -> 100 step (plus a spike or dropout where that is
+// the point of the stage) and the result is checked against the expected
+// shape. test_cost_report() logs ns/sample per stage on the host.
+
+#include "host_test.h"
+#include "signal_filters.h"
+
+#include <stdlib.h>
+
+namespace {
+
+// Samples until the output first reaches `level` after a 0 -> 100 step.
+template <typename F>
+int settle_steps(F& f, float level) {
+    for (int i = 0; i < 20; ++i) f.update(0.0f);
+    for (int i = 1; i <= 200; ++i) {
+        if (f.update(100.0f) >= level) return i;
+    }
+    return -1;
+}
+
+template <typename F>
+void report_cost(const char* name, F f) {
+    volatile float sink = 0.0f;
+    const double ns = host_bench_ns(1000000, [&](uint32_t i) {
+        sink = f.update((i % 97 == 0) ? 250.0f : (float)(i % 13));
+    });
+    (void)sink;
+    host_test_message("%-24s %6.1f ns/sample", name, ns);
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_median(void) {
+    MedianFilter<float, 5> f;
+    for (int i = 0; i < 5; ++i) f.update(10.0f);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(10.0f, f.update(500.0f), "single spike removed");
+    f.reset();
+    TEST_ASSERT_EQUAL_INT_MESSAGE(3, settle_steps(f, 100.0f), "step passes after N/2 + 1 samples");
+    TEST_ASSERT_TRUE_MESSAGE(isnan(f.update(NAN)), "NaN passes through");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(100.0f, f.update(100.0f), "NaN leaves the window untouched");
+}
+
+void test_ema(void) {
+    EmaFilter f(0.3f);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(42.0f, f.update(42.0f), "first sample primes the output");
+    f.reset();
+    // 1 - 0.7^9 = 0.96
+    TEST_ASSERT_EQUAL_INT_MESSAGE(9, settle_steps(f, 95.0f), "reaches 95% of a step in 9 samples");
+    f.reset();
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(7.0f, f.update(7.0f), "reset() re-primes");
+}
+
+void test_ema_fixed(void) {
+    EmaFilterFixed f(102);
+    EmaFilter ref(102.0f / 256.0f);
+    for (int i = 0; i < 50; ++i) {
+        const int32_t x = (i < 10) ? 0 : (i < 30 ? 100 : 37);
+        const float y = ref.update((float)x);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(1, abs(f.update(x) - (int32_t)y), "within one count of the float EMA");
+    }
+    for (int i = 0; i < 400; ++i) f.update(3);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(3, f.update(3), "settles on small values despite truncation");
+}
+
+void test_hampel(void) {
+    HampelFilter<7> f(3.0f);
+    const float noise[] = { 50.0f, 50.4f, 49.8f, 50.1f, 49.7f, 50.3f, 50.0f };
+    for (float x : noise) f.update(x);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(50.2f, f.update(50.2f), "clean sample passes unchanged");
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.3f, 50.1f, f.update(90.0f), "outlier replaced by the median");
+    f.reset();
+    for (int i = 0; i < 7; ++i) f.update((float)i * 0.5f);
+    int n = 0;
+    float y = 0.0f;
+    while (n < 20 && y < 100.0f) {
+        y = f.update(100.0f);
+        ++n;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(4, n, "a real step gets through within N/2 + 1 samples");
+}
+
+void test_kalman(void) {
+    Kalman1D f(0.01f, 1.0f);
+    float y = 0.0f;
+    for (int i = 0; i < 200; ++i) y = f.update((i & 1) ? 21.0f : 19.0f);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.3f, 20.0f, y, "averages alternating noise");
+    const int n = settle_steps(f, 63.0f);
+    TEST_ASSERT_TRUE_MESSAGE(n > 3 && n < 40, "steps with a slow but bounded time constant");
+}
+
+void test_deadband(void) {
+    Deadband<float> f(0.5f);
+    f.update(20.0f);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(20.0f, f.update(20.4f), "holds inside the band (up)");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(20.0f, f.update(19.6f), "holds inside the band (down)");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(20.6f, f.update(20.6f), "follows once outside the band");
+    Deadband<int32_t> fi(2);
+    fi.update(10);
+    TEST_ASSERT_EQUAL_INT32(10, fi.update(12));
+    TEST_ASSERT_EQUAL_INT32(13, fi.update(13));
+}
+
+void test_dropout(void) {
+    DropoutHold f(1);
+    TEST_ASSERT_TRUE_MESSAGE(isnan(f.update(NAN)), "nothing to hold before the first sample");
+    f.update(55.0f);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(55.0f, f.update(NAN), "first dropout repeats the last value");
+    TEST_ASSERT_TRUE_MESSAGE(isnan(f.update(NAN)), "second dropout reports NaN");
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(56.0f, f.update(56.0f), "recovers on the next good sample");
+}
+
+void test_chain(void) {
+    FilterChain<HampelFilter<5>, EmaFilter, Deadband<float>> f(HampelFilter<5>(3.0f), EmaFilter(0.5f),
+                                                               Deadband<float>(0.2f));
+    for (int i = 0; i < 10; ++i) f.update(10.0f);
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(10.0f, f.update(80.0f), "spike stopped by the first stage");
+    f.reset();
+    TEST_ASSERT_EQUAL_FLOAT_MESSAGE(33.0f, f.update(33.0f), "reset() reaches every stage");
+}
+
+void test_cost_report(void) {
+    report_cost("MedianFilter<float, 5>", MedianFilter<float, 5>());
+    report_cost("EmaFilter", EmaFilter(0.3f));
+    report_cost("EmaFilterFixed", EmaFilterFixed(102));
+    report_cost("HampelFilter<7>", HampelFilter<7>(3.0f));
+    report_cost("Kalman1D", Kalman1D(0.01f, 1.0f));
+    report_cost("Deadband<float>", Deadband<float>(0.5f));
+    report_cost("DropoutHold", DropoutHold(1));
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_median);
+    RUN_TEST(test_ema);
+    RUN_TEST(test_ema_fixed);
+    RUN_TEST(test_hampel);
+    RUN_TEST(test_kalman);
+    RUN_TEST(test_deadband);
+    RUN_TEST(test_dropout);
+    RUN_TEST(test_chain);
+    RUN_TEST(test_cost_report);
+    return UNITY_END();
+}
@@ -0,0 +1,229 @@
+// v3 BLE telemetry frame (src/telemetry_frame.cpp), shared by the firmware
+// and host decoders.
+//
+// A slowly drifting trace is encoded and decoded frame by frame; the other
+// tests cover key frame cadence, lost frames, missing sensors, the payload
+// bound ble.cpp checks before accepting the 0x03 command, and malformed input.
+
+#include "host_test.h"
+#include "telemetry_frame.h"
+
+#include <string.h>
+
+namespace {
+
+TelemetrySample make_sample(uint32_t i) {
+    TelemetrySample s = {};
+    s.timestamp_ms = 1000 + i * 1000;
+    s.temp_x10 = 231 + (int32_t)(i % 5) - 2;
+    s.hum_x10 = 455 + (int32_t)(i / 10);
+    s.ldr_lux = 320 + (int32_t)((i * 37) % 200);
+    s.mic = (int32_t)(i % 3);
+    s.soil = 41;
+    s.ldr_raw = 2100 - (int32_t)(i % 7);
+    s.alert_codes = (i > 20) ? 0x09 : 0;
+    s.ds18_count = (i < 30) ? 2 : 1;
+    s.ds18_x10[0] = 188 + (int32_t)(i % 2);
+    s.ds18_x10[1] = 190;
+    return s;
+}
+
+void expect_equal(const TelemetrySample& e, const TelemetrySample& a) {
+    TEST_ASSERT_EQUAL_UINT32(e.timestamp_ms, a.timestamp_ms);
+    TEST_ASSERT_EQUAL_INT32(e.temp_x10, a.temp_x10);
+    TEST_ASSERT_EQUAL_INT32(e.hum_x10, a.hum_x10);
+    TEST_ASSERT_EQUAL_INT32(e.ldr_lux, a.ldr_lux);
+    TEST_ASSERT_EQUAL_INT32(e.mic, a.mic);
+    TEST_ASSERT_EQUAL_INT32(e.soil, a.soil);
+    TEST_ASSERT_EQUAL_INT32(e.ldr_raw, a.ldr_raw);
+    TEST_ASSERT_EQUAL_UINT32(e.alert_codes, a.alert_codes);
+    TEST_ASSERT_EQUAL_UINT8(e.ds18_count, a.ds18_count);
+    for (uint8_t k = 0; k < e.ds18_count; ++k) TEST_ASSERT_EQUAL_INT32(e.ds18_x10[k], a.ds18_x10[k]);
+}
+
+bool is_key(const uint8_t* frame) { return (frame[0] & TELEMETRY_FLAG_KEY) != 0; }
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_trace_round_trip(void) {
+    TelemetryEncoder enc;
+    TelemetryDecoder dec;
+    telemetry_encoder_reset(enc);
+    telemetry_decoder_reset(dec);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    size_t key_bytes = 0;
+    size_t delta_bytes = 0;
+    uint32_t deltas = 0;
+    for (uint32_t i = 0; i < 100; ++i) {
+        const TelemetrySample s = make_sample(i);
+        const size_t len = telemetry_encode(enc, s, false, frame, sizeof(frame));
+        TEST_ASSERT_TRUE(len > 0);
+        TelemetrySample out;
+        const TelemetryDecodeResult r = telemetry_decode(dec, frame, len, out);
+        TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok, (int)r.status);
+        expect_equal(s, out);
+        if (is_key(frame)) {
+            key_bytes = len;
+        } else {
+            delta_bytes += len;
+            ++deltas;
+        }
+    }
+    host_test_message("key frame %u bytes, delta frames %.1f bytes avg", (unsigned)key_bytes,
+                      (double)delta_bytes / deltas);
+    TEST_ASSERT_TRUE_MESSAGE(delta_bytes / deltas < 20, "deltas beat the 20-byte v2 packet");
+}
+
+void test_key_frame_cadence(void) {
+    TelemetryEncoder enc;
+    telemetry_encoder_reset(enc);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    for (uint32_t i = 0; i < 2 * TELEMETRY_KEYFRAME_INTERVAL + 1; ++i) {
+        telemetry_encode(enc, make_sample(i), false, frame, sizeof(frame));
+        const bool expected = (i % TELEMETRY_KEYFRAME_INTERVAL) == 0;
+        if (expected != is_key(frame)) {
+            host_test_message("frame %u", (unsigned)i);
+            TEST_FAIL_MESSAGE("key frame every TELEMETRY_KEYFRAME_INTERVAL frames");
+        }
+    }
+    telemetry_encode(enc, make_sample(99), true, frame, sizeof(frame));
+    TEST_ASSERT_TRUE_MESSAGE(is_key(frame), "force_key");
+}
+
+void test_lost_frame_needs_key(void) {
+    TelemetryEncoder enc;
+    TelemetryDecoder dec;
+    telemetry_encoder_reset(enc);
+    telemetry_decoder_reset(dec);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    TelemetrySample out;
+
+    size_t len = telemetry_encode(enc, make_sample(0), false, frame, sizeof(frame));
+    telemetry_decode(dec, frame, len, out);
+    telemetry_encode(enc, make_sample(1), false, frame, sizeof(frame));   // lost
+    len = telemetry_encode(enc, make_sample(2), false, frame, sizeof(frame));
+    TelemetryDecodeResult r = telemetry_decode(dec, frame, len, out);
+    TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::NeedKeyFrame, (int)r.status);
+    TEST_ASSERT_EQUAL_UINT8(1, r.lost);
+
+    len = telemetry_encode(enc, make_sample(3), false, frame, sizeof(frame));
+    r = telemetry_decode(dec, frame, len, out);
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int)TelemetryDecodeStatus::NeedKeyFrame, (int)r.status, "deltas ignored until a key");
+
+    len = telemetry_encode(enc, make_sample(4), true, frame, sizeof(frame));
+    r = telemetry_decode(dec, frame, len, out);
+    TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok, (int)r.status);
+    expect_equal(make_sample(4), out);
+}
+
+void test_sequence_wraps(void) {
+    TelemetryEncoder enc;
+    TelemetryDecoder dec;
+    telemetry_encoder_reset(enc);
+    telemetry_decoder_reset(dec);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    TelemetrySample out;
+    for (uint32_t i = 0; i < 300; ++i) {
+        const size_t len = telemetry_encode(enc, make_sample(i), false, frame, sizeof(frame));
+        TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok, (int)telemetry_decode(dec, frame, len, out).status);
+    }
+}
+
+void test_missing_sensors_round_trip(void) {
+    TelemetryEncoder enc;
+    TelemetryDecoder dec;
+    telemetry_encoder_reset(enc);
+    telemetry_decoder_reset(dec);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    TelemetrySample out;
+
+    TelemetrySample s = make_sample(0);
+    size_t len = telemetry_encode(enc, s, false, frame, sizeof(frame));
+    telemetry_decode(dec, frame, len, out);
+
+    s = make_sample(1);
+    s.temp_x10 = TELEMETRY_INVALID;   // DHT unplugged
+    s.ds18_count = 0;
+    len = telemetry_encode(enc, s, false, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok, (int)telemetry_decode(dec, frame, len, out).status);
+    expect_equal(s, out);
+
+    s = make_sample(2);               // and back
+    len = telemetry_encode(enc, s, false, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok, (int)telemetry_decode(dec, frame, len, out).status);
+    expect_equal(s, out);
+}
+
+// ble.cpp accepts 0x03 only when the payload holds TELEMETRY_FRAME_MAX_LEN,
+// so the longest key frame must fit in exactly that.
+void test_worst_case_fits_the_bound(void) {
+    TelemetrySample s = {};
+    s.timestamp_ms = UINT32_MAX;
+    s.temp_x10 = TELEMETRY_INVALID;
+    s.hum_x10 = TELEMETRY_INVALID;
+    s.ldr_lux = TELEMETRY_INVALID;
+    s.mic = TELEMETRY_INVALID;
+    s.soil = TELEMETRY_INVALID;
+    s.ldr_raw = TELEMETRY_INVALID;
+    s.alert_codes = UINT32_MAX;
+    s.ds18_count = TELEMETRY_MAX_DS18;
+    for (uint8_t k = 0; k < TELEMETRY_MAX_DS18; ++k) s.ds18_x10[k] = TELEMETRY_INVALID;
+
+    TelemetryEncoder enc;
+    telemetry_encoder_reset(enc);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    TEST_ASSERT_EQUAL_UINT32(TELEMETRY_FRAME_MAX_LEN, telemetry_encode(enc, s, true, frame, sizeof(frame)));
+
+    TelemetryDecoder dec;
+    telemetry_decoder_reset(dec);
+    TelemetrySample out;
+    TEST_ASSERT_EQUAL_INT((int)TelemetryDecodeStatus::Ok,
+                          (int)telemetry_decode(dec, frame, TELEMETRY_FRAME_MAX_LEN, out).status);
+    expect_equal(s, out);
+}
+
+void test_short_buffer_leaves_the_encoder(void) {
+    TelemetryEncoder enc;
+    telemetry_encoder_reset(enc);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN];
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, telemetry_encode(enc, make_sample(0), false, frame, 20),
+                                     "a key frame does not fit the default 20-byte payload");
+    TEST_ASSERT_FALSE(enc.has_prev);
+    TEST_ASSERT_EQUAL_UINT8(0, enc.seq);
+}
+
+void test_malformed_frames(void) {
+    TelemetryEncoder enc;
+    telemetry_encoder_reset(enc);
+    uint8_t frame[TELEMETRY_FRAME_MAX_LEN + 1];
+    const size_t len = telemetry_encode(enc, make_sample(0), false, frame, TELEMETRY_FRAME_MAX_LEN);
+
+    TelemetryDecoder dec;
+    TelemetrySample out;
+    telemetry_decoder_reset(dec);
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int)TelemetryDecodeStatus::BadFrame,
+                                  (int)telemetry_decode(dec, frame, len - 1, out).status, "truncated");
+    frame[len] = 0;
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int)TelemetryDecodeStatus::BadFrame,
+                                  (int)telemetry_decode(dec, frame, len + 1, out).status, "trailing byte");
+    const uint8_t legacy[20] = { 0x02, 0x00 };
+    TEST_ASSERT_EQUAL_INT_MESSAGE((int)TelemetryDecodeStatus::BadFrame,
+                                  (int)telemetry_decode(dec, legacy, sizeof(legacy), out).status, "v2 packet");
+    TEST_ASSERT_FALSE(dec.synced);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_trace_round_trip);
+    RUN_TEST(test_key_frame_cadence);
+    RUN_TEST(test_lost_frame_needs_key);
+    RUN_TEST(test_sequence_wraps);
+    RUN_TEST(test_missing_sensors_round_trip);
+    RUN_TEST(test_worst_case_fits_the_bound);
+    RUN_TEST(test_short_buffer_leaves_the_encoder);
+    RUN_TEST(test_malformed_frames);
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+// Reference model of the ULP threshold monitor (src/ulp_monitor_model.cpp).
+//
+// The classifiers are step functions shaped like the alert classes (a dim /
+// normal / bright band for the LDR, dry / ok / wet for soil), so the
+// boundary derivation and the zone logic can be checked exhaustively over
+// the 12-bit range without the alert engine.
+
+#include "host_test.h"
+#include "ulp_monitor_model.h"
+
+namespace {
+
+// LDR raw rises in the dark: bright below 900, normal, dim from 3200.
+uint8_t classify_ldr(uint16_t raw, const void*) {
+    if (raw < 900) return 2;
+    return raw < 3200 ? 0 : 1;
+}
+
+// Soil raw rises when dry: wet below 1500, ok, dry from 2800.
+uint8_t classify_soil(uint16_t raw, const void*) {
+    if (raw < 1500) return 4;
+    return raw < 2800 ? 0 : 3;
+}
+
+uint8_t classify_constant(uint16_t, const void*) { return 0; }
+
+// Six class changes: more than the ULP has room for.
+uint8_t classify_stairs(uint16_t raw, const void*) { return (uint8_t)(raw / 600); }
+
+UlpMonState armed_state(uint16_t capacity, uint16_t confirm, uint16_t ldr_raw, uint16_t soil_raw) {
+    UlpMonState s = {};
+    ulp_mon_derive_boundaries(classify_ldr, nullptr, s.boundary[ULP_MON_CH_LDR]);
+    ulp_mon_derive_boundaries(classify_soil, nullptr, s.boundary[ULP_MON_CH_SOIL]);
+    s.capacity = capacity;
+    s.confirm = confirm;
+    ulp_mon_arm(s, ldr_raw, soil_raw);
+    return s;
+}
+
+} // namespace
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_boundaries_are_the_class_changes(void) {
+    uint16_t b[ULP_MON_MAX_BOUNDARIES];
+    TEST_ASSERT_EQUAL_UINT8(2, ulp_mon_derive_boundaries(classify_ldr, nullptr, b));
+    TEST_ASSERT_EQUAL_UINT16(900, b[0]);
+    TEST_ASSERT_EQUAL_UINT16(3200, b[1]);
+    TEST_ASSERT_EQUAL_UINT16(ULP_MON_NO_BOUNDARY, b[2]);
+    TEST_ASSERT_EQUAL_UINT16(ULP_MON_NO_BOUNDARY, b[3]);
+}
+
+void test_constant_class_has_no_boundaries(void) {
+    uint16_t b[ULP_MON_MAX_BOUNDARIES];
+    TEST_ASSERT_EQUAL_UINT8(0, ulp_mon_derive_boundaries(classify_constant, nullptr, b));
+    for (uint8_t i = 0; i < ULP_MON_MAX_BOUNDARIES; ++i) TEST_ASSERT_EQUAL_UINT16(ULP_MON_NO_BOUNDARY, b[i]);
+    TEST_ASSERT_EQUAL_UINT16(0, ulp_mon_zone(ULP_MON_ADC_MAX, b));
+}
+
+void test_extra_changes_are_counted_but_not_kept(void) {
+    uint16_t b[ULP_MON_MAX_BOUNDARIES];
+    TEST_ASSERT_EQUAL_UINT8(6, ulp_mon_derive_boundaries(classify_stairs, nullptr, b));
+    TEST_ASSERT_EQUAL_UINT16(600, b[0]);
+    TEST_ASSERT_EQUAL_UINT16(2400, b[3]);
+}
+
+// Over the whole ADC range, the zone changes exactly where the class does.
+void test_zone_change_matches_class_change(void) {
+    uint16_t b[ULP_MON_MAX_BOUNDARIES];
+    ulp_mon_derive_boundaries(classify_soil, nullptr, b);
+    for (uint16_t raw = 1; raw <= ULP_MON_ADC_MAX; ++raw) {
+        const bool class_changed = classify_soil(raw, nullptr) != classify_soil(raw - 1, nullptr);
+        const bool zone_changed = ulp_mon_zone(raw, b) != ulp_mon_zone(raw - 1, b);
+        if (class_changed != zone_changed) {
+            host_test_message("mismatch at raw %u", (unsigned)raw);
+            TEST_FAIL_MESSAGE("zone and class disagree");
+        }
+    }
+}
+
+void test_single_excursion_does_not_wake(void) {
+    UlpMonState s = armed_state(60, 2, 2000, 2000);
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_NONE, ulp_mon_step(s, 3500, 2000));   // dim for one sample
+    TEST_ASSERT_EQUAL_UINT16(1, s.streak);
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_NONE, ulp_mon_step(s, 2000, 2000));
+    TEST_ASSERT_EQUAL_UINT16(0, s.streak);
+}
+
+void test_confirmed_crossing_wakes_and_sticks(void) {
+    UlpMonState s = armed_state(60, 2, 2000, 2000);
+    ulp_mon_step(s, 2000, 3000);                                              // soil dry
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_CROSSING, ulp_mon_step(s, 2000, 3000));
+    const uint16_t count = s.count;
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_CROSSING, ulp_mon_step(s, 2000, 2000));
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(count, s.count, "nothing stored once a wake is pending");
+}
+
+void test_boundary_sample_counts_as_the_upper_zone(void) {
+    UlpMonState s = armed_state(60, 1, 899, 2000);
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_NONE, ulp_mon_step(s, 899, 2000));
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_CROSSING, ulp_mon_step(s, 900, 2000));
+}
+
+void test_full_buffer_wakes(void) {
+    UlpMonState s = armed_state(5, 2, 2000, 2000);
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_NONE, ulp_mon_step(s, 2000, 2000));
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_FULL, ulp_mon_step(s, 2000, 2000));
+    TEST_ASSERT_EQUAL_UINT16(5, s.count);
+}
+
+void test_rearm_clears_the_wake(void) {
+    UlpMonState s = armed_state(60, 1, 2000, 2000);
+    ulp_mon_step(s, 500, 2000);
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_CROSSING, s.wake);
+    ulp_mon_arm(s, 500, 2000);                                                // new reference: bright
+    TEST_ASSERT_EQUAL_INT(ULP_MON_WAKE_NONE, ulp_mon_step(s, 600, 2000));
+    TEST_ASSERT_EQUAL_UINT16(1, s.count);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_boundaries_are_the_class_changes);
+    RUN_TEST(test_constant_class_has_no_boundaries);
+    RUN_TEST(test_extra_changes_are_counted_but_not_kept);
+    RUN_TEST(test_zone_change_matches_class_change);
+    RUN_TEST(test_single_excursion_does_not_wake);
+    RUN_TEST(test_confirmed_crossing_wakes_and_sticks);
+    RUN_TEST(test_boundary_sample_counts_as_the_upper_zone);
+    RUN_TEST(test_full_buffer_wakes);
+    RUN_TEST(test_rearm_clears_the_wake);
+    return UNITY_END();
+}
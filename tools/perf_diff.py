@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# perf_diff.py
+# Compare two perf captures produced by the esp32dev-perf build, or by the
+# host benchmark in test/test_perf_bench.
+#
+# Usage:
+#   pio device monitor -e esp32dev-perf | tee run.log
+#   python tools/perf_diff.py baseline.log run.log
+#
+#   pio test -e native -f test_perf_bench -v | tee host.log
+#   python tools/perf_diff.py tools/perf_baseline_host.json host.log
+#
+# Each capture may be a raw serial or test log: the {"perf": object is taken
+# from any line that holds one, and probe values are averaged across all
+# reports in the file. Only compare host runs with host runs.
+
+import json
+import sys
+
+
+def load_capture(path):
+    totals = {}
+    with open(path, encoding="utf-8", errors="replace") as fh:
+        for line in fh:
+            start = line.find('{"perf"')
+            if start < 0:
+                continue
+            try:
+                report = json.loads(line[start:].strip())["perf"]
+            except (ValueError, KeyError):
+                continue
+            for probe in report.get("probes", []):
+                entry = totals.setdefault(probe["id"], {"n": 0, "ns": 0.0, "max_ns": 0, "allocs": 0.0})
+                entry["n"] += probe["n"]
+                entry["ns"] += probe["ns_op"] * probe["n"]
+                entry["allocs"] += probe["allocs_op"] * probe["n"]
+                entry["max_ns"] = max(entry["max_ns"], probe.get("max_ns", 0))
+    result = {}
+    for probe_id, entry in totals.items():
+        if entry["n"] == 0:
+            continue
+        result[probe_id] = {
+            "ns_op": entry["ns"] / entry["n"],
+            "max_ns": entry["max_ns"],
+            "allocs_op": entry["allocs"] / entry["n"],
+        }
+    return result
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__ or "usage: perf_diff.py BASELINE CAPTURE")
+        return 2
+    base = load_capture(argv[1])
+    run = load_capture(argv[2])
+    print(f"{'probe':<16}{'base ns':>10}{'run ns':>10}{'delta':>9}{'allocs':>9}")
+    for probe_id in sorted(set(base) | set(run)):
+        b = base.get(probe_id)
+        r = run.get(probe_id)
+        if not b or not r:
+            print(f"{probe_id:<16}{'-' if not b else round(b['ns_op']):>10}{'-' if not r else round(r['ns_op']):>10}")
+            continue
+        delta = (r["ns_op"] - b["ns_op"]) / b["ns_op"] * 100.0 if b["ns_op"] else 0.0
+        print(f"{probe_id:<16}{b['ns_op']:>10.0f}{r['ns_op']:>10.0f}{delta:>+8.1f}%{r['allocs_op']:>9.2f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# rle565_encode.py
+# Convert a raw RGB565 C array into a palette + RLE image for rle565.h.
+#
+# Usage:
+#   python tools/rle565_encode.py assets/img_logo_cuadrado.h include/img_logo_cuadrado_rle.h
+#
+# The input is the header written by the image converters already used for
+# the logos: a "static const uint16_t NAME[] PROGMEM = { 0x.... }" array plus
+# NAME_WIDTH / NAME_HEIGHT defines. The output keeps the defines and declares
+# "NAME_RLE" as an Rle565Image. The stream is decoded again before writing
+# and compared with the input, so a broken encode never reaches the build.
+
+import re
+import sys
+
+MAX_RUN = 128
+MAX_PALETTE = 256
+
+
+def load_array(path):
+    with open(path, encoding="utf-8") as fh:
+        text = fh.read()
+    m = re.search(r"uint16_t\s+(\w+)\s*\[\s*\]", text)
+    if not m:
+        raise ValueError(f"{path}: no uint16_t array found")
+    name = m.group(1)
+    defines = dict(re.findall(r"#define\s+(\w+)\s+(\d+)", text))
+    width = height = None
+    for key, value in defines.items():
+        if key.endswith("_WIDTH"):
+            width = int(value)
+        elif key.endswith("_HEIGHT"):
+            height = int(value)
+    if width is None or height is None:
+        raise ValueError(f"{path}: missing _WIDTH/_HEIGHT defines")
+    body = text[text.index("{", m.end()):text.index("}", m.end())]
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+    if len(pixels) != width * height:
+        raise ValueError(f"{path}: {len(pixels)} pixels, expected {width}x{height}")
+    return name, defines, width, height, pixels
+
+
+def build_palette(pixels):
+    # Most frequent colour first, so the common runs use small indices.
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    palette = sorted(counts, key=lambda c: (-counts[c], c))
+    if len(palette) > MAX_PALETTE:
+        raise ValueError(f"{len(palette)} colours, the format allows {MAX_PALETTE}; quantize the image first")
+    return palette
+
+
+def encode(indices):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(0x80 | (len(chunk) - 1))
+            out.extend(chunk)
+
+    i = 0
+    n = len(indices)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_RUN and indices[i + run] == indices[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(run - 1)
+            out.append(indices[i])
+        else:
+            literal.append(indices[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def decode(data, palette, count):
+    out = []
+    pos = 0
+    while pos < len(data) and len(out) < count:
+        token = data[pos]
+        pos += 1
+        length = (token & 0x7F) + 1
+        if token & 0x80:
+            out.extend(palette[idx] for idx in data[pos:pos + length])
+            pos += length
+        else:
+            out.extend([palette[data[pos]]] * length)
+            pos += 1
+    return out
+
+
+def format_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(path, name, defines, width, height, palette, data):
+    width_key = next(k for k in defines if k.endswith("_WIDTH"))
+    height_key = next(k for k in defines if k.endswith("_HEIGHT"))
+    with open(path, "w", encoding="utf-8", newline="\n") as fh:
+        fh.write("#pragma once\n\n")
+        fh.write("// Generated by tools/rle565_encode.py, do not edit.\n")
+        fh.write(f"// {width}x{height}, {len(palette)} colours, {len(data)} bytes of stream"
+                 f" ({width * height * 2} bytes raw).\n\n")
+        fh.write('#include "rle565.h"\n\n')
+        fh.write(f"#define {height_key} {height}\n")
+        fh.write(f"#define {width_key} {width}\n\n")
+        fh.write(f"static const uint16_t {name}_PALETTE[] PROGMEM = {{\n")
+        fh.write(format_array(palette, "0x{:04x}", 12) + "\n};\n\n")
+        fh.write(f"static const uint8_t {name}_DATA[] PROGMEM = {{\n")
+        fh.write(format_array(list(data), "0x{:02x}", 16) + "\n};\n\n")
+        fh.write(f"static const Rle565Image {name}_RLE = {{\n")
+        fh.write(f"    {width}, {height}, {len(palette)},\n")
+        fh.write(f"    {name}_PALETTE,\n")
+        fh.write(f"    {name}_DATA,\n")
+        fh.write(f"    sizeof({name}_DATA)\n")
+        fh.write("};\n")
+
+
+def main(argv):
+    if len(argv) != 3:
+        print("usage: rle565_encode.py INPUT.h OUTPUT.h")
+        return 2
+    name, defines, width, height, pixels = load_array(argv[1])
+    palette = build_palette(pixels)
+    lookup = {c: i for i, c in enumerate(palette)}
+    data = encode([lookup[p] for p in pixels])
+    if decode(data, palette, len(pixels)) != pixels:
+        print(f"{argv[1]}: round trip mismatch")
+        return 1
+    write_header(argv[2], name, defines, width, height, palette, data)
+    stored = len(data) + len(palette) * 2
+    print(f"{name}: {width * height * 2} -> {stored} bytes ({width * height * 2 / stored:.1f}x)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# size_report.py
+# Per-module flash/RAM footprint from the linker map of a PlatformIO build.
+#
+# Usage:
+#   pio run -e esp32dev-prod
+#   python tools/size_report.py .pio/build/esp32dev-prod/firmware.map
+#   python tools/size_report.py .pio/build/esp32dev-prod/firmware.map .pio/build/esp32dev-lab/firmware.map
+#
+# With a second map the report adds a delta column (second minus first), which
+# is how the prod and lab images are compared. Objects from src/ are reported
+# per file; everything else is grouped per library archive.
+
+import re
+import sys
+
+# Output section prefix -> report column.
+SECTIONS = (
+    (".flash.text", "text"),
+    (".flash.rodata", "rodata"),
+    (".iram0", "iram"),
+    (".dram0.data", "data"),
+    (".dram0.bss", "bss"),
+    (".rtc", "rtc"),
+)
+COLUMNS = ("text", "rodata", "iram", "data", "bss", "rtc")
+
+INPUT_RE = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+)\s*$")
+ARCHIVE_RE = re.compile(r"(?:^|/)([^/()]+)\.a\(")
+SOURCE_RE = re.compile(r"(?:^|/)src/(.+?)\.(?:c|cpp|S)\.o$")
+
+
+def column_for(section):
+    for prefix, column in SECTIONS:
+        if section.startswith(prefix):
+            return column
+    return None
+
+
+def module_for(obj):
+    m = SOURCE_RE.search(obj)
+    if m:
+        return m.group(1)
+    m = ARCHIVE_RE.search(obj)
+    if m:
+        return m.group(1)
+    return obj.rsplit("/", 1)[-1]
+
+
+def load_map(path):
+    modules = {}
+    column = None
+    pending = None          # input section name wrapped onto the next line
+    in_map = False
+    with open(path, encoding="utf-8", errors="replace") as fh:
+        for raw in fh:
+            line = raw.rstrip("\n")
+            if not in_map:
+                in_map = line.startswith("Linker script and memory map")
+                continue
+            if not line.strip():
+                continue
+            if not line[0].isspace():
+                # Output section header: ".flash.text  0x400d0020  0x5a1c4"
+                column = column_for(line.split()[0])
+                pending = None
+                continue
+            if column is None:
+                continue
+            fields = line.split()
+            if fields[0] == "*fill*":
+                continue
+            if len(fields) == 1 and fields[0].startswith("."):
+                pending = fields[0]
+                continue
+            m = INPUT_RE.match(line)
+            if m and pending is not None:
+                size, obj = int(m.group(2), 16), m.group(3)
+            elif len(fields) == 4 and fields[0].startswith(".") and fields[1].startswith("0x"):
+                size, obj = int(fields[2], 16), fields[3]
+            else:
+                pending = None
+                continue
+            pending = None
+            if size == 0:
+                continue
+            entry = modules.setdefault(module_for(obj), dict.fromkeys(COLUMNS, 0))
+            entry[column] += size
+    return modules
+
+
+def flash_of(entry):
+    return entry["text"] + entry["rodata"] + entry["iram"] + entry["data"]
+
+
+def ram_of(entry):
+    return entry["iram"] + entry["data"] + entry["bss"]
+
+
+def main(argv):
+    if len(argv) not in (2, 3):
+        print("usage: size_report.py FIRMWARE.map [OTHER.map]")
+        return 2
+    base = load_map(argv[1])
+    other = load_map(argv[2]) if len(argv) == 3 else None
+    names = set(base) | set(other or {})
+    empty = dict.fromkeys(COLUMNS, 0)
+
+    header = f"{'module':<28}" + "".join(f"{c:>9}" for c in COLUMNS) + f"{'flash':>9}{'ram':>9}"
+    if other is not None:
+        header += f"{'d.flash':>10}{'d.ram':>9}"
+    print(header)
+
+    totals = dict.fromkeys(COLUMNS, 0)
+    other_totals = dict.fromkeys(COLUMNS, 0)
+    for name in sorted(names, key=lambda n: -flash_of(base.get(n, empty))):
+        b = base.get(name, empty)
+        row = f"{name[:27]:<28}" + "".join(f"{b[c]:>9}" for c in COLUMNS)
+        row += f"{flash_of(b):>9}{ram_of(b):>9}"
+        for c in COLUMNS:
+            totals[c] += b[c]
+        if other is not None:
+            o = other.get(name, empty)
+            for c in COLUMNS:
+                other_totals[c] += o[c]
+            row += f"{flash_of(o) - flash_of(b):>+10}{ram_of(o) - ram_of(b):>+9}"
+        print(row)
+
+    total = f"{'TOTAL':<28}" + "".join(f"{totals[c]:>9}" for c in COLUMNS)
+    total += f"{flash_of(totals):>9}{ram_of(totals):>9}"
+    if other is not None:
+        total += f"{flash_of(other_totals) - flash_of(totals):>+10}{ram_of(other_totals) - ram_of(totals):>+9}"
+    print(total)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))